@@ -0,0 +1,413 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "atlas.h"
+#include "image.h"
+#include "timing.h"
+#include "mem.h"
+
+#define ATLAS_CACHE_MAGIC 0x534c5441u // "ATLS"
+// Bump when the packer or the cache layout changes
+#define ATLAS_CACHE_VERSION 1u
+
+typedef struct skyline_node {
+  int x;
+  int y;
+  int width;
+} skyline_node_t;
+
+typedef struct skyline {
+  skyline_node_t *nodes;
+  int count;
+} skyline_t;
+
+typedef struct pack_order {
+  int w;
+  int h;
+  unsigned index;
+} pack_order_t;
+
+// Native endianness, the cache never leaves the machine that wrote it
+typedef struct cache_header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t key;
+  uint32_t pageCount;
+  uint32_t regionCount;
+} cache_header_t;
+
+static int compare_pack_order( const void *a, const void *b ) {
+
+  const pack_order_t *x = a;
+  const pack_order_t *y = b;
+
+  // Tallest first, then widest, then input order so that packing is stable
+  if ( x->h != y->h )
+    return y->h - x->h;
+  if ( x->w != y->w )
+    return y->w - x->w;
+
+  return ( x->index > y->index ) - ( x->index < y->index );
+}
+
+// Lowest y at which a w x h rect fits with its left edge on node i
+static int skyline_fit( const skyline_t *sky, int i, int w, int h, int pageSize ) {
+
+  int x = sky->nodes[ i ].x;
+  if ( x + w > pageSize )
+    return -1;
+
+  int y = 0;
+  int widthLeft = w;
+
+  for ( int j = i; widthLeft > 0; ++j ) {
+    if ( j >= sky->count )
+      return -1;
+    if ( sky->nodes[ j ].y > y )
+      y = sky->nodes[ j ].y;
+    if ( y + h > pageSize )
+      return -1;
+    widthLeft -= sky->nodes[ j ].width;
+  }
+
+  return y;
+}
+
+static void skyline_place( skyline_t *sky, int i, int w, int h, int y ) {
+
+  skyline_node_t node = { sky->nodes[ i ].x, y + h, w };
+
+  memmove( sky->nodes + i + 1, sky->nodes + i, ( sky->count - i ) * sizeof( skyline_node_t ) );
+  sky->nodes[ i ] = node;
+  ++sky->count;
+
+  // Cut away what the new node now covers
+  for ( int j = i + 1; j < sky->count; ) {
+    int end = sky->nodes[ j - 1 ].x + sky->nodes[ j - 1 ].width;
+    if ( sky->nodes[ j ].x >= end )
+      break;
+
+    int shrink = end - sky->nodes[ j ].x;
+    sky->nodes[ j ].x += shrink;
+    sky->nodes[ j ].width -= shrink;
+
+    if ( sky->nodes[ j ].width > 0 )
+      break;
+
+    memmove( sky->nodes + j, sky->nodes + j + 1, ( sky->count - j - 1 ) * sizeof( skyline_node_t ) );
+    --sky->count;
+  }
+
+  // Merge neighbours at the same height
+  for ( int j = 0; j + 1 < sky->count; ) {
+    if ( sky->nodes[ j ].y == sky->nodes[ j + 1 ].y ) {
+      sky->nodes[ j ].width += sky->nodes[ j + 1 ].width;
+      memmove( sky->nodes + j + 1, sky->nodes + j + 2, ( sky->count - j - 2 ) * sizeof( skyline_node_t ) );
+      --sky->count;
+    }
+    else {
+      ++j;
+    }
+  }
+}
+
+unsigned atlas_pack( atlas_rect_t *rects, unsigned n, int pageSize, int padding ) {
+
+  pack_order_t *order = mem_alloc( MEM_SCRATCH, n * sizeof( pack_order_t ) + 1 );
+  // A skyline never has more nodes than the page has columns
+  skyline_node_t *nodes = mem_alloc( MEM_SCRATCH, ATLAS_MAX_PAGES * ( pageSize + 1 ) * sizeof( skyline_node_t ) );
+  skyline_t skylines[ ATLAS_MAX_PAGES ];
+  unsigned pageCount = 0;
+
+  if ( !order || !nodes ) {
+    fprintf( stderr, "Out of memory for atlas packing\n" );
+    pageCount = 0;
+    goto done;
+  }
+
+  for ( unsigned i = 0; i < n; ++i )
+    order[ i ] = (pack_order_t) { rects[ i ].w + padding * 2, rects[ i ].h + padding * 2, i };
+  qsort( order, n, sizeof( pack_order_t ), compare_pack_order );
+
+  for ( unsigned i = 0; i < n; ++i ) {
+    int w = order[ i ].w;
+    int h = order[ i ].h;
+    int bestPage = -1, bestNode = -1, bestY = 0, bestTop = pageSize + 1, bestWidth = 0;
+
+    // The first page it fits on, opening a new one if none has room. Within
+    // the page, bottom-left: lowest top edge first, then the snuggest node.
+    for ( unsigned p = 0; p <= pageCount && bestPage < 0; ++p ) {
+      if ( p == pageCount ) {
+        if ( pageCount == ATLAS_MAX_PAGES )
+          break;
+        skylines[ p ].nodes = nodes + p * ( pageSize + 1 );
+        skylines[ p ].nodes[ 0 ] = (skyline_node_t) { 0, 0, pageSize };
+        skylines[ p ].count = 1;
+      }
+
+      for ( int j = 0; j < skylines[ p ].count; ++j ) {
+        int y = skyline_fit( &skylines[ p ], j, w, h, pageSize );
+        if ( y < 0 )
+          continue;
+        int width = skylines[ p ].nodes[ j ].width;
+        if ( y + h < bestTop || ( y + h == bestTop && width < bestWidth ) ) {
+          bestPage = (int) p;
+          bestNode = j;
+          bestY = y;
+          bestTop = y + h;
+          bestWidth = width;
+        }
+      }
+
+      if ( bestPage >= 0 && p == pageCount )
+        ++pageCount;
+    }
+
+    if ( bestPage < 0 ) {
+      fprintf( stderr, "Atlas: a %dx%d image doesn't fit on %d pages of %d pixels\n", w, h, ATLAS_MAX_PAGES, pageSize );
+      pageCount = 0;
+      goto done;
+    }
+
+    atlas_rect_t *rect = &rects[ order[ i ].index ];
+    rect->page = bestPage;
+    rect->x = skylines[ bestPage ].nodes[ bestNode ].x + padding;
+    rect->y = bestY + padding;
+    skyline_place( &skylines[ bestPage ], bestNode, w, h, bestY );
+  }
+
+done:
+  mem_free( order );
+  mem_free( nodes );
+
+  return pageCount;
+}
+
+static int next_power_of_two( int v ) {
+
+  int p = 1;
+  while ( p < v )
+    p <<= 1;
+
+  return p;
+}
+
+// FNV-1a
+static uint64_t hash_bytes( uint64_t hash, const void *data, size_t size ) {
+
+  const unsigned char *bytes = data;
+
+  for ( size_t i = 0; i < size; ++i )
+    hash = ( hash ^ bytes[ i ] ) * 0x100000001b3ull;
+
+  return hash;
+}
+
+static int hash_file( uint64_t *hash, const char *path ) {
+
+  FILE *file = fopen( path, "rb" );
+  if ( !file ) {
+    fprintf( stderr, "File not found: %s\n", path );
+    return 0;
+  }
+
+  unsigned char buffer[ 64 << 10 ];
+  size_t read;
+
+  while ( ( read = fread( buffer, 1, sizeof( buffer ), file ) ) > 0 )
+    *hash = hash_bytes( *hash, buffer, read );
+
+  fclose( file );
+
+  return 1;
+}
+
+// Copies the image and repeats its outermost pixels over the padding
+static void blit_extruded( unsigned char *page, int pageW, int pageH, const unsigned char *pixels, const atlas_rect_t *rect, int padding ) {
+
+  for ( int y = -padding; y < rect->h + padding; ++y ) {
+    int sy = y < 0 ? 0 : y >= rect->h ? rect->h - 1 : y;
+    int dy = rect->y + y;
+    if ( dy < 0 || dy >= pageH )
+      continue;
+
+    for ( int x = -padding; x < rect->w + padding; ++x ) {
+      int sx = x < 0 ? 0 : x >= rect->w ? rect->w - 1 : x;
+      int dx = rect->x + x;
+      if ( dx < 0 || dx >= pageW )
+        continue;
+      memcpy( page + ( (size_t) dy * pageW + dx ) * 4, pixels + ( (size_t) sy * rect->w + sx ) * 4, 4 );
+    }
+  }
+}
+
+static void set_regions( atlas_t *atlas, const atlas_rect_t *rects ) {
+
+  for ( unsigned i = 0; i < atlas->regionCount; ++i ) {
+    const atlas_rect_t *r = &rects[ i ];
+    const texture_t *page = atlas->pages[ r->page ];
+    atlas->regions[ i ] = (atlas_region_t) { page,
+      r->x / (float) page->width, r->y / (float) page->height,
+      ( r->x + r->w ) / (float) page->width, ( r->y + r->h ) / (float) page->height,
+      r->w, r->h };
+  }
+}
+
+static int load_cache( atlas_t *atlas, const char *path, uint64_t key, atlas_rect_t *rects ) {
+
+  FILE *file = fopen( path, "rb" );
+  if ( !file )
+    return 0;
+
+  cache_header_t header;
+  int ok = fread( &header, sizeof( header ), 1, file ) == 1 &&
+    header.magic == ATLAS_CACHE_MAGIC && header.version == ATLAS_CACHE_VERSION && header.key == key &&
+    header.regionCount == atlas->regionCount && header.pageCount > 0 && header.pageCount <= ATLAS_MAX_PAGES;
+
+  int sizes[ ATLAS_MAX_PAGES * 2 ];
+  ok = ok && fread( sizes, sizeof( int ) * 2, header.pageCount, file ) == header.pageCount &&
+    fread( rects, sizeof( atlas_rect_t ), atlas->regionCount, file ) == atlas->regionCount;
+
+  for ( unsigned p = 0; ok && p < header.pageCount; ++p ) {
+    size_t bytes = (size_t) sizes[ p * 2 ] * sizes[ p * 2 + 1 ] * 4;
+    unsigned char *pixels = mem_alloc( MEM_SCRATCH, bytes );
+    ok = pixels && fread( pixels, 1, bytes, file ) == bytes;
+    if ( ok ) {
+      atlas->pages[ p ] = create_texture( pixels, sizes[ p * 2 ], sizes[ p * 2 + 1 ] );
+      atlas->pageCount = p + 1;
+    }
+    mem_free( pixels );
+  }
+
+  fclose( file );
+
+  if ( !ok ) {
+    // Stale or damaged, rebuild it
+    for ( unsigned p = 0; p < atlas->pageCount; ++p )
+      destroy_texture( atlas->pages[ p ] );
+    atlas->pageCount = 0;
+  }
+
+  return ok;
+}
+
+static void write_cache( const char *path, uint64_t key, const atlas_rect_t *rects, unsigned regionCount,
+  unsigned char * const *pages, const int *sizes, unsigned pageCount ) {
+
+  FILE *file = fopen( path, "wb" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write the atlas cache %s\n", path );
+    return;
+  }
+
+  cache_header_t header = { ATLAS_CACHE_MAGIC, ATLAS_CACHE_VERSION, key, pageCount, regionCount };
+  fwrite( &header, sizeof( header ), 1, file );
+  fwrite( sizes, sizeof( int ) * 2, pageCount, file );
+  fwrite( rects, sizeof( atlas_rect_t ), regionCount, file );
+
+  for ( unsigned p = 0; p < pageCount; ++p )
+    fwrite( pages[ p ], 1, (size_t) sizes[ p * 2 ] * sizes[ p * 2 + 1 ] * 4, file );
+
+  if ( fclose( file ) != 0 )
+    fprintf( stderr, "Could not write the atlas cache %s\n", path );
+}
+
+int atlas_build( atlas_t *atlas, const char * const *paths, unsigned n, const char *cachePath ) {
+
+  uint64_t start = timing_now_ns();
+
+  memset( atlas, 0, sizeof( atlas_t ) );
+  atlas->regionCount = n;
+  atlas->regions = mem_alloc( MEM_ASSETS, n * sizeof( atlas_region_t ) + 1 );
+  atlas_rect_t *rects = mem_calloc( MEM_SCRATCH, n + 1, sizeof( atlas_rect_t ) );
+  unsigned char **images = mem_calloc( MEM_SCRATCH, n + 1, sizeof( unsigned char* ) );
+
+  if ( !atlas->regions || !rects || !images ) {
+    fprintf( stderr, "Out of memory for the atlas\n" );
+    return 0;
+  }
+
+  // The key covers everything that affects the result
+  uint64_t key = 0xcbf29ce484222325ull;
+  uint32_t params[] = { ATLAS_CACHE_VERSION, ATLAS_PAGE_SIZE, ATLAS_PADDING, n };
+  key = hash_bytes( key, params, sizeof( params ) );
+
+  int ok = 1;
+  for ( unsigned i = 0; ok && i < n; ++i ) {
+    key = hash_bytes( key, paths[ i ], strlen( paths[ i ] ) + 1 );
+    ok = hash_file( &key, paths[ i ] );
+  }
+
+  int fromCache = ok && cachePath && load_cache( atlas, cachePath, key, rects );
+
+  if ( ok && !fromCache ) {
+    for ( unsigned i = 0; ok && i < n; ++i ) {
+      images[ i ] = image_read_png( paths[ i ], &rects[ i ].w, &rects[ i ].h );
+      ok = images[ i ] != NULL;
+    }
+
+    unsigned pageCount = ok ? atlas_pack( rects, n, ATLAS_PAGE_SIZE, ATLAS_PADDING ) : 0;
+    unsigned char *pages[ ATLAS_MAX_PAGES ] = { NULL };
+    int sizes[ ATLAS_MAX_PAGES * 2 ];
+    ok = pageCount > 0;
+
+    // Pages only get as big as their contents, rounded up to a power of two
+    for ( unsigned p = 0; p < pageCount; ++p ) {
+      int w = 1, h = 1;
+      for ( unsigned i = 0; i < n; ++i ) {
+        if ( rects[ i ].page != (int) p )
+          continue;
+        if ( rects[ i ].x + rects[ i ].w + ATLAS_PADDING > w )
+          w = rects[ i ].x + rects[ i ].w + ATLAS_PADDING;
+        if ( rects[ i ].y + rects[ i ].h + ATLAS_PADDING > h )
+          h = rects[ i ].y + rects[ i ].h + ATLAS_PADDING;
+      }
+      sizes[ p * 2 ] = next_power_of_two( w );
+      sizes[ p * 2 + 1 ] = next_power_of_two( h );
+      pages[ p ] = mem_calloc( MEM_SCRATCH, (size_t) sizes[ p * 2 ] * sizes[ p * 2 + 1 ], 4 );
+      ok = ok && pages[ p ];
+    }
+
+    for ( unsigned i = 0; ok && i < n; ++i ) {
+      int p = rects[ i ].page;
+      blit_extruded( pages[ p ], sizes[ p * 2 ], sizes[ p * 2 + 1 ], images[ i ], &rects[ i ], ATLAS_PADDING );
+    }
+
+    if ( ok && cachePath )
+      write_cache( cachePath, key, rects, n, pages, sizes, pageCount );
+
+    for ( unsigned p = 0; p < pageCount; ++p ) {
+      if ( ok ) {
+        atlas->pages[ p ] = create_texture( pages[ p ], sizes[ p * 2 ], sizes[ p * 2 + 1 ] );
+        atlas->pageCount = p + 1;
+      }
+      mem_free( pages[ p ] );
+    }
+  }
+
+  if ( ok )
+    set_regions( atlas, rects );
+
+  for ( unsigned i = 0; i < n; ++i )
+    mem_free( images[ i ] );
+  mem_free( images );
+  mem_free( rects );
+
+  if ( !ok ) {
+    atlas_destroy( atlas );
+    return 0;
+  }
+
+  printf( "Atlas: %u images on %u page(s), %s in %.2f ms\n", n, atlas->pageCount,
+    fromCache ? "from cache" : "packed", ( timing_now_ns() - start ) / (double) NS_PER_MS );
+
+  return 1;
+}
+
+void atlas_destroy( atlas_t *atlas ) {
+
+  for ( unsigned p = 0; p < atlas->pageCount; ++p )
+    destroy_texture( atlas->pages[ p ] );
+  mem_free( atlas->regions );
+  memset( atlas, 0, sizeof( atlas_t ) );
+}
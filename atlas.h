@@ -0,0 +1,54 @@
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include <stdint.h>
+#include "texture.h"
+
+/*
+ * Packs sprite images into a few power-of-two texture pages, so that sprites
+ * from different images can share a draw. Images are placed with a skyline
+ * bottom-left packer, each surrounded by ATLAS_PADDING pixels that repeat its
+ * edge (extrusion), so that filtering never pulls in a neighbour. The packed
+ * pages are cached in a binary file keyed by a hash of the source images, and
+ * later startups just upload them.
+ */
+#define ATLAS_PAGE_SIZE 2048
+#define ATLAS_MAX_PAGES 16
+// Enough for linear filtering and the first couple of mip levels
+#define ATLAS_PADDING 4
+
+// What to pack (w, h) and where it went
+typedef struct atlas_rect {
+  int w;
+  int h;
+  int page;
+  int x;
+  int y;
+} atlas_rect_t;
+
+typedef struct atlas_region {
+  const texture_t *page;
+  // Top-left and bottom-right corners, as sprite_batch_draw_uv() takes them
+  float u0, v0, u1, v1;
+  int width;
+  int height;
+} atlas_region_t;
+
+typedef struct atlas {
+  texture_t *pages[ ATLAS_MAX_PAGES ];
+  unsigned pageCount;
+  // One per source image, in the order they were given
+  atlas_region_t *regions;
+  unsigned regionCount;
+} atlas_t;
+
+// Places the rects, each grown by padding on every side, onto pages of
+// pageSize pixels. Returns the number of pages, 0 if something doesn't fit.
+unsigned atlas_pack( atlas_rect_t *rects, unsigned n, int pageSize, int padding );
+
+// Loads the atlas from cachePath if it was built from the same images,
+// otherwise packs them and writes the cache. cachePath may be NULL.
+int atlas_build( atlas_t *atlas, const char * const *paths, unsigned n, const char *cachePath );
+void atlas_destroy( atlas_t *atlas );
+
+#endif
@@ -0,0 +1,24 @@
+#ifndef BACKEND_H
+#define BACKEND_H
+
+/*
+ * Where the GL context comes from and where finished frames go. The SDL
+ * backend renders into a window, the EGL one into an FBO on a surfaceless
+ * (or pbuffer) context, for machines without a display server.
+ */
+typedef struct backend {
+  const char *name;
+  int (*init)( int width, int height );
+  void (*destroy)();
+  void* (*get_proc_address)( const char *name );
+  // (Re)allocates the output framebuffer. Called once GL functions are loaded.
+  void (*resize)( int width, int height );
+  // The framebuffer frames should end up in: 0 for a window
+  unsigned (*framebuffer)();
+  void (*present)();
+} backend_t;
+
+extern const backend_t backend_sdl;
+extern const backend_t backend_egl;
+
+#endif
@@ -0,0 +1,154 @@
+#include <stdio.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <glad/glad.h>
+#include "backend.h"
+#include "gpu_mem.h"
+
+static EGLDisplay eglDisplay = EGL_NO_DISPLAY;
+static EGLContext eglContext = EGL_NO_CONTEXT;
+static EGLSurface eglSurface = EGL_NO_SURFACE;
+static unsigned fbo;
+static unsigned colorRbo;
+static unsigned depthRbo;
+
+static int create_context() {
+
+  PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+    (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress( "eglGetPlatformDisplayEXT" );
+
+  int surfaceless = 0;
+
+  if ( getPlatformDisplay ) {
+    eglDisplay = getPlatformDisplay( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL );
+    surfaceless = eglDisplay != EGL_NO_DISPLAY && eglInitialize( eglDisplay, NULL, NULL );
+  }
+
+  // Fall back to a pbuffer on whatever the default display is
+  if ( !surfaceless ) {
+    eglDisplay = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+    if ( eglDisplay == EGL_NO_DISPLAY || !eglInitialize( eglDisplay, NULL, NULL ) ) {
+      fprintf( stderr, "Could not init EGL: 0x%x\n", eglGetError() );
+      return 0;
+    }
+  }
+
+  if ( !eglBindAPI( EGL_OPENGL_API ) ) {
+    fprintf( stderr, "EGL has no desktop OpenGL\n" );
+    return 0;
+  }
+
+  const EGLint configAttribs[] = {
+    EGL_SURFACE_TYPE, surfaceless ? 0 : EGL_PBUFFER_BIT,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_RED_SIZE, 8,
+    EGL_GREEN_SIZE, 8,
+    EGL_BLUE_SIZE, 8,
+    EGL_NONE
+  };
+  EGLConfig config = NULL;
+  EGLint nConfigs = 0;
+  eglChooseConfig( eglDisplay, configAttribs, &config, 1, &nConfigs );
+
+  if ( nConfigs == 0 && !surfaceless ) {
+    fprintf( stderr, "No suitable EGL config\n" );
+    return 0;
+  }
+
+  const EGLint contextAttribs[] = {
+    EGL_CONTEXT_MAJOR_VERSION, 3,
+    EGL_CONTEXT_MINOR_VERSION, 3,
+    EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+    EGL_NONE
+  };
+  // Surfaceless contexts don't need a config (EGL_KHR_no_config_context)
+  eglContext = eglCreateContext( eglDisplay, nConfigs ? config : EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, contextAttribs );
+
+  if ( eglContext == EGL_NO_CONTEXT ) {
+    fprintf( stderr, "Could not create EGL context: 0x%x\n", eglGetError() );
+    return 0;
+  }
+
+  // The pbuffer only exists to make the context current, we draw into an FBO
+  if ( !surfaceless ) {
+    const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+    eglSurface = eglCreatePbufferSurface( eglDisplay, config, pbufferAttribs );
+  }
+
+  if ( !eglMakeCurrent( eglDisplay, eglSurface, eglSurface, eglContext ) ) {
+    fprintf( stderr, "Could not make EGL context current: 0x%x\n", eglGetError() );
+    return 0;
+  }
+
+  printf( "EGL context: %s\n", surfaceless ? "surfaceless" : "pbuffer" );
+
+  return 1;
+}
+
+static void egl_resize( int width, int height ) {
+
+  if ( !fbo ) {
+    glGenFramebuffers( 1, &fbo );
+    glGenRenderbuffers( 1, &colorRbo );
+    glGenRenderbuffers( 1, &depthRbo );
+  }
+
+  glBindRenderbuffer( GL_RENDERBUFFER, colorRbo );
+  glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, width, height );
+  gpu_mem_track( GPU_MEM_RENDERBUFFER, colorRbo, (size_t) width * height * 4, GL_RGBA8, "backend" );
+  glBindRenderbuffer( GL_RENDERBUFFER, depthRbo );
+  glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height );
+  gpu_mem_track( GPU_MEM_RENDERBUFFER, depthRbo, (size_t) width * height * 4, GL_DEPTH_COMPONENT24, "backend" );
+
+  glBindFramebuffer( GL_FRAMEBUFFER, fbo );
+  glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRbo );
+  glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRbo );
+
+  if ( glCheckFramebufferStatus( GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE )
+    fprintf( stderr, "Offscreen framebuffer is incomplete\n" );
+}
+
+static int egl_init( int width, int height ) {
+
+  // The framebuffer is made in egl_resize(), once GL functions are loaded
+  return create_context();
+}
+
+static void egl_destroy() {
+
+  glDeleteFramebuffers( 1, &fbo );
+  glDeleteRenderbuffers( 1, &colorRbo );
+  gpu_mem_release( GPU_MEM_RENDERBUFFER, colorRbo );
+  glDeleteRenderbuffers( 1, &depthRbo );
+  gpu_mem_release( GPU_MEM_RENDERBUFFER, depthRbo );
+
+  eglMakeCurrent( eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+  if ( eglSurface != EGL_NO_SURFACE )
+    eglDestroySurface( eglDisplay, eglSurface );
+  eglDestroyContext( eglDisplay, eglContext );
+  eglTerminate( eglDisplay );
+}
+
+static void* egl_get_proc_address( const char *name ) {
+  return (void*) eglGetProcAddress( name );
+}
+
+static unsigned egl_framebuffer() {
+  return fbo;
+}
+
+static void egl_present() {
+
+  // Nobody is waiting for the image, just make sure the work gets going
+  glFlush();
+}
+
+const backend_t backend_egl = {
+  "egl",
+  egl_init,
+  egl_destroy,
+  egl_get_proc_address,
+  egl_resize,
+  egl_framebuffer,
+  egl_present
+};
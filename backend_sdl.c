@@ -0,0 +1,80 @@
+#include <stdio.h>
+#include <SDL2/SDL.h>
+#include "backend.h"
+
+static SDL_Window *window;
+static SDL_GLContext glContext;
+
+static int sdl_init( int width, int height ) {
+
+  if ( SDL_Init( SDL_INIT_VIDEO ) < 0 ) {
+    fprintf( stderr, "Could not init SDL: %s\n", SDL_GetError() );
+    return 0;
+  }
+
+  SDL_GL_SetAttribute( SDL_GL_CONTEXT_MAJOR_VERSION, 3 );
+  SDL_GL_SetAttribute( SDL_GL_CONTEXT_MINOR_VERSION, 3 );
+  SDL_GL_SetAttribute( SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE );
+
+  window = SDL_CreateWindow(
+    "OpenGL test",
+    SDL_WINDOWPOS_CENTERED,
+    SDL_WINDOWPOS_CENTERED,
+    width,
+    height,
+    SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE
+  );
+
+  if ( window == NULL ) {
+    fprintf( stderr, "Could not create window: %s\n", SDL_GetError() );
+    return 0;
+  }
+
+  glContext = SDL_GL_CreateContext( window );
+
+  if ( !glContext ) {
+    fprintf( stderr, "Could not create GL context: %s\n", SDL_GetError() );
+    return 0;
+  }
+
+  // Vsync
+  SDL_GL_SetSwapInterval( 1 );
+
+  return 1;
+}
+
+static void sdl_destroy() {
+
+  SDL_GL_DeleteContext( glContext );
+  SDL_DestroyWindow( window );
+  SDL_Quit();
+}
+
+static void* sdl_get_proc_address( const char *name ) {
+  return SDL_GL_GetProcAddress( name );
+}
+
+static void sdl_resize( int width, int height ) {
+  // The window's framebuffer follows the window
+}
+
+static unsigned sdl_framebuffer() {
+  return 0;
+}
+
+static void sdl_present() {
+
+  // FIXME: "On Mac OS X make sure you bind 0 to the draw framebuffer before
+  // swapping the window, otherwise nothing will happen"
+  SDL_GL_SwapWindow( window );
+}
+
+const backend_t backend_sdl = {
+  "sdl",
+  sdl_init,
+  sdl_destroy,
+  sdl_get_proc_address,
+  sdl_resize,
+  sdl_framebuffer,
+  sdl_present
+};
@@ -0,0 +1,496 @@
+/*
+ * Offscreen renderer throughput benchmark. Renders a synthetic scene of
+ * N objects with K vertices each, spread over M shader programs, into an FBO
+ * on a surfaceless EGL context (works on Mesa llvmpipe without a display).
+ *
+ * -s spreads the scene over a world s times the size of the view, so that
+ * only about 1 / s^2 of it survives frustum culling.
+ *
+ * -p adds that many rotating tank sprites per frame through the sprite batch.
+ *
+ * -l replaces the triangle soup with indexed units of about K vertices, each
+ * simplified into that many levels of detail, and views them through a
+ * tilted perspective camera so that they cover a range of distances. Levels
+ * are picked per frame by screen size.
+ *
+ * -b adds that many buildings, opaque boxes drawn first with depth testing,
+ * and -q 1 occlusion tests the objects against them.
+ *
+ * ./bench -n 1000 -m 4 -k 30 -f 200 -o bench.json
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <glad/glad.h>
+#include <glad/gl_stats.h>
+#include "renderer.h"
+#include "timing.h"
+#include "histogram.h"
+#include "gpu_mem.h"
+#include "camera.h"
+#include "ubo.h"
+#include "sprite_batch.h"
+#include "jobs.h"
+#include "occlusion.h"
+
+#define BENCH_WARMUP_FRAMES 10
+
+typedef struct bench_config {
+  unsigned objects;
+  unsigned shaders;
+  unsigned vertices;
+  unsigned frames;
+  int width;
+  int height;
+  float spread;
+  unsigned sprites;
+  unsigned lods;
+  unsigned buildings;
+  int occlusion;
+  const char *jsonPath;
+} bench_config_t;
+
+// Deterministic, so that every run draws exactly the same scene
+static float rand_unit( unsigned *state ) {
+
+  *state = *state * 1664525u + 1013904223u;
+  return ( *state >> 8 ) / (float) ( 1 << 24 );
+}
+
+// A clump of small triangles around the origin, spread out by move_object()
+static game_object_t* create_random_object( unsigned nVertices, unsigned *seed ) {
+
+  vec3_t *locations = malloc( nVertices * sizeof( vec3_t ) );
+  vec3_t *colors = malloc( nVertices * sizeof( vec3_t ) );
+
+  for ( unsigned i = 0; i < nVertices; i += 3 ) {
+    float x = ( rand_unit( seed ) * 2.0f - 1.0f ) * 0.05f;
+    float y = ( rand_unit( seed ) * 2.0f - 1.0f ) * 0.05f;
+    for ( unsigned v = 0; v < 3 && i + v < nVertices; ++v ) {
+      locations[ i + v ] = (vec3_t) { x + rand_unit( seed ) * 0.05f, y + rand_unit( seed ) * 0.05f, 0.0f };
+      colors[ i + v ] = (vec3_t) { rand_unit( seed ), rand_unit( seed ), rand_unit( seed ) };
+    }
+  }
+
+  game_object_t *obj = create_object( locations, colors, nVertices );
+
+  free( locations );
+  free( colors );
+
+  return obj;
+}
+
+// A bumpy square grid of about nVertices, as a stand-in for an imported unit
+static game_object_t* create_unit_object( unsigned nVertices, unsigned nLods, unsigned *seed ) {
+
+  unsigned side = 2;
+  while ( ( side + 1 ) * ( side + 1 ) <= nVertices )
+    ++side;
+  nVertices = side * side;
+  unsigned nIndices = ( side - 1 ) * ( side - 1 ) * 6;
+
+  vec3_t *locations = malloc( nVertices * sizeof( vec3_t ) );
+  vec3_t *colors = malloc( nVertices * sizeof( vec3_t ) );
+  unsigned *indices = malloc( nIndices * sizeof( unsigned ) );
+
+  float phase = rand_unit( seed ) * 6.2832f;
+  vec3_t tint = { rand_unit( seed ), rand_unit( seed ), rand_unit( seed ) };
+  for ( unsigned y = 0; y < side; ++y ) {
+    for ( unsigned x = 0; x < side; ++x ) {
+      float u = x / (float) ( side - 1 ) - 0.5f, v = y / (float) ( side - 1 ) - 0.5f;
+      float height = 0.05f * ( 1.0f - 4.0f * ( u * u + v * v ) ) + 0.01f * sinf( u * 12.0f + phase ) * cosf( v * 9.0f );
+      locations[ y * side + x ] = (vec3_t) { u * 0.2f, v * 0.2f, height };
+      colors[ y * side + x ] = vec3_scale( tint, 0.6f + 4.0f * height );
+    }
+  }
+
+  unsigned *index = indices;
+  for ( unsigned y = 0; y + 1 < side; ++y ) {
+    for ( unsigned x = 0; x + 1 < side; ++x ) {
+      unsigned i = y * side + x;
+      *index++ = i;
+      *index++ = i + 1;
+      *index++ = i + side + 1;
+      *index++ = i;
+      *index++ = i + side + 1;
+      *index++ = i + side;
+    }
+  }
+
+  game_object_t *obj = create_lod_object( locations, colors, nVertices, indices, nIndices, nLods );
+
+  free( locations );
+  free( colors );
+  free( indices );
+
+  return obj;
+}
+
+// A box standing on the ground, each side shaded differently
+static game_object_t* create_building_object( float spread, unsigned *seed ) {
+
+  vec3_t size = { 0.15f + rand_unit( seed ) * 0.2f, 0.15f + rand_unit( seed ) * 0.2f, 0.2f + rand_unit( seed ) * 0.3f };
+  vec3_t min = { ( rand_unit( seed ) * 2.0f - 1.0f ) * spread, ( rand_unit( seed ) * 2.0f - 1.0f ) * spread, 0.0f };
+  static const unsigned char faces[ 6 ][ 4 ] = {
+    { 0, 1, 3, 2 }, { 4, 6, 7, 5 }, { 0, 4, 5, 1 }, { 2, 3, 7, 6 }, { 0, 2, 6, 4 }, { 1, 5, 7, 3 }
+  };
+
+  vec3_t locations[ 36 ];
+  vec3_t colors[ 36 ];
+  for ( unsigned f = 0; f < 6; ++f ) {
+    vec3_t corners[ 4 ];
+    for ( unsigned c = 0; c < 4; ++c ) {
+      unsigned bits = faces[ f ][ c ];
+      corners[ c ] = (vec3_t) { min.x + ( bits & 1 ) * size.x, min.y + ( bits >> 1 & 1 ) * size.y, min.z + ( bits >> 2 ) * size.z };
+    }
+    static const unsigned char quad[ 6 ] = { 0, 1, 2, 0, 2, 3 };
+    float shade = 0.3f + 0.1f * f;
+    for ( unsigned v = 0; v < 6; ++v ) {
+      locations[ f * 6 + v ] = corners[ quad[ v ] ];
+      colors[ f * 6 + v ] = (vec3_t) { shade, shade, shade };
+    }
+  }
+
+  return create_object( locations, colors, 36 );
+}
+
+static void usage() {
+
+  fprintf( stderr, "Usage: bench [-n objects] [-m shaders] [-k vertices per object] [-f frames] [-w width] [-h height] [-s spread] [-p sprites] [-l levels of detail] [-b buildings] [-q occlusion] [-o results.json]\n" );
+}
+
+static int parse_args( bench_config_t *config, int argc, char **argv ) {
+
+  for ( int i = 1; i < argc; ++i ) {
+    if ( i + 1 >= argc || argv[ i ][ 0 ] != '-' || strlen( argv[ i ] ) != 2 )
+      return 0;
+
+    const char *value = argv[ ++i ];
+
+    switch ( argv[ i - 1 ][ 1 ] ) {
+      case 'n': config->objects = atoi( value ); break;
+      case 'm': config->shaders = atoi( value ); break;
+      case 'k': config->vertices = atoi( value ); break;
+      case 'f': config->frames = atoi( value ); break;
+      case 'w': config->width = atoi( value ); break;
+      case 'h': config->height = atoi( value ); break;
+      case 's': config->spread = atof( value ); break;
+      case 'p': config->sprites = atoi( value ); break;
+      case 'l': config->lods = atoi( value ); break;
+      case 'b': config->buildings = atoi( value ); break;
+      case 'q': config->occlusion = atoi( value ); break;
+      case 'o': config->jsonPath = value; break;
+      default: return 0;
+    }
+  }
+
+  return config->objects > 0 && config->shaders > 0 && config->vertices >= 3 &&
+    config->frames > 0 && config->width > 0 && config->height > 0 && config->spread > 0.0f &&
+    config->lods <= OBJECT_MAX_LODS;
+}
+
+int main( int argc, char **argv ) {
+
+  bench_config_t config = { 1000, 4, 30, 200, 1280, 720, 1.0f, 0, 0, 0, 0, NULL };
+
+  if ( !parse_args( &config, argc, argv ) ) {
+    usage();
+    return 1;
+  }
+
+  if ( !r_init( &backend_egl, config.width, config.height ) )
+    return 1;
+
+  glViewport( 0, 0, config.width, config.height );
+
+  shader_t **shaders = malloc( config.shaders * sizeof( shader_t* ) );
+
+  for ( unsigned i = 0; i < config.shaders; ++i ) {
+    shaders[ i ] = create_shader( "shader.vert", i % 2 ? "shader2.frag" : "shader.frag" );
+    if ( !shaders[ i ] )
+      return 1;
+  }
+
+  unsigned seed = 1;
+  // Buildings follow the objects, so that one cull_objects() covers both
+  game_object_t **objects = malloc( ( config.objects + config.buildings ) * sizeof( game_object_t* ) );
+  static bvh_t bvh;
+  bvh_init( &bvh );
+
+  uint64_t lodStart = timing_now_ns();
+  for ( unsigned i = 0; i < config.objects; ++i ) {
+    if ( config.lods )
+      objects[ i ] = create_unit_object( config.vertices, config.lods, &seed );
+    else
+      objects[ i ] = create_random_object( config.vertices, &seed );
+    if ( !objects[ i ] )
+      return 1;
+    vec3_t position = {
+      ( rand_unit( &seed ) * 2.0f - 1.0f ) * config.spread, ( rand_unit( &seed ) * 2.0f - 1.0f ) * config.spread, 0.0f
+    };
+    move_object( &bvh, objects[ i ], position );
+  }
+  double lodBuildMs = config.lods ? ( timing_now_ns() - lodStart ) / (double) NS_PER_MS : 0.0;
+
+  game_object_t **buildings = objects + config.objects;
+  for ( unsigned i = 0; i < config.buildings; ++i ) {
+    buildings[ i ] = create_building_object( config.spread, &seed );
+    if ( !buildings[ i ] )
+      return 1;
+    move_object( &bvh, buildings[ i ], (vec3_t) { 0.0f, 0.0f, 0.0f } );
+  }
+  if ( config.buildings )
+    glEnable( GL_DEPTH_TEST );
+
+  static occlusion_t occlusion;
+  if ( config.occlusion && !occlusion_init( &occlusion, config.objects ) )
+    return 1;
+
+  // The same view of the -1..1 square as the game, or looking over it from
+  // its near edge for levels of detail
+  camera_t camera;
+  if ( config.lods ) {
+    camera_init_perspective( &camera, (vec3_t) { 0.0f, -1.6f, 0.6f }, (vec3_t) { 0.0f, 0.2f, 0.0f }, 1.0f, 0.05f, 10.0f );
+    camera_update( &camera, config.width / (float) config.height );
+  }
+  else {
+    camera_init_ortho( &camera, (vec3_t) { 0.0f, 0.0f, 1.0f }, (vec3_t) { 0.0f, 0.0f, 0.0f }, 2.0f, 0.1f, 10.0f );
+  }
+  frame_block_t frameBlock = { camera.view, camera.projection, camera.viewProjection, { 0.0f, 0.0f, 0.0f, 0.0f } };
+  ubo_frame_update( &frameBlock );
+
+  // Room for every object's and proxy's block, at the largest alignment GL
+  // allows
+  static ubo_ring_t uniformRing;
+  if ( !ubo_ring_init( &uniformRing, ( config.objects * 2 + config.buildings ) * (size_t) 256 ) )
+    return 1;
+  long *blocks = malloc( ( config.objects + config.buildings ) * sizeof( long ) );
+
+  static sprite_batch_t sprites;
+  texture_t *tankTexture = NULL;
+  if ( config.sprites ) {
+    jobs_init( 0 );
+    tankTexture = load_texture( "tank.png" );
+    if ( !tankTexture || !sprite_batch_init( &sprites, config.sprites ) )
+      return 1;
+  }
+
+  printf( "Scene: %u objects, %u shaders, %u vertices per object, %u frames at %dx%d, spread %.1f, %u buildings\n",
+    config.objects, config.shaders, config.vertices, config.frames, config.width, config.height, config.spread, config.buildings );
+
+  static histogram_t frameTimes;
+  histogram_reset( &frameTimes );
+  // Just the object draw loop, see "CPU time per draw"
+  uint64_t drawNs = 0;
+  uint64_t cullNs = 0;
+  uint64_t spriteNs = 0;
+  uint64_t visibleDraws = 0;
+  uint64_t visibleObjects = 0;
+  uint64_t drawnTriangles = 0;
+  // What the same draws would have cost at full detail
+  uint64_t fullTriangles = 0;
+  uint64_t lodDraws[ OBJECT_MAX_LODS ] = { 0 };
+  uint64_t occlusionTested = 0;
+  uint64_t occlusionSkipped = 0;
+  uint64_t occlusionSavedTriangles = 0;
+  uint64_t benchStart = 0;
+
+  for ( unsigned frame = 0; frame < BENCH_WARMUP_FRAMES + config.frames; ++frame ) {
+
+    if ( frame == BENCH_WARMUP_FRAMES )
+      benchStart = timing_now_ns();
+
+    uint64_t frameStart = timing_now_ns();
+
+    glClear( config.buildings ? GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT : GL_COLOR_BUFFER_BIT );
+
+    uint64_t cullStart = timing_now_ns();
+    // Every visible leaf gets marked by each call, so cull the lot once
+    unsigned visibleAll = cull_objects( &bvh, &camera.frustum, objects, config.objects + config.buildings );
+    uint64_t cullEnd = timing_now_ns();
+    unsigned visible = 0;
+    for ( unsigned i = 0; i < config.objects; ++i )
+      visible += objects[ i ]->visible;
+    unsigned visibleBuildings = visibleAll - visible;
+
+    uint64_t frameTriangles = 0, frameFullTriangles = 0, frameSavedTriangles = 0;
+    for ( unsigned i = 0; i < config.objects; ++i ) {
+      if ( !objects[ i ]->visible )
+        continue;
+      unsigned lod = select_object_lod( objects[ i ], &camera, (float) config.height );
+      frameFullTriangles += objects[ i ]->lodCount ? objects[ i ]->lods[ 0 ].count / 3 : objects[ i ]->vertex_count / 3;
+      if ( frame >= BENCH_WARMUP_FRAMES )
+        ++lodDraws[ lod ];
+    }
+
+    ubo_ring_begin( &uniformRing );
+    for ( unsigned i = 0; i < config.objects; ++i )
+      blocks[ i ] = push_object_block( &uniformRing, objects[ i ], ( i & 255 ) / 255.0f );
+    for ( unsigned i = 0; i < config.buildings; ++i )
+      blocks[ config.objects + i ] = push_object_block( &uniformRing, buildings[ i ], 0.3f );
+    if ( config.occlusion )
+      occlusion_prepare( &occlusion, &uniformRing, &camera, objects, config.objects );
+    ubo_ring_flush( &uniformRing );
+
+    // Occluders first, so that the proxies are tested against them
+    if ( visibleBuildings ) {
+      activate_shader( shaders[ 0 ] );
+      for ( unsigned i = 0; i < config.buildings; ++i ) {
+        if ( !buildings[ i ]->visible )
+          continue;
+        bind_object_block( &uniformRing, blocks[ config.objects + i ] );
+        render_object( buildings[ i ] );
+      }
+    }
+    if ( config.occlusion )
+      occlusion_test( &occlusion, &uniformRing );
+
+    // Objects are grouped by shader, like a renderer sorting by state would
+    uint64_t drawStart = timing_now_ns();
+    unsigned currentShader = config.shaders;
+
+    for ( unsigned i = 0; i < config.objects; ++i ) {
+      if ( !objects[ i ]->visible )
+        continue;
+      if ( config.occlusion && !occlusion_begin_draw( &occlusion, i ) ) {
+        frameSavedTriangles += object_triangle_count( objects[ i ] );
+        continue;
+      }
+      unsigned s = (unsigned) ( (uint64_t) i * config.shaders / config.objects );
+      if ( s != currentShader ) {
+        activate_shader( shaders[ s ] );
+        currentShader = s;
+      }
+      bind_object_block( &uniformRing, blocks[ i ] );
+      render_object( objects[ i ] );
+      frameTriangles += object_triangle_count( objects[ i ] );
+      if ( config.occlusion )
+        occlusion_end_draw( &occlusion );
+    }
+    uint64_t drawEnd = timing_now_ns();
+    ubo_ring_end( &uniformRing );
+
+    uint64_t spriteStart = timing_now_ns();
+    if ( config.sprites ) {
+      sprite_batch_begin( &sprites );
+      for ( unsigned i = 0; i < config.sprites; ++i ) {
+        float x = rand_unit( &seed ) * 2.0f - 1.0f;
+        float y = rand_unit( &seed ) * 2.0f - 1.0f;
+        sprite_rect_t rect = { x - 0.02f, y - 0.02f, 0.04f, 0.04f };
+        sprite_batch_draw( &sprites, tankTexture, rect, frame * 0.01f + i, COLOR_WHITE );
+      }
+      sprite_batch_end( &sprites );
+    }
+
+    uint64_t spriteEnd = timing_now_ns();
+    // Fence every frame so that GPU work can't pile up between frames
+    glFinish();
+    uint64_t frameEnd = timing_now_ns();
+    gl_stats_end_frame();
+
+    if ( frame >= BENCH_WARMUP_FRAMES ) {
+      drawNs += drawEnd - drawStart;
+      cullNs += cullEnd - cullStart;
+      spriteNs += spriteEnd - spriteStart;
+      visibleObjects += visible;
+      visibleDraws += visible - ( config.occlusion ? occlusion.lastSkipped : 0 );
+      occlusionTested += config.occlusion ? occlusion.lastTested : 0;
+      occlusionSkipped += config.occlusion ? occlusion.lastSkipped : 0;
+      occlusionSavedTriangles += frameSavedTriangles;
+      drawnTriangles += frameTriangles;
+      fullTriangles += frameFullTriangles;
+      histogram_record( &frameTimes, frameEnd - frameStart );
+    }
+  }
+
+  double seconds = ( timing_now_ns() - benchStart ) / (double) NS_PER_SEC;
+  // Only what survived culling was drawn, buildings aren't counted
+  double draws = (double) visibleDraws;
+  double triangles = (double) drawnTriangles;
+
+  double drawsPerSec = draws / seconds;
+  double trianglesPerSec = triangles / seconds;
+  double cpuNsPerDraw = draws ? drawNs / draws : 0.0;
+  double visiblePerFrame = visibleObjects / (double) config.frames;
+  double cullMsPerFrame = cullNs / (double) config.frames / NS_PER_MS;
+  double p50 = histogram_percentile( &frameTimes, 50.0 ) / (double) NS_PER_MS;
+  double p99 = histogram_percentile( &frameTimes, 99.0 ) / (double) NS_PER_MS;
+
+  printf( "Draws/sec: %.0f\n", drawsPerSec );
+  printf( "Triangles/sec: %.0f\n", trianglesPerSec );
+  printf( "CPU time per draw: %.1f ns\n", cpuNsPerDraw );
+  printf( "Culling: %.0f of %u objects visible, %.3f ms per frame\n", visiblePerFrame, config.objects, cullMsPerFrame );
+  if ( config.sprites )
+    printf( "Sprites: %u per frame in %u draws, %.3f ms CPU per frame, %.0f sprites/sec\n", config.sprites,
+      sprites.lastDraws, spriteNs / (double) config.frames / NS_PER_MS, (double) config.sprites * config.frames / seconds );
+  if ( config.lods ) {
+    printf( "LOD: %u levels built in %.1f ms, %.1f%% of full detail triangles drawn, draws per level:", objects[ 0 ]->lodCount,
+      lodBuildMs, fullTriangles ? 100.0 * drawnTriangles / fullTriangles : 100.0 );
+    for ( unsigned i = 0; i < objects[ 0 ]->lodCount; ++i )
+      printf( " %.0f (%u tris)", lodDraws[ i ] / (double) config.frames, objects[ 0 ]->lods[ i ].count / 3 );
+    printf( "\n" );
+  }
+  if ( config.occlusion )
+    printf( "Occlusion: %.0f proxies tested, %.0f draws and %.0f triangles skipped per frame\n",
+      occlusionTested / (double) config.frames, occlusionSkipped / (double) config.frames,
+      occlusionSavedTriangles / (double) config.frames );
+  printf( "Frame time: p50 %.3f p99 %.3f max %.3f ms\n", p50, p99, frameTimes.max / (double) NS_PER_MS );
+#ifdef GL_STATS
+  const gl_stats_frame_t *gl = gl_stats_last_frame();
+  printf( "GL per frame: %llu calls, %llu draws, %llu binds, %llu uniforms, %llu state changes\n",
+    gl->calls, gl->draws, gl->binds, gl->uniforms, gl->stateChanges );
+#endif
+
+  if ( config.jsonPath ) {
+    FILE *file = fopen( config.jsonPath, "w" );
+    if ( !file ) {
+      fprintf( stderr, "Could not write results to %s\n", config.jsonPath );
+      return 1;
+    }
+    fprintf( file, "{\n" );
+    fprintf( file, "  \"renderer\": \"%s\",\n", glGetString( GL_RENDERER ) );
+    fprintf( file, "  \"objects\": %u, \"shaders\": %u, \"vertices\": %u, \"frames\": %u, \"width\": %d, \"height\": %d,\n",
+      config.objects, config.shaders, config.vertices, config.frames, config.width, config.height );
+    fprintf( file, "  \"draws_per_sec\": %.1f,\n", drawsPerSec );
+    fprintf( file, "  \"triangles_per_sec\": %.1f,\n", trianglesPerSec );
+    fprintf( file, "  \"cpu_ns_per_draw\": %.2f,\n", cpuNsPerDraw );
+    fprintf( file, "  \"spread\": %.2f, \"visible_per_frame\": %.1f, \"cull_ms_per_frame\": %.4f,\n",
+      config.spread, visiblePerFrame, cullMsPerFrame );
+    fprintf( file, "  \"sprites\": %u, \"sprite_ms_per_frame\": %.4f,\n", config.sprites, spriteNs / (double) config.frames / NS_PER_MS );
+    fprintf( file, "  \"lods\": %u, \"lod_build_ms\": %.2f, \"triangles_per_frame\": %.1f, \"full_detail_triangles_per_frame\": %.1f,\n",
+      config.lods, lodBuildMs, drawnTriangles / (double) config.frames, fullTriangles / (double) config.frames );
+    fprintf( file, "  \"buildings\": %u, \"occlusion\": %d, \"occlusion_tested_per_frame\": %.1f, \"occlusion_skipped_draws_per_frame\": %.1f, \"occlusion_skipped_triangles_per_frame\": %.1f,\n",
+      config.buildings, config.occlusion, occlusionTested / (double) config.frames, occlusionSkipped / (double) config.frames,
+      occlusionSavedTriangles / (double) config.frames );
+    fprintf( file, "  \"frame_ms\": { \"p50\": %.4f, \"p99\": %.4f, \"max\": %.4f }\n", p50, p99, frameTimes.max / (double) NS_PER_MS );
+    fprintf( file, "}\n" );
+    fclose( file );
+  }
+
+  gpu_mem_print( stdout );
+
+  for ( unsigned i = 0; i < config.objects; ++i )
+    destroy_object( objects[ i ] );
+  for ( unsigned i = 0; i < config.buildings; ++i )
+    destroy_object( buildings[ i ] );
+  if ( config.occlusion )
+    occlusion_destroy( &occlusion );
+  bvh_destroy( &bvh );
+  ubo_ring_destroy( &uniformRing );
+  if ( config.sprites ) {
+    sprite_batch_destroy( &sprites );
+    destroy_texture( tankTexture );
+    jobs_shutdown();
+  }
+  for ( unsigned i = 0; i < config.shaders; ++i )
+    destroy_shader( shaders[ i ] );
+  free( objects );
+  free( shaders );
+  free( blocks );
+
+  r_destroy();
+  gpu_mem_report_leaks( stderr );
+
+  return 0;
+}
@@ -1,6 +1,23 @@
 #!/bin/bash
 
-SRCS="lib/glad/src/glad.c main.c"
+SRCS="lib/glad/src/glad.c lib/glad/src/gl_stats.c main.c renderer.c simplify.c frustum.c bvh.c camera.c ubo.c texture.c atlas.c sprite_batch.c tilemap.c gpu_particles.c particles.c ui.c perf_hud.c dynres.c mesh.c mesh_import.c backend_sdl.c backend_egl.c timing.c histogram.c frame_stats.c gpu_timer.c profiler.c gpu_mem.c mem.c image.c capture.c jobs.c video.c"
+BENCH_SRCS="lib/glad/src/glad.c lib/glad/src/gl_stats.c bench.c renderer.c simplify.c frustum.c bvh.c camera.c ubo.c texture.c atlas.c sprite_batch.c occlusion.c backend_egl.c timing.c histogram.c profiler.c gpu_mem.c mem.c image.c jobs.c"
+MICROBENCH_SRCS="lib/glad/src/glad.c lib/glad/src/gl_stats.c microbench.c renderer.c simplify.c frustum.c bvh.c camera.c ubo.c particles.c timing.c profiler.c gpu_mem.c mem.c jobs.c"
 
-gcc $SRCS -std=c99 -Wall -Ilib/glad/include -lSDL2 -lGL -ldl -lm -o learnopengl
+# PROFILE=1 ./build.sh to compile in the trace profiler,
+# GL_STATS=1 ./build.sh to count GL calls through the glad loader
+CFLAGS="-std=c99 -Wall -Ilib/glad/include"
+if [ -n "$PROFILE" ]; then
+  CFLAGS="$CFLAGS -DPROFILE"
+fi
+if [ -n "$GL_STATS" ]; then
+  CFLAGS="$CFLAGS -DGL_STATS"
+fi
 
+gcc $CFLAGS $SRCS -lSDL2 -lEGL -lGL -lpng -lpthread -ldl -lm -o learnopengl
+
+# Offscreen benchmark, needs no display server
+gcc $CFLAGS $BENCH_SRCS -lEGL -lpng -lpthread -ldl -lm -o bench
+
+# CPU-side micro-benchmarks, no GL context needed
+gcc $CFLAGS -O2 $MICROBENCH_SRCS -lpthread -ldl -lm -o microbench
@@ -0,0 +1,309 @@
+#include <stdio.h>
+#include <string.h>
+#include "bvh.h"
+#include "mem.h"
+#include "profiler.h"
+
+#define BVH_INITIAL_CAPACITY 64
+// Deep enough for any tree that rotations keep reasonably balanced
+#define BVH_STACK_SIZE 256
+
+void bvh_init( bvh_t *bvh ) {
+
+  memset( bvh, 0, sizeof( bvh_t ) );
+  bvh->root = BVH_NULL;
+  bvh->freeList = BVH_NULL;
+}
+
+void bvh_destroy( bvh_t *bvh ) {
+
+  mem_free( bvh->nodes );
+  bvh_init( bvh );
+}
+
+static int alloc_node( bvh_t *bvh ) {
+
+  if ( bvh->freeList == BVH_NULL ) {
+    int capacity = bvh->capacity ? bvh->capacity * 2 : BVH_INITIAL_CAPACITY;
+    bvh_node_t *nodes = bvh->nodes ? mem_realloc( MEM_RENDERER, bvh->nodes, capacity * sizeof( bvh_node_t ) ) :
+      mem_alloc( MEM_RENDERER, capacity * sizeof( bvh_node_t ) );
+
+    if ( !nodes ) {
+      fprintf( stderr, "Out of memory for BVH nodes\n" );
+      return BVH_NULL;
+    }
+
+    for ( int i = bvh->capacity; i < capacity; ++i ) {
+      nodes[ i ].child1 = i + 1 < capacity ? i + 1 : BVH_NULL;
+      nodes[ i ].height = -1;
+    }
+
+    bvh->freeList = bvh->capacity;
+    bvh->nodes = nodes;
+    bvh->capacity = capacity;
+  }
+
+  int id = bvh->freeList;
+  bvh_node_t *node = &bvh->nodes[ id ];
+  bvh->freeList = node->child1;
+  node->parent = BVH_NULL;
+  node->child1 = BVH_NULL;
+  node->child2 = BVH_NULL;
+  node->userData = NULL;
+  node->height = 0;
+
+  return id;
+}
+
+static void free_node( bvh_t *bvh, int id ) {
+
+  bvh->nodes[ id ].child1 = bvh->freeList;
+  bvh->nodes[ id ].height = -1;
+  bvh->freeList = id;
+}
+
+static int max_int( int a, int b ) {
+  return a > b ? a : b;
+}
+
+// Rotates the taller grandchild of an unbalanced node A above it, returns
+// the new root of the subtree
+static int balance( bvh_t *bvh, int a ) {
+
+  bvh_node_t *nodes = bvh->nodes;
+  bvh_node_t *A = &nodes[ a ];
+
+  if ( A->height < 2 )
+    return a;
+
+  int b = A->child1;
+  int c = A->child2;
+  int diff = nodes[ c ].height - nodes[ b ].height;
+
+  if ( diff >= -1 && diff <= 1 )
+    return a;
+
+  // Lift the taller child (C) above A, A takes over C's shorter child
+  int up = diff > 1 ? c : b;
+  int other = diff > 1 ? b : c;
+  bvh_node_t *U = &nodes[ up ];
+  int f = U->child1;
+  int g = U->child2;
+
+  U->child1 = a;
+  U->parent = A->parent;
+  A->parent = up;
+
+  if ( U->parent == BVH_NULL )
+    bvh->root = up;
+  else if ( nodes[ U->parent ].child1 == a )
+    nodes[ U->parent ].child1 = up;
+  else
+    nodes[ U->parent ].child2 = up;
+
+  int tall = nodes[ f ].height > nodes[ g ].height ? f : g;
+  int shorter = tall == f ? g : f;
+
+  U->child2 = tall;
+  if ( diff > 1 )
+    A->child2 = shorter;
+  else
+    A->child1 = shorter;
+  nodes[ shorter ].parent = a;
+
+  A->box = aabb_union( nodes[ other ].box, nodes[ shorter ].box );
+  A->height = 1 + max_int( nodes[ other ].height, nodes[ shorter ].height );
+  U->box = aabb_union( A->box, nodes[ tall ].box );
+  U->height = 1 + max_int( A->height, nodes[ tall ].height );
+
+  return up;
+}
+
+// Walks up from a node, refitting boxes and rebalancing
+static void refit( bvh_t *bvh, int id ) {
+
+  while ( id != BVH_NULL ) {
+    id = balance( bvh, id );
+
+    bvh_node_t *node = &bvh->nodes[ id ];
+    const bvh_node_t *child1 = &bvh->nodes[ node->child1 ];
+    const bvh_node_t *child2 = &bvh->nodes[ node->child2 ];
+    node->height = 1 + max_int( child1->height, child2->height );
+    node->box = aabb_union( child1->box, child2->box );
+
+    id = node->parent;
+  }
+}
+
+static void insert_leaf( bvh_t *bvh, int leaf ) {
+
+  if ( bvh->root == BVH_NULL ) {
+    bvh->root = leaf;
+    bvh->nodes[ leaf ].parent = BVH_NULL;
+    return;
+  }
+
+  // Descend towards the sibling with the lowest surface area cost
+  aabb_t box = bvh->nodes[ leaf ].box;
+  int id = bvh->root;
+
+  while ( bvh->nodes[ id ].height > 0 ) {
+    const bvh_node_t *node = &bvh->nodes[ id ];
+    float area = aabb_area( node->box );
+    float combined = aabb_area( aabb_union( node->box, box ) );
+    // Making a new parent here, versus pushing the leaf further down
+    float cost = 2.0f * combined;
+    float inherited = 2.0f * ( combined - area );
+    float childCost[ 2 ];
+    int children[ 2 ] = { node->child1, node->child2 };
+
+    for ( int i = 0; i < 2; ++i ) {
+      const bvh_node_t *child = &bvh->nodes[ children[ i ] ];
+      float grown = aabb_area( aabb_union( child->box, box ) );
+      childCost[ i ] = inherited + ( child->height == 0 ? grown : grown - aabb_area( child->box ) );
+    }
+
+    if ( cost < childCost[ 0 ] && cost < childCost[ 1 ] )
+      break;
+
+    id = childCost[ 0 ] < childCost[ 1 ] ? children[ 0 ] : children[ 1 ];
+  }
+
+  int sibling = id;
+  int oldParent = bvh->nodes[ sibling ].parent;
+  int newParent = alloc_node( bvh );
+  bvh_node_t *nodes = bvh->nodes;
+
+  nodes[ newParent ].parent = oldParent;
+  nodes[ newParent ].child1 = sibling;
+  nodes[ newParent ].child2 = leaf;
+  nodes[ sibling ].parent = newParent;
+  nodes[ leaf ].parent = newParent;
+
+  if ( oldParent == BVH_NULL )
+    bvh->root = newParent;
+  else if ( nodes[ oldParent ].child1 == sibling )
+    nodes[ oldParent ].child1 = newParent;
+  else
+    nodes[ oldParent ].child2 = newParent;
+
+  refit( bvh, newParent );
+}
+
+static void remove_leaf( bvh_t *bvh, int leaf ) {
+
+  bvh_node_t *nodes = bvh->nodes;
+
+  if ( leaf == bvh->root ) {
+    bvh->root = BVH_NULL;
+    return;
+  }
+
+  int parent = nodes[ leaf ].parent;
+  int grandParent = nodes[ parent ].parent;
+  int sibling = nodes[ parent ].child1 == leaf ? nodes[ parent ].child2 : nodes[ parent ].child1;
+
+  // The sibling takes the parent's place
+  nodes[ sibling ].parent = grandParent;
+  free_node( bvh, parent );
+
+  if ( grandParent == BVH_NULL ) {
+    bvh->root = sibling;
+    return;
+  }
+
+  if ( nodes[ grandParent ].child1 == parent )
+    nodes[ grandParent ].child1 = sibling;
+  else
+    nodes[ grandParent ].child2 = sibling;
+
+  refit( bvh, grandParent );
+}
+
+static aabb_t fatten( aabb_t box ) {
+
+  vec3_t margin = { BVH_MARGIN, BVH_MARGIN, BVH_MARGIN };
+
+  return (aabb_t) { { box.min.x - margin.x, box.min.y - margin.y, box.min.z - margin.z },
+    vec3_add( box.max, margin ) };
+}
+
+int bvh_insert( bvh_t *bvh, aabb_t box, void *userData ) {
+
+  int leaf = alloc_node( bvh );
+  if ( leaf == BVH_NULL )
+    return BVH_NULL;
+
+  bvh->nodes[ leaf ].box = fatten( box );
+  bvh->nodes[ leaf ].userData = userData;
+  insert_leaf( bvh, leaf );
+  ++bvh->leafCount;
+
+  return leaf;
+}
+
+void bvh_remove( bvh_t *bvh, int leaf ) {
+
+  remove_leaf( bvh, leaf );
+  free_node( bvh, leaf );
+  --bvh->leafCount;
+}
+
+int bvh_move( bvh_t *bvh, int leaf, aabb_t box ) {
+
+  if ( aabb_contains( bvh->nodes[ leaf ].box, box ) )
+    return 0;
+
+  remove_leaf( bvh, leaf );
+  bvh->nodes[ leaf ].box = fatten( box );
+  insert_leaf( bvh, leaf );
+
+  return 1;
+}
+
+// Visits a whole subtree without testing it against the frustum
+static unsigned visit_all( const bvh_t *bvh, int id, bvh_visit_t visit, void *ctx ) {
+
+  const bvh_node_t *node = &bvh->nodes[ id ];
+
+  if ( node->height == 0 ) {
+    visit( ctx, node->userData );
+    return 1;
+  }
+
+  return visit_all( bvh, node->child1, visit, ctx ) + visit_all( bvh, node->child2, visit, ctx );
+}
+
+unsigned bvh_cull( const bvh_t *bvh, const frustum_t *frustum, bvh_visit_t visit, void *ctx ) {
+
+  if ( bvh->root == BVH_NULL )
+    return 0;
+
+  PROFILE_BEGIN( "bvh_cull" );
+
+  int stack[ BVH_STACK_SIZE ];
+  int top = 0;
+  unsigned visible = 0;
+  stack[ top++ ] = bvh->root;
+
+  while ( top ) {
+    const bvh_node_t *node = &bvh->nodes[ stack[ --top ] ];
+    frustum_result_t result = frustum_test_aabb( frustum, &node->box );
+
+    if ( result == FRUSTUM_OUTSIDE )
+      continue;
+
+    // Running out of stack only costs precision, never correctness
+    if ( result == FRUSTUM_INSIDE || node->height == 0 || top + 2 > BVH_STACK_SIZE ) {
+      visible += visit_all( bvh, (int) ( node - bvh->nodes ), visit, ctx );
+      continue;
+    }
+
+    stack[ top++ ] = node->child1;
+    stack[ top++ ] = node->child2;
+  }
+
+  PROFILE_END();
+
+  return visible;
+}
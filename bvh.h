@@ -0,0 +1,48 @@
+#ifndef BVH_H
+#define BVH_H
+
+#include "linmath.h"
+#include "frustum.h"
+
+/*
+ * Dynamic bounding volume hierarchy over object AABBs. Leaves store boxes
+ * grown by BVH_MARGIN, so that small movements don't touch the tree at all;
+ * bigger ones reinsert the leaf, refitting its ancestors on the way up, and
+ * tree rotations keep it balanced as objects come and go.
+ */
+#define BVH_MARGIN 0.05f
+#define BVH_NULL -1
+
+typedef struct bvh_node {
+  aabb_t box;
+  void *userData;
+  int parent;
+  // Next free node while on the free list
+  int child1;
+  int child2;
+  // Leaves are 0, free nodes -1
+  int height;
+} bvh_node_t;
+
+typedef struct bvh {
+  bvh_node_t *nodes;
+  int capacity;
+  int root;
+  int freeList;
+  unsigned leafCount;
+} bvh_t;
+
+// Called for every leaf that may be visible
+typedef void (*bvh_visit_t)( void *ctx, void *userData );
+
+void bvh_init( bvh_t *bvh );
+void bvh_destroy( bvh_t *bvh );
+// Returns the leaf, or BVH_NULL when out of memory
+int bvh_insert( bvh_t *bvh, aabb_t box, void *userData );
+void bvh_remove( bvh_t *bvh, int leaf );
+// Returns 1 if the leaf had to be reinserted
+int bvh_move( bvh_t *bvh, int leaf, aabb_t box );
+// Visits the leaves inside or intersecting the frustum, returns how many
+unsigned bvh_cull( const bvh_t *bvh, const frustum_t *frustum, bvh_visit_t visit, void *ctx );
+
+#endif
@@ -0,0 +1,41 @@
+#include "camera.h"
+
+static void init( camera_t *camera, vec3_t position, vec3_t target, float near, float far ) {
+
+  camera->position = position;
+  camera->target = target;
+  camera->up = (vec3_t) { 0.0f, 1.0f, 0.0f };
+  camera->near = near;
+  camera->far = far;
+  camera_update( camera, 1.0f );
+}
+
+void camera_init_perspective( camera_t *camera, vec3_t position, vec3_t target, float fovY, float near, float far ) {
+
+  camera->fovY = fovY;
+  camera->orthoHeight = 0.0f;
+  init( camera, position, target, near, far );
+}
+
+void camera_init_ortho( camera_t *camera, vec3_t position, vec3_t target, float height, float near, float far ) {
+
+  camera->fovY = 0.0f;
+  camera->orthoHeight = height;
+  init( camera, position, target, near, far );
+}
+
+void camera_update( camera_t *camera, float aspect ) {
+
+  camera->view = mat4_look_at( camera->position, camera->target, camera->up );
+
+  if ( camera->fovY > 0.0f ) {
+    camera->projection = mat4_perspective( camera->fovY, aspect, camera->near, camera->far );
+  }
+  else {
+    float h = camera->orthoHeight * 0.5f;
+    camera->projection = mat4_ortho( -h * aspect, h * aspect, -h, h, camera->near, camera->far );
+  }
+
+  camera->viewProjection = mat4_mul( &camera->projection, &camera->view );
+  frustum_from_matrix( &camera->frustum, camera->viewProjection.m );
+}
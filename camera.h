@@ -0,0 +1,30 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "linmath.h"
+#include "frustum.h"
+
+typedef struct camera {
+  vec3_t position;
+  vec3_t target;
+  vec3_t up;
+  // Vertical field of view in radians, 0 for an orthographic camera that
+  // sees orthoHeight world units from bottom to top
+  float fovY;
+  float orthoHeight;
+  float near;
+  float far;
+
+  // Derived by camera_update()
+  mat4_t view;
+  mat4_t projection;
+  mat4_t viewProjection;
+  frustum_t frustum;
+} camera_t;
+
+void camera_init_perspective( camera_t *camera, vec3_t position, vec3_t target, float fovY, float near, float far );
+void camera_init_ortho( camera_t *camera, vec3_t position, vec3_t target, float height, float near, float far );
+// Aspect is viewport width / height
+void camera_update( camera_t *camera, float aspect );
+
+#endif
@@ -0,0 +1,208 @@
+// pthreads and nanosleep() are POSIX, which -std=c99 hides by default
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "capture.h"
+#include "gpu_mem.h"
+#include "image.h"
+#include "timing.h"
+#include "profiler.h"
+
+static void* capture_thread( void *arg ) {
+
+  capture_t *capture = arg;
+
+  PROFILE_THREAD_NAME( "capture" );
+
+  pthread_mutex_lock( &capture->lock );
+
+  for ( ;; ) {
+    // capture_update() only ever maps the oldest slot in flight, and waits
+    // for it to be done before moving on, so that's the one to look at. Slots
+    // that failed to map are skipped over without ever reaching this thread.
+    while ( capture->slots[ capture->tail ].state != CAPTURE_MAPPED && !capture->quit )
+      pthread_cond_wait( &capture->cond, &capture->lock );
+
+    if ( capture->slots[ capture->tail ].state != CAPTURE_MAPPED )
+      break;
+
+    capture_slot_t *slot = &capture->slots[ capture->tail ];
+    pthread_mutex_unlock( &capture->lock );
+
+    PROFILE_BEGIN( "capture_sink" );
+    capture->sink( capture->sinkCtx, slot->pixels, slot->width, slot->height, slot->frame );
+    PROFILE_END();
+
+    pthread_mutex_lock( &capture->lock );
+    slot->state = CAPTURE_DONE;
+    pthread_cond_broadcast( &capture->cond );
+  }
+
+  pthread_mutex_unlock( &capture->lock );
+
+  return NULL;
+}
+
+int capture_init( capture_t *capture, capture_sink_t sink, void *sinkCtx ) {
+
+  memset( capture, 0, sizeof( capture_t ) );
+  capture->sink = sink;
+  capture->sinkCtx = sinkCtx;
+
+  for ( unsigned i = 0; i < CAPTURE_RING; ++i )
+    glGenBuffers( 1, &capture->slots[ i ].pbo );
+
+  pthread_mutex_init( &capture->lock, NULL );
+  pthread_cond_init( &capture->cond, NULL );
+
+  if ( pthread_create( &capture->thread, NULL, capture_thread, capture ) != 0 ) {
+    fprintf( stderr, "Could not start capture thread\n" );
+    for ( unsigned i = 0; i < CAPTURE_RING; ++i )
+      glDeleteBuffers( 1, &capture->slots[ i ].pbo );
+    pthread_mutex_destroy( &capture->lock );
+    pthread_cond_destroy( &capture->cond );
+    return 0;
+  }
+
+  return 1;
+}
+
+void capture_read( capture_t *capture, int x, int y, int width, int height, uint64_t frame ) {
+
+  uint64_t start = timing_now_ns();
+  capture_slot_t *slot = &capture->slots[ capture->head ];
+
+  pthread_mutex_lock( &capture->lock );
+  capture_state_t state = slot->state;
+  pthread_mutex_unlock( &capture->lock );
+
+  // Only the render thread moves slots out of FREE, so it stays free
+  if ( state != CAPTURE_FREE ) {
+    ++capture->dropped;
+    capture->renderThreadNs += timing_now_ns() - start;
+    return;
+  }
+
+  size_t size = (size_t) width * height * 4;
+
+  glBindBuffer( GL_PIXEL_PACK_BUFFER, slot->pbo );
+
+  // Only reallocates when the size changes, i.e. on window resizes
+  if ( slot->size != size ) {
+    glBufferData( GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ );
+    gpu_mem_track( GPU_MEM_BUFFER, slot->pbo, size, GL_STREAM_READ, "capture" );
+    slot->size = size;
+  }
+
+  glPixelStorei( GL_PACK_ALIGNMENT, 4 );
+  glReadPixels( x, y, width, height, GL_RGBA, GL_UNSIGNED_BYTE, (void*) 0 );
+  glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+  slot->fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+  slot->width = width;
+  slot->height = height;
+  slot->frame = frame;
+
+  pthread_mutex_lock( &capture->lock );
+  slot->state = CAPTURE_READING;
+  pthread_mutex_unlock( &capture->lock );
+
+  capture->head = ( capture->head + 1 ) % CAPTURE_RING;
+  capture->renderThreadNs += timing_now_ns() - start;
+}
+
+void capture_update( capture_t *capture ) {
+
+  uint64_t start = timing_now_ns();
+
+  pthread_mutex_lock( &capture->lock );
+
+  // Walk from the oldest slot in flight, stopping at the first one that
+  // isn't ready, so that frames reach the sink in order
+  while ( capture->tail != capture->head || capture->slots[ capture->tail ].state != CAPTURE_FREE ) {
+    capture_slot_t *slot = &capture->slots[ capture->tail ];
+
+    if ( slot->state == CAPTURE_READING ) {
+      GLenum status = glClientWaitSync( slot->fence, 0, 0 );
+      if ( status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED )
+        break;
+
+      glDeleteSync( slot->fence );
+      glBindBuffer( GL_PIXEL_PACK_BUFFER, slot->pbo );
+      slot->pixels = glMapBufferRange( GL_PIXEL_PACK_BUFFER, 0, slot->size, GL_MAP_READ_BIT );
+      glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+      if ( !slot->pixels ) {
+        ++capture->dropped;
+        slot->state = CAPTURE_FREE;
+        capture->tail = ( capture->tail + 1 ) % CAPTURE_RING;
+        continue;
+      }
+
+      slot->state = CAPTURE_MAPPED;
+      pthread_cond_broadcast( &capture->cond );
+    }
+
+    if ( slot->state != CAPTURE_DONE )
+      break;
+
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, slot->pbo );
+    glUnmapBuffer( GL_PIXEL_PACK_BUFFER );
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+    slot->pixels = NULL;
+    slot->state = CAPTURE_FREE;
+    ++capture->captured;
+    capture->tail = ( capture->tail + 1 ) % CAPTURE_RING;
+  }
+
+  pthread_mutex_unlock( &capture->lock );
+
+  capture->renderThreadNs += timing_now_ns() - start;
+}
+
+void capture_flush( capture_t *capture ) {
+
+  glFinish();
+
+  for ( ;; ) {
+    capture_update( capture );
+
+    pthread_mutex_lock( &capture->lock );
+    int empty = capture->tail == capture->head && capture->slots[ capture->tail ].state == CAPTURE_FREE;
+    pthread_mutex_unlock( &capture->lock );
+    if ( empty )
+      break;
+
+    // The mapping has to be released on this thread, so poll rather than wait
+    struct timespec ms = { 0, 1000000 };
+    nanosleep( &ms, NULL );
+  }
+}
+
+void capture_destroy( capture_t *capture ) {
+
+  capture_flush( capture );
+
+  pthread_mutex_lock( &capture->lock );
+  capture->quit = 1;
+  pthread_cond_broadcast( &capture->cond );
+  pthread_mutex_unlock( &capture->lock );
+  pthread_join( capture->thread, NULL );
+
+  for ( unsigned i = 0; i < CAPTURE_RING; ++i ) {
+    glDeleteBuffers( 1, &capture->slots[ i ].pbo );
+    gpu_mem_release( GPU_MEM_BUFFER, capture->slots[ i ].pbo );
+  }
+
+  pthread_mutex_destroy( &capture->lock );
+  pthread_cond_destroy( &capture->cond );
+}
+
+void capture_png_sink( void *ctx, const unsigned char *pixels, int width, int height, uint64_t frame ) {
+
+  char path[ 512 ];
+  snprintf( path, sizeof( path ), "%s/capture_%06llu.png", (const char*) ctx, (unsigned long long) frame );
+  image_write_png( path, pixels, width, height, width * 4, 1 );
+}
@@ -0,0 +1,73 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include <glad/glad.h>
+
+/*
+ * Asynchronous frame readback. capture_read() only queues a glReadPixels()
+ * into a pixel pack buffer and drops a fence behind it. A few frames later,
+ * once the fence has signaled, the buffer is mapped and the mapping handed as
+ * is to a worker thread, which runs the sink on it. Nothing on the render
+ * thread ever waits for the GPU or the sink; if the ring is full the frame is
+ * dropped instead.
+ */
+#define CAPTURE_RING 6
+
+// Runs on the capture thread. Pixels are RGBA8 rows, bottom row first.
+typedef void (*capture_sink_t)( void *ctx, const unsigned char *pixels, int width, int height, uint64_t frame );
+
+typedef enum capture_state {
+  CAPTURE_FREE,
+  // glReadPixels() issued, waiting on the fence
+  CAPTURE_READING,
+  // Mapped and queued for the sink
+  CAPTURE_MAPPED,
+  // Sink is done with it, waiting to be unmapped
+  CAPTURE_DONE
+} capture_state_t;
+
+typedef struct capture_slot {
+  unsigned pbo;
+  size_t size;
+  GLsync fence;
+  const unsigned char *pixels;
+  int width;
+  int height;
+  uint64_t frame;
+  capture_state_t state;
+} capture_slot_t;
+
+typedef struct capture {
+  capture_slot_t slots[ CAPTURE_RING ];
+  // Next slot to read into, and the oldest slot still in flight
+  unsigned head;
+  unsigned tail;
+  capture_sink_t sink;
+  void *sinkCtx;
+
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  int quit;
+
+  uint64_t captured;
+  uint64_t dropped;
+  // Time spent in capture_* calls on the render thread
+  uint64_t renderThreadNs;
+} capture_t;
+
+int capture_init( capture_t *capture, capture_sink_t sink, void *sinkCtx );
+// Reads the given rectangle of the currently bound read framebuffer
+void capture_read( capture_t *capture, int x, int y, int width, int height, uint64_t frame );
+// Call once per frame, hands finished readbacks to the sink and recycles buffers
+void capture_update( capture_t *capture );
+// Waits for everything in flight to reach the sink, e.g. before exiting
+void capture_flush( capture_t *capture );
+void capture_destroy( capture_t *capture );
+
+// Sink that writes capture_<frame>.png files, ctx is the directory
+void capture_png_sink( void *ctx, const unsigned char *pixels, int width, int height, uint64_t frame );
+
+#endif
@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <glad/glad.h>
+#include "dynres.h"
+#include "gpu_mem.h"
+
+// Aim under the budget, so that a spike doesn't blow it right away
+#define DYNRES_HEADROOM 0.85f
+// How much of the measured error is corrected at once. The measurements lag
+// a few frames behind the scale they were taken at, so correcting all of it
+// would overshoot.
+#define DYNRES_GAIN 0.5f
+// Errors below this leave the scale alone, so that it settles
+#define DYNRES_DEADBAND 0.1f
+#define DYNRES_SMOOTHING 0.3f
+#define DYNRES_ALIGN 8
+
+static int scaled_size( int size, float scale ) {
+
+  int scaled = (int) ( size * scale ) / DYNRES_ALIGN * DYNRES_ALIGN;
+
+  return scaled < DYNRES_ALIGN ? ( size < DYNRES_ALIGN ? size : DYNRES_ALIGN ) : scaled > size ? size : scaled;
+}
+
+static void apply_scale( dynres_t *dynres, float scale ) {
+
+  scale = scale < DYNRES_MIN_SCALE ? DYNRES_MIN_SCALE : scale > DYNRES_MAX_SCALE ? DYNRES_MAX_SCALE : scale;
+
+  int renderWidth = scaled_size( dynres->width, scale );
+  int renderHeight = scaled_size( dynres->height, scale );
+  if ( renderWidth != dynres->renderWidth || renderHeight != dynres->renderHeight )
+    ++dynres->scaleChanges;
+
+  dynres->scale = scale;
+  dynres->renderWidth = renderWidth;
+  dynres->renderHeight = renderHeight;
+}
+
+int dynres_init( dynres_t *dynres, int width, int height, float budgetMs ) {
+
+  memset( dynres, 0, sizeof( dynres_t ) );
+  dynres->budgetMs = budgetMs;
+  dynres->enabled = 1;
+  dynres->scale = DYNRES_MAX_SCALE;
+
+  glGenFramebuffers( 1, &dynres->fbo );
+  glGenRenderbuffers( 1, &dynres->colorRbo );
+  dynres_resize( dynres, width, height );
+
+  glBindFramebuffer( GL_FRAMEBUFFER, dynres->fbo );
+  int complete = glCheckFramebufferStatus( GL_FRAMEBUFFER ) == GL_FRAMEBUFFER_COMPLETE;
+  glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+
+  if ( !complete ) {
+    fprintf( stderr, "Dynamic resolution framebuffer is incomplete\n" );
+    dynres_destroy( dynres );
+    return 0;
+  }
+
+  dynres->scaleChanges = 0;
+
+  return 1;
+}
+
+void dynres_destroy( dynres_t *dynres ) {
+
+  glDeleteFramebuffers( 1, &dynres->fbo );
+  glDeleteRenderbuffers( 1, &dynres->colorRbo );
+  gpu_mem_release( GPU_MEM_RENDERBUFFER, dynres->colorRbo );
+  memset( dynres, 0, sizeof( dynres_t ) );
+}
+
+void dynres_resize( dynres_t *dynres, int width, int height ) {
+
+  dynres->width = width > 1 ? width : 1;
+  dynres->height = height > 1 ? height : 1;
+
+  glBindRenderbuffer( GL_RENDERBUFFER, dynres->colorRbo );
+  glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, dynres->width, dynres->height );
+  gpu_mem_track( GPU_MEM_RENDERBUFFER, dynres->colorRbo, (size_t) dynres->width * dynres->height * 4, GL_RGBA8, "dynres" );
+  glBindRenderbuffer( GL_RENDERBUFFER, 0 );
+
+  glBindFramebuffer( GL_FRAMEBUFFER, dynres->fbo );
+  glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, dynres->colorRbo );
+  glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+
+  apply_scale( dynres, dynres->enabled ? dynres->scale : DYNRES_MAX_SCALE );
+}
+
+void dynres_update( dynres_t *dynres, float gpuMs ) {
+
+  if ( gpuMs <= 0.0f )
+    return;
+
+  dynres->gpuMs = dynres->gpuMs > 0.0f ? dynres->gpuMs + ( gpuMs - dynres->gpuMs ) * DYNRES_SMOOTHING : gpuMs;
+  if ( !dynres->enabled )
+    return;
+
+  float ratio = dynres->budgetMs * DYNRES_HEADROOM / dynres->gpuMs;
+  if ( fabsf( ratio - 1.0f ) < DYNRES_DEADBAND )
+    return;
+
+  // GPU time goes roughly with the pixel count, the square of the scale
+  apply_scale( dynres, dynres->scale * powf( ratio, 0.5f * DYNRES_GAIN ) );
+}
+
+void dynres_set_enabled( dynres_t *dynres, int enabled ) {
+
+  dynres->enabled = enabled;
+  if ( !enabled )
+    apply_scale( dynres, DYNRES_MAX_SCALE );
+}
+
+void dynres_begin( dynres_t *dynres ) {
+
+  glBindFramebuffer( GL_FRAMEBUFFER, dynres->fbo );
+  glViewport( 0, 0, dynres->renderWidth, dynres->renderHeight );
+}
+
+void dynres_end( dynres_t *dynres, unsigned framebuffer, int x, int y ) {
+
+  glBindFramebuffer( GL_READ_FRAMEBUFFER, dynres->fbo );
+  glBindFramebuffer( GL_DRAW_FRAMEBUFFER, framebuffer );
+  // Linear, and nearest when there's nothing to scale
+  int full = dynres->renderWidth == dynres->width && dynres->renderHeight == dynres->height;
+  glBlitFramebuffer( 0, 0, dynres->renderWidth, dynres->renderHeight,
+    x, y, x + dynres->width, y + dynres->height, GL_COLOR_BUFFER_BIT, full ? GL_NEAREST : GL_LINEAR );
+
+  glBindFramebuffer( GL_FRAMEBUFFER, framebuffer );
+  glViewport( x, y, dynres->width, dynres->height );
+}
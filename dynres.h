@@ -0,0 +1,45 @@
+#ifndef DYNRES_H
+#define DYNRES_H
+
+/*
+ * Dynamic resolution. The scene renders into an offscreen framebuffer at a
+ * fraction of the output size, picked from the measured GPU frame time
+ * against a budget, and is then blitted up into the output. The target is
+ * allocated at full size and only a corner of it is rendered to, so changing
+ * the scale never reallocates anything.
+ */
+#define DYNRES_MIN_SCALE 0.5f
+#define DYNRES_MAX_SCALE 1.0f
+
+typedef struct dynres {
+  unsigned fbo;
+  unsigned colorRbo;
+  // The output size the target is allocated at
+  int width;
+  int height;
+  // What the scene is rendered at this frame, a multiple of 8 pixels
+  int renderWidth;
+  int renderHeight;
+  float scale;
+  float budgetMs;
+  // Smoothed GPU frame time the scale was last picked from
+  float gpuMs;
+  // Zero pins the scale at DYNRES_MAX_SCALE
+  int enabled;
+  unsigned long long scaleChanges;
+} dynres_t;
+
+int dynres_init( dynres_t *dynres, int width, int height, float budgetMs );
+void dynres_destroy( dynres_t *dynres );
+// Reallocates the target for a new output size
+void dynres_resize( dynres_t *dynres, int width, int height );
+// Feeds a new GPU frame time measurement and picks the next scale
+void dynres_update( dynres_t *dynres, float gpuMs );
+void dynres_set_enabled( dynres_t *dynres, int enabled );
+// Binds the target with the viewport set to the scaled size
+void dynres_begin( dynres_t *dynres );
+// Scales the image up into the given rectangle of the framebuffer, which is
+// left bound with its viewport set to that rectangle
+void dynres_end( dynres_t *dynres, unsigned framebuffer, int x, int y );
+
+#endif
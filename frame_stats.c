@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <string.h>
+#include "frame_stats.h"
+#include "timing.h"
+
+#define MS( ns ) ( (double) ( ns ) / (double) NS_PER_MS )
+
+static const double percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+static const char * const percentileNames[] = { "p50", "p90", "p99", "p99.9" };
+#define N_PERCENTILES ( sizeof( percentiles ) / sizeof( percentiles[ 0 ] ) )
+
+void frame_stats_init( frame_stats_t *stats, double budget_ms ) {
+
+  stats->budget_ns = (uint64_t) ( budget_ms * NS_PER_MS );
+  stats->last_present_ns = 0;
+  memset( stats->recent_interval_ms, 0, sizeof( stats->recent_interval_ms ) );
+  memset( stats->recent_cpu_ms, 0, sizeof( stats->recent_cpu_ms ) );
+  memset( stats->recent_tick_ms, 0, sizeof( stats->recent_tick_ms ) );
+  stats->recent_next = 0;
+  stats->pending_tick_ns = 0;
+  frame_stats_reset( stats );
+}
+
+void frame_stats_reset( frame_stats_t *stats ) {
+
+  histogram_reset( &stats->cpu );
+  histogram_reset( &stats->interval );
+  stats->frames = 0;
+  stats->cpu_over_budget = 0;
+  stats->interval_over_budget = 0;
+  stats->visible = 0;
+  stats->culled = 0;
+  stats->resize_events = 0;
+  stats->resizes = 0;
+  stats->resize_ns = 0;
+  stats->resize_max_ns = 0;
+}
+
+void frame_stats_record( frame_stats_t *stats, uint64_t cpu_ns, uint64_t present_ns ) {
+
+  histogram_record( &stats->cpu, cpu_ns );
+  if ( cpu_ns > stats->budget_ns )
+    ++stats->cpu_over_budget;
+
+  // The very first frame has nothing to measure the interval against
+  uint64_t interval = 0;
+  if ( stats->last_present_ns ) {
+    interval = present_ns - stats->last_present_ns;
+    histogram_record( &stats->interval, interval );
+    if ( interval > stats->budget_ns )
+      ++stats->interval_over_budget;
+  }
+
+  stats->recent_interval_ms[ stats->recent_next ] = (float) MS( interval );
+  stats->recent_cpu_ms[ stats->recent_next ] = (float) MS( cpu_ns );
+  stats->recent_tick_ms[ stats->recent_next ] = (float) MS( stats->pending_tick_ns );
+  stats->recent_next = ( stats->recent_next + 1 ) % FRAME_STATS_RECENT;
+  stats->pending_tick_ns = 0;
+
+  stats->last_present_ns = present_ns;
+  ++stats->frames;
+}
+
+void frame_stats_record_tick( frame_stats_t *stats, uint64_t tick_ns ) {
+  stats->pending_tick_ns += tick_ns;
+}
+
+void frame_stats_record_culling( frame_stats_t *stats, unsigned visible, unsigned culled ) {
+
+  stats->visible += visible;
+  stats->culled += culled;
+}
+
+void frame_stats_record_resize( frame_stats_t *stats, unsigned events, int resized, uint64_t resize_ns ) {
+
+  stats->resize_events += events;
+  if ( !resized )
+    return;
+
+  ++stats->resizes;
+  stats->resize_ns += resize_ns;
+  if ( resize_ns > stats->resize_max_ns )
+    stats->resize_max_ns = resize_ns;
+}
+
+// Per frame averages
+static double per_frame( const frame_stats_t *stats, uint64_t total ) {
+  return stats->frames ? (double) total / (double) stats->frames : 0.0;
+}
+
+static void print_histogram( const char *name, const histogram_t *h, FILE *out ) {
+
+  fprintf( out, "  %-9s", name );
+
+  for ( unsigned i = 0; i < N_PERCENTILES; ++i )
+    fprintf( out, " %s %7.3f", percentileNames[ i ], MS( histogram_percentile( h, percentiles[ i ] ) ) );
+
+  fprintf( out, " max %7.3f mean %7.3f ms\n", MS( h->max ), histogram_mean( h ) / NS_PER_MS );
+}
+
+void frame_stats_print( const frame_stats_t *stats, FILE *out ) {
+
+  fprintf( out, "Frames: %llu, budget %.3f ms, over budget: %llu cpu, %llu interval\n",
+    (unsigned long long) stats->frames, MS( stats->budget_ns ),
+    (unsigned long long) stats->cpu_over_budget,
+    (unsigned long long) stats->interval_over_budget );
+  print_histogram( "cpu", &stats->cpu, out );
+  print_histogram( "interval", &stats->interval, out );
+  fprintf( out, "  objects   %.1f visible, %.1f culled per frame\n",
+    per_frame( stats, stats->visible ), per_frame( stats, stats->culled ) );
+  if ( stats->resize_events )
+    fprintf( out, "  resizes   %llu from %llu events, %.3f ms total, max %.3f ms\n",
+      (unsigned long long) stats->resizes, (unsigned long long) stats->resize_events,
+      MS( stats->resize_ns ), MS( stats->resize_max_ns ) );
+}
+
+static void write_json_histogram( const char *name, const histogram_t *h, FILE *file ) {
+
+  fprintf( file, "  \"%s_ms\": {", name );
+
+  for ( unsigned i = 0; i < N_PERCENTILES; ++i )
+    fprintf( file, " \"%s\": %.4f,", percentileNames[ i ], MS( histogram_percentile( h, percentiles[ i ] ) ) );
+
+  fprintf( file, " \"max\": %.4f, \"mean\": %.4f, \"count\": %llu }",
+    MS( h->max ), histogram_mean( h ) / NS_PER_MS, (unsigned long long) h->total );
+}
+
+int frame_stats_write_json( const frame_stats_t *stats, const char *path ) {
+
+  FILE *file = fopen( path, "w" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write frame stats to %s\n", path );
+    return 0;
+  }
+
+  fprintf( file, "{\n" );
+  fprintf( file, "  \"frames\": %llu,\n", (unsigned long long) stats->frames );
+  fprintf( file, "  \"budget_ms\": %.4f,\n", MS( stats->budget_ns ) );
+  fprintf( file, "  \"cpu_over_budget\": %llu,\n", (unsigned long long) stats->cpu_over_budget );
+  fprintf( file, "  \"interval_over_budget\": %llu,\n", (unsigned long long) stats->interval_over_budget );
+  fprintf( file, "  \"visible_per_frame\": %.2f,\n", per_frame( stats, stats->visible ) );
+  fprintf( file, "  \"culled_per_frame\": %.2f,\n", per_frame( stats, stats->culled ) );
+  fprintf( file, "  \"resize_events\": %llu, \"resizes\": %llu, \"resize_ms\": %.4f, \"resize_max_ms\": %.4f,\n",
+    (unsigned long long) stats->resize_events, (unsigned long long) stats->resizes,
+    MS( stats->resize_ns ), MS( stats->resize_max_ns ) );
+  write_json_histogram( "cpu", &stats->cpu, file );
+  fprintf( file, ",\n" );
+  write_json_histogram( "interval", &stats->interval, file );
+  fprintf( file, "\n}\n" );
+
+  return fclose( file ) == 0;
+}
+
+static void write_csv_histogram( const char *name, const histogram_t *h, FILE *file ) {
+
+  uint64_t seen = 0;
+
+  for ( unsigned i = 0; i < HISTOGRAM_BUCKETS; ++i ) {
+    if ( !h->counts[ i ] )
+      continue;
+    seen += h->counts[ i ];
+    fprintf( file, "%s,%.4f,%.4f,%u,%.6f\n", name,
+      MS( histogram_bucket_lowest( i ) ), MS( histogram_bucket_highest( i ) ),
+      h->counts[ i ], (double) seen / (double) h->total );
+  }
+}
+
+int frame_stats_write_csv( const frame_stats_t *stats, const char *path ) {
+
+  FILE *file = fopen( path, "w" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write frame stats to %s\n", path );
+    return 0;
+  }
+
+  fprintf( file, "metric,from_ms,to_ms,count,cumulative\n" );
+  write_csv_histogram( "cpu", &stats->cpu, file );
+  write_csv_histogram( "interval", &stats->interval, file );
+
+  return fclose( file ) == 0;
+}
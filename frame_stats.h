@@ -0,0 +1,57 @@
+#ifndef FRAME_STATS_H
+#define FRAME_STATS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "histogram.h"
+
+// Frames kept for live graphs
+#define FRAME_STATS_RECENT 256
+
+typedef struct frame_stats {
+  // CPU time spent on a frame, from the start of the loop iteration until
+  // right before the buffer swap (which blocks on vsync)
+  histogram_t cpu;
+  // Time between consecutive buffer swaps, i.e. what the player sees
+  histogram_t interval;
+  uint64_t budget_ns;
+  uint64_t frames;
+  uint64_t cpu_over_budget;
+  uint64_t interval_over_budget;
+  uint64_t last_present_ns;
+  // Objects that went to the draw path or were culled, summed over frames
+  uint64_t visible;
+  uint64_t culled;
+  // Window resize events, the reallocations they were coalesced into and
+  // what those cost on the CPU
+  uint64_t resize_events;
+  uint64_t resizes;
+  uint64_t resize_ns;
+  uint64_t resize_max_ns;
+  // Ring of the most recent frames in milliseconds, recent_next is the
+  // oldest. Unlike the rest, it survives frame_stats_reset().
+  float recent_interval_ms[ FRAME_STATS_RECENT ];
+  float recent_cpu_ms[ FRAME_STATS_RECENT ];
+  float recent_tick_ms[ FRAME_STATS_RECENT ];
+  unsigned recent_next;
+  // Game ticks run so far this frame
+  uint64_t pending_tick_ns;
+} frame_stats_t;
+
+void frame_stats_init( frame_stats_t *stats, double budget_ms );
+// Forget all samples but keep the budget and the last present time, so that
+// the next interval is still measured correctly
+void frame_stats_reset( frame_stats_t *stats );
+void frame_stats_record( frame_stats_t *stats, uint64_t cpu_ns, uint64_t present_ns );
+// Time spent in game ticks, goes with the next frame_stats_record()
+void frame_stats_record_tick( frame_stats_t *stats, uint64_t tick_ns );
+void frame_stats_record_culling( frame_stats_t *stats, unsigned visible, unsigned culled );
+// A frame's resize events and, if the size changed, the reallocation
+void frame_stats_record_resize( frame_stats_t *stats, unsigned events, int resized, uint64_t resize_ns );
+
+void frame_stats_print( const frame_stats_t *stats, FILE *out );
+int frame_stats_write_json( const frame_stats_t *stats, const char *path );
+// One row per non-empty histogram bucket, for plotting the whole distribution
+int frame_stats_write_csv( const frame_stats_t *stats, const char *path );
+
+#endif
@@ -0,0 +1,79 @@
+#include "frustum.h"
+#ifdef __SSE2__
+#include <emmintrin.h>
+#else
+#include <math.h>
+#endif
+
+void frustum_from_matrix( frustum_t *frustum, const float *m ) {
+
+  // Gribb & Hartmann: each plane is the last row of the matrix plus or minus
+  // one of the others. Not normalized, the tests only compare signs.
+  for ( int i = 0; i < FRUSTUM_PLANES; ++i ) {
+    int row = i / 2;
+    float sign = i % 2 ? -1.0f : 1.0f;
+    frustum->nx[ i ] = m[ 3 ] + sign * m[ row ];
+    frustum->ny[ i ] = m[ 7 ] + sign * m[ 4 + row ];
+    frustum->nz[ i ] = m[ 11 ] + sign * m[ 8 + row ];
+    frustum->d[ i ] = m[ 15 ] + sign * m[ 12 + row ];
+  }
+
+  for ( int i = FRUSTUM_PLANES; i < FRUSTUM_LANES; ++i ) {
+    frustum->nx[ i ] = frustum->nx[ 0 ];
+    frustum->ny[ i ] = frustum->ny[ 0 ];
+    frustum->nz[ i ] = frustum->nz[ 0 ];
+    frustum->d[ i ] = frustum->d[ 0 ];
+  }
+}
+
+frustum_result_t frustum_test_aabb( const frustum_t *frustum, const aabb_t *box ) {
+
+  // Center and half extents: the box reaches r = |n| . e towards the plane
+  // from its center, so it's outside when n . c + d < -r and inside when
+  // n . c + d >= r
+  float cx = ( box->min.x + box->max.x ) * 0.5f;
+  float cy = ( box->min.y + box->max.y ) * 0.5f;
+  float cz = ( box->min.z + box->max.z ) * 0.5f;
+  float ex = ( box->max.x - box->min.x ) * 0.5f;
+  float ey = ( box->max.y - box->min.y ) * 0.5f;
+  float ez = ( box->max.z - box->min.z ) * 0.5f;
+
+#ifdef __SSE2__
+  const __m128 absMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7fffffff ) );
+  __m128 vcx = _mm_set1_ps( cx ), vcy = _mm_set1_ps( cy ), vcz = _mm_set1_ps( cz );
+  __m128 vex = _mm_set1_ps( ex ), vey = _mm_set1_ps( ey ), vez = _mm_set1_ps( ez );
+  int outside = 0;
+  int inside = 0;
+
+  for ( int i = 0; i < FRUSTUM_LANES; i += 4 ) {
+    __m128 nx = _mm_load_ps( frustum->nx + i );
+    __m128 ny = _mm_load_ps( frustum->ny + i );
+    __m128 nz = _mm_load_ps( frustum->nz + i );
+    __m128 dist = _mm_add_ps( _mm_add_ps( _mm_mul_ps( nx, vcx ), _mm_mul_ps( ny, vcy ) ),
+      _mm_add_ps( _mm_mul_ps( nz, vcz ), _mm_load_ps( frustum->d + i ) ) );
+    __m128 r = _mm_add_ps( _mm_add_ps( _mm_mul_ps( _mm_and_ps( nx, absMask ), vex ), _mm_mul_ps( _mm_and_ps( ny, absMask ), vey ) ),
+      _mm_mul_ps( _mm_and_ps( nz, absMask ), vez ) );
+    outside |= _mm_movemask_ps( _mm_cmplt_ps( _mm_add_ps( dist, r ), _mm_setzero_ps() ) ) << i;
+    inside |= _mm_movemask_ps( _mm_cmpge_ps( _mm_sub_ps( dist, r ), _mm_setzero_ps() ) ) << i;
+  }
+
+  if ( outside )
+    return FRUSTUM_OUTSIDE;
+
+  // The padding lanes duplicate plane 0, so all eight bits count
+  return inside == ( 1 << FRUSTUM_LANES ) - 1 ? FRUSTUM_INSIDE : FRUSTUM_INTERSECTS;
+#else
+  frustum_result_t result = FRUSTUM_INSIDE;
+
+  for ( int i = 0; i < FRUSTUM_PLANES; ++i ) {
+    float dist = frustum->nx[ i ] * cx + frustum->ny[ i ] * cy + frustum->nz[ i ] * cz + frustum->d[ i ];
+    float r = fabsf( frustum->nx[ i ] ) * ex + fabsf( frustum->ny[ i ] ) * ey + fabsf( frustum->nz[ i ] ) * ez;
+    if ( dist + r < 0.0f )
+      return FRUSTUM_OUTSIDE;
+    if ( dist - r < 0.0f )
+      result = FRUSTUM_INTERSECTS;
+  }
+
+  return result;
+#endif
+}
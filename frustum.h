@@ -0,0 +1,30 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "linmath.h"
+
+#define FRUSTUM_PLANES 6
+// Padded to two SIMD batches of four, the spare lanes repeat plane 0
+#define FRUSTUM_LANES 8
+
+typedef enum frustum_result {
+  FRUSTUM_OUTSIDE,
+  FRUSTUM_INTERSECTS,
+  FRUSTUM_INSIDE
+} frustum_result_t;
+
+// Planes as structure of arrays, a point p is inside plane i when
+// nx[i] * p.x + ny[i] * p.y + nz[i] * p.z + d[i] >= 0
+typedef struct frustum {
+  _Alignas( 16 ) float nx[ FRUSTUM_LANES ];
+  _Alignas( 16 ) float ny[ FRUSTUM_LANES ];
+  _Alignas( 16 ) float nz[ FRUSTUM_LANES ];
+  _Alignas( 16 ) float d[ FRUSTUM_LANES ];
+} frustum_t;
+
+// Extracts the clip planes of a column-major view-projection matrix, so
+// that an identity matrix gives the -1..1 clip cube
+void frustum_from_matrix( frustum_t *frustum, const float *m );
+frustum_result_t frustum_test_aabb( const frustum_t *frustum, const aabb_t *box );
+
+#endif
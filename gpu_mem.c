@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <string.h>
+#include "gpu_mem.h"
+
+typedef struct gpu_allocation {
+  gpu_mem_kind_t kind;
+  unsigned id;
+  size_t bytes;
+  unsigned usage;
+  const char *owner;
+} gpu_allocation_t;
+
+static const char * const kindNames[ GPU_MEM_KINDS ] = { "buffer", "texture", "renderbuffer" };
+
+// Allocations are rare, so a plain array is fine
+static gpu_allocation_t *allocations;
+static unsigned count;
+static unsigned capacity;
+
+static size_t kindBytes[ GPU_MEM_KINDS ];
+static size_t liveBytes;
+static size_t peakBytes;
+
+static gpu_allocation_t* find( gpu_mem_kind_t kind, unsigned id ) {
+
+  for ( unsigned i = 0; i < count; ++i ) {
+    if ( allocations[ i ].kind == kind && allocations[ i ].id == id )
+      return &allocations[ i ];
+  }
+
+  return NULL;
+}
+
+void gpu_mem_track( gpu_mem_kind_t kind, unsigned id, size_t bytes, unsigned usage, const char *owner ) {
+
+  gpu_allocation_t *a = find( kind, id );
+
+  if ( !a ) {
+    if ( count == capacity ) {
+      unsigned newCapacity = capacity ? capacity * 2 : 64;
+      gpu_allocation_t *grown = realloc( allocations, newCapacity * sizeof( gpu_allocation_t ) );
+      if ( !grown ) {
+        fprintf( stderr, "Out of memory tracking GPU allocations\n" );
+        return;
+      }
+      allocations = grown;
+      capacity = newCapacity;
+    }
+
+    a = &allocations[ count++ ];
+    a->kind = kind;
+    a->id = id;
+    a->bytes = 0;
+  }
+
+  kindBytes[ kind ] += bytes - a->bytes;
+  liveBytes += bytes - a->bytes;
+  if ( liveBytes > peakBytes )
+    peakBytes = liveBytes;
+
+  a->bytes = bytes;
+  a->usage = usage;
+  a->owner = owner;
+}
+
+void gpu_mem_release( gpu_mem_kind_t kind, unsigned id ) {
+
+  gpu_allocation_t *a = find( kind, id );
+  if ( !a )
+    return;
+
+  kindBytes[ kind ] -= a->bytes;
+  liveBytes -= a->bytes;
+  *a = allocations[ --count ];
+}
+
+size_t gpu_mem_live_bytes() {
+  return liveBytes;
+}
+
+size_t gpu_mem_peak_bytes() {
+  return peakBytes;
+}
+
+size_t gpu_mem_kind_bytes( gpu_mem_kind_t kind ) {
+  return kindBytes[ kind ];
+}
+
+void gpu_mem_print( FILE *out ) {
+
+  fprintf( out, "GPU memory: %zu KiB live, %zu KiB peak (", liveBytes / 1024, peakBytes / 1024 );
+  for ( unsigned k = 0; k < GPU_MEM_KINDS; ++k )
+    fprintf( out, "%s%s %zu KiB", k ? ", " : "", kindNames[ k ], kindBytes[ k ] / 1024 );
+  fprintf( out, ")\n" );
+
+  // Sum up per owner, visiting each distinct owner once
+  for ( unsigned i = 0; i < count; ++i ) {
+    const char *owner = allocations[ i ].owner;
+    int seen = 0;
+    for ( unsigned j = 0; j < i && !seen; ++j )
+      seen = !strcmp( allocations[ j ].owner, owner );
+    if ( seen )
+      continue;
+
+    size_t bytes = 0;
+    unsigned n = 0;
+    for ( unsigned j = i; j < count; ++j ) {
+      if ( !strcmp( allocations[ j ].owner, owner ) ) {
+        bytes += allocations[ j ].bytes;
+        ++n;
+      }
+    }
+    fprintf( out, "  %-16s %8zu KiB in %u allocations\n", owner, bytes / 1024, n );
+  }
+}
+
+unsigned gpu_mem_report_leaks( FILE *out ) {
+
+  for ( unsigned i = 0; i < count; ++i ) {
+    const gpu_allocation_t *a = &allocations[ i ];
+    fprintf( out, "GPU leak: %s %u, %zu bytes, usage 0x%x, owned by %s\n",
+      kindNames[ a->kind ], a->id, a->bytes, a->usage, a->owner );
+  }
+
+  return count;
+}
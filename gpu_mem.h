@@ -0,0 +1,34 @@
+#ifndef GPU_MEM_H
+#define GPU_MEM_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/*
+ * Registry of GPU allocations. Whoever creates a buffer, texture or
+ * renderbuffer reports it here along with its size, so that we know how much
+ * VRAM is in use, by whom, and what was never freed.
+ */
+typedef enum gpu_mem_kind {
+  GPU_MEM_BUFFER,
+  GPU_MEM_TEXTURE,
+  GPU_MEM_RENDERBUFFER,
+  GPU_MEM_KINDS
+} gpu_mem_kind_t;
+
+// Tracking an id that is already tracked updates its size, like re-specifying
+// a buffer's storage with glBufferData does. owner is the subsystem that made
+// the allocation and must outlive the registry (use string literals).
+void gpu_mem_track( gpu_mem_kind_t kind, unsigned id, size_t bytes, unsigned usage, const char *owner );
+void gpu_mem_release( gpu_mem_kind_t kind, unsigned id );
+
+size_t gpu_mem_live_bytes();
+size_t gpu_mem_peak_bytes();
+size_t gpu_mem_kind_bytes( gpu_mem_kind_t kind );
+
+// Live totals per kind and per owner
+void gpu_mem_print( FILE *out );
+// Lists everything still alive, returns how many allocations that was
+unsigned gpu_mem_report_leaks( FILE *out );
+
+#endif
@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <glad/glad.h>
+#include "gpu_particles.h"
+#include "gpu_mem.h"
+#include "mem.h"
+#include "profiler.h"
+
+static void setup_attributes() {
+
+  glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, sizeof( gpu_particle_t ), (void*) offsetof( gpu_particle_t, position ) );
+  glEnableVertexAttribArray( 0 );
+  glVertexAttribPointer( 1, 2, GL_FLOAT, GL_FALSE, sizeof( gpu_particle_t ), (void*) offsetof( gpu_particle_t, velocity ) );
+  glEnableVertexAttribArray( 1 );
+  glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, sizeof( gpu_particle_t ), (void*) offsetof( gpu_particle_t, age ) );
+  glEnableVertexAttribArray( 2 );
+}
+
+int gpu_particles_init( gpu_particles_t *particles, unsigned capacity ) {
+
+  static const char * const varyings[] = { "outPosition", "outVelocity", "outAgeLife" };
+
+  memset( particles, 0, sizeof( gpu_particles_t ) );
+  particles->capacity = capacity;
+  particles->spawns = mem_alloc( MEM_RENDERER, GPU_PARTICLES_SPAWN_MAX * sizeof( gpu_particle_t ) );
+  // Every slot starts out dead
+  gpu_particle_t *dead = mem_calloc( MEM_SCRATCH, capacity, sizeof( gpu_particle_t ) );
+
+  if ( !particles->spawns || !dead ) {
+    fprintf( stderr, "Out of memory for %u particles\n", capacity );
+    mem_free( dead );
+    return 0;
+  }
+
+  particles->update = create_feedback_shader( "particle_update.vert", varyings, sizeof( varyings ) / sizeof( varyings[ 0 ] ) );
+  particles->draw = create_shader( "particle.vert", "particle.frag" );
+  if ( !particles->update || !particles->draw ) {
+    mem_free( dead );
+    return 0;
+  }
+
+  size_t bytes = (size_t) capacity * sizeof( gpu_particle_t );
+  glGenBuffers( 2, particles->buffers );
+  glGenVertexArrays( 2, particles->vaos );
+  for ( int i = 0; i < 2; ++i ) {
+    glBindVertexArray( particles->vaos[ i ] );
+    glBindBuffer( GL_ARRAY_BUFFER, particles->buffers[ i ] );
+    // Written by the GPU, read back by the GPU
+    glBufferData( GL_ARRAY_BUFFER, bytes, dead, GL_DYNAMIC_COPY );
+    gpu_mem_track( GPU_MEM_BUFFER, particles->buffers[ i ], bytes, GL_DYNAMIC_COPY, "particles" );
+    setup_attributes();
+  }
+  glBindVertexArray( 0 );
+  mem_free( dead );
+
+  glGenBuffers( 1, &particles->spawnBuffer );
+  glBindBuffer( GL_COPY_READ_BUFFER, particles->spawnBuffer );
+  glBufferData( GL_COPY_READ_BUFFER, GPU_PARTICLES_SPAWN_MAX * sizeof( gpu_particle_t ), NULL, GL_STREAM_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, particles->spawnBuffer, GPU_PARTICLES_SPAWN_MAX * sizeof( gpu_particle_t ), GL_STREAM_DRAW, "particles" );
+  glBindBuffer( GL_COPY_READ_BUFFER, 0 );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  return 1;
+}
+
+void gpu_particles_destroy( gpu_particles_t *particles ) {
+
+  for ( int i = 0; i < 2; ++i )
+    gpu_mem_release( GPU_MEM_BUFFER, particles->buffers[ i ] );
+  gpu_mem_release( GPU_MEM_BUFFER, particles->spawnBuffer );
+  glDeleteVertexArrays( 2, particles->vaos );
+  glDeleteBuffers( 2, particles->buffers );
+  glDeleteBuffers( 1, &particles->spawnBuffer );
+  destroy_shader( particles->update );
+  destroy_shader( particles->draw );
+  mem_free( particles->spawns );
+  memset( particles, 0, sizeof( gpu_particles_t ) );
+}
+
+void gpu_particles_emit( gpu_particles_t *particles, vec3_t position, unsigned count, float speed, float life ) {
+
+  unsigned room = GPU_PARTICLES_SPAWN_MAX - particles->spawnCount;
+
+  if ( count > room ) {
+    particles->spawnDropped += count - room;
+    count = room;
+  }
+
+  // Direction and speed are randomised on the GPU from the seed
+  gpu_particle_t *p = particles->spawns + particles->spawnCount;
+  for ( unsigned i = 0; i < count; ++i ) {
+    p[ i ] = (gpu_particle_t) { { position.x, position.y }, { speed, (float) ( particles->seed++ & 0xffffff ) }, -1.0f, life };
+  }
+  particles->spawnCount += count;
+}
+
+void gpu_particles_update( gpu_particles_t *particles ) {
+
+  PROFILE_BEGIN( "gpu_particles_update" );
+
+  unsigned src = particles->current;
+  unsigned dst = 1 - src;
+  unsigned count = particles->spawnCount;
+
+  if ( count ) {
+    // Orphaned, so the copies of the previous frame can still be in flight
+    size_t bytes = count * sizeof( gpu_particle_t );
+    glBindBuffer( GL_COPY_READ_BUFFER, particles->spawnBuffer );
+    glBufferData( GL_COPY_READ_BUFFER, GPU_PARTICLES_SPAWN_MAX * sizeof( gpu_particle_t ), NULL, GL_STREAM_DRAW );
+    glBufferSubData( GL_COPY_READ_BUFFER, 0, bytes, particles->spawns );
+
+    // Over the oldest slots, wrapping around the end of the buffer
+    glBindBuffer( GL_COPY_WRITE_BUFFER, particles->buffers[ src ] );
+    unsigned first = particles->capacity - particles->cursor;
+    if ( first > count )
+      first = count;
+    glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0,
+      particles->cursor * sizeof( gpu_particle_t ), first * sizeof( gpu_particle_t ) );
+    if ( count > first )
+      glCopyBufferSubData( GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, first * sizeof( gpu_particle_t ),
+        0, ( count - first ) * sizeof( gpu_particle_t ) );
+    glBindBuffer( GL_COPY_READ_BUFFER, 0 );
+    glBindBuffer( GL_COPY_WRITE_BUFFER, 0 );
+    particles->cursor = ( particles->cursor + count ) % particles->capacity;
+  }
+
+  activate_shader( particles->update );
+  glEnable( GL_RASTERIZER_DISCARD );
+  glBindVertexArray( particles->vaos[ src ] );
+  glBindBufferBase( GL_TRANSFORM_FEEDBACK_BUFFER, 0, particles->buffers[ dst ] );
+  glBeginTransformFeedback( GL_POINTS );
+  glDrawArrays( GL_POINTS, 0, particles->capacity );
+  glEndTransformFeedback();
+  glBindBufferBase( GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0 );
+  glBindVertexArray( 0 );
+  glDisable( GL_RASTERIZER_DISCARD );
+
+  particles->current = dst;
+  particles->lastSpawned = count;
+  particles->lastDropped = particles->spawnDropped;
+  particles->spawned += count;
+  particles->dropped += particles->spawnDropped;
+  particles->spawnCount = 0;
+  particles->spawnDropped = 0;
+
+  PROFILE_END();
+}
+
+void gpu_particles_draw( const gpu_particles_t *particles ) {
+
+  PROFILE_BEGIN( "gpu_particles_draw" );
+
+  activate_shader( particles->draw );
+  glEnable( GL_PROGRAM_POINT_SIZE );
+  glEnable( GL_BLEND );
+  // Keeps the framebuffer opaque where thousands of faint points overlap
+  glBlendFuncSeparate( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
+  glBindVertexArray( particles->vaos[ particles->current ] );
+  // Dead slots are moved outside the clip volume by particle.vert
+  glDrawArrays( GL_POINTS, 0, particles->capacity );
+  glBindVertexArray( 0 );
+  glDisable( GL_BLEND );
+  glDisable( GL_PROGRAM_POINT_SIZE );
+
+  PROFILE_END();
+}
@@ -0,0 +1,67 @@
+#ifndef GPU_PARTICLES_H
+#define GPU_PARTICLES_H
+
+#include <stdint.h>
+#include "linmath.h"
+#include "renderer.h"
+
+/*
+ * Particles simulated entirely on the GPU. Each frame a transform feedback
+ * pass runs particle_update.vert over every slot of one buffer and captures
+ * the result into the other, then the roles swap. New particles are written
+ * into a small spawn buffer and copied over the oldest slots of the source
+ * buffer before the pass, so the CPU only ever touches what's spawned that
+ * frame, however many particles are alive.
+ */
+// Particles that can be spawned in one frame, more are dropped. Sized for
+// main's explosions.
+#define GPU_PARTICLES_SPAWN_MAX 32768
+
+// Layout of the buffers and of particle_update.vert's outputs
+typedef struct gpu_particle {
+  float position[ 2 ];
+  // Spawned particles carry their speed and a random seed here, the update
+  // pass turns them into a velocity
+  float velocity[ 2 ];
+  // Negative while waiting for the first update
+  float age;
+  float life;
+} gpu_particle_t;
+
+typedef struct gpu_particles {
+  unsigned capacity;
+  // Ping-pong pair, current is the one holding the last simulated state
+  unsigned buffers[ 2 ];
+  unsigned vaos[ 2 ];
+  unsigned current;
+  unsigned spawnBuffer;
+  gpu_particle_t *spawns;
+  unsigned spawnCount;
+  // Next slot to be overwritten by a spawn
+  unsigned cursor;
+  uint32_t seed;
+  shader_t *update;
+  shader_t *draw;
+
+  // Since the last update
+  unsigned spawnDropped;
+
+  // Of the last frame
+  unsigned lastSpawned;
+  unsigned lastDropped;
+  // Over the whole run
+  unsigned long long spawned;
+  unsigned long long dropped;
+} gpu_particles_t;
+
+int gpu_particles_init( gpu_particles_t *particles, unsigned capacity );
+void gpu_particles_destroy( gpu_particles_t *particles );
+// Spawns count particles at position flying apart at up to speed world
+// units per second, living life seconds
+void gpu_particles_emit( gpu_particles_t *particles, vec3_t position, unsigned count, float speed, float life );
+// Uploads this frame's spawns and advances the simulation by the frame
+// block's time step, so the frame block must be up to date
+void gpu_particles_update( gpu_particles_t *particles );
+void gpu_particles_draw( const gpu_particles_t *particles );
+
+#endif
@@ -0,0 +1,155 @@
+#include <string.h>
+#include <glad/glad.h>
+#include "gpu_timer.h"
+#include "timing.h"
+
+int gpu_timer_init( gpu_timer_t *timer ) {
+
+  memset( timer, 0, sizeof( gpu_timer_t ) );
+
+  for ( unsigned i = 0; i < GPU_TIMER_FRAMES; ++i )
+    glGenQueries( GPU_TIMER_MAX_ZONES * 2, timer->frames[ i ].queries );
+
+  GLint bits = 0;
+  glGetQueryiv( GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits );
+
+  if ( bits == 0 ) {
+    fprintf( stderr, "GL_TIMESTAMP queries are not supported, GPU timing disabled\n" );
+    return 0;
+  }
+
+  timer->supported = 1;
+
+  return 1;
+}
+
+void gpu_timer_destroy( gpu_timer_t *timer ) {
+
+  for ( unsigned i = 0; i < GPU_TIMER_FRAMES; ++i )
+    glDeleteQueries( GPU_TIMER_MAX_ZONES * 2, timer->frames[ i ].queries );
+}
+
+// Returns 1 and fills in the results if the frame's queries have landed
+static int collect_frame( gpu_timer_t *timer, gpu_timer_frame_t *frame ) {
+
+  // Nothing was timed, keep the previous results around
+  if ( frame->zoneCount == 0 ) {
+    frame->pending = 0;
+    return 1;
+  }
+
+  // Queries complete in order, so the last one being ready means they all are
+  GLint available = 0;
+  glGetQueryObjectiv( frame->queries[ frame->zoneCount * 2 - 1 ], GL_QUERY_RESULT_AVAILABLE, &available );
+  if ( !available )
+    return 0;
+
+  for ( unsigned i = 0; i < frame->zoneCount; ++i ) {
+    GLuint64 begin = 0;
+    GLuint64 end = 0;
+    glGetQueryObjectui64v( frame->queries[ i * 2 ], GL_QUERY_RESULT, &begin );
+    glGetQueryObjectui64v( frame->queries[ i * 2 + 1 ], GL_QUERY_RESULT, &end );
+
+    gpu_zone_result_t *result = &timer->results[ i ];
+    result->name = frame->names[ i ];
+    result->start_ns = (uint64_t) ( (int64_t) begin + frame->clockOffset );
+    result->duration_ns = end > begin ? end - begin : 0;
+  }
+
+  timer->resultCount = frame->zoneCount;
+  ++timer->completedFrames;
+  frame->pending = 0;
+
+  return 1;
+}
+
+void gpu_timer_begin_frame( gpu_timer_t *timer ) {
+
+  gpu_timer_frame_t *frame = &timer->frames[ timer->current ];
+
+  if ( !timer->supported ) {
+    timer->recording = 0;
+    return;
+  }
+
+  // The GPU is more than GPU_TIMER_FRAMES behind. Rather than wait for it,
+  // just don't time this frame.
+  if ( frame->pending && !collect_frame( timer, frame ) ) {
+    timer->recording = 0;
+    ++timer->skippedFrames;
+    return;
+  }
+
+  GLint64 gpuNow = 0;
+  glGetInteger64v( GL_TIMESTAMP, &gpuNow );
+
+  frame->clockOffset = (int64_t) timing_now_ns() - (int64_t) gpuNow;
+  frame->zoneCount = 0;
+  timer->recording = 1;
+}
+
+int gpu_timer_zone_begin( gpu_timer_t *timer, const char *name ) {
+
+  gpu_timer_frame_t *frame = &timer->frames[ timer->current ];
+
+  if ( !timer->recording || frame->zoneCount >= GPU_TIMER_MAX_ZONES )
+    return -1;
+
+  unsigned zone = frame->zoneCount++;
+  frame->names[ zone ] = name;
+  glQueryCounter( frame->queries[ zone * 2 ], GL_TIMESTAMP );
+
+  return (int) zone;
+}
+
+void gpu_timer_zone_end( gpu_timer_t *timer, int zone ) {
+
+  if ( zone < 0 )
+    return;
+
+  glQueryCounter( timer->frames[ timer->current ].queries[ zone * 2 + 1 ], GL_TIMESTAMP );
+}
+
+void gpu_timer_end_frame( gpu_timer_t *timer ) {
+
+  if ( timer->recording ) {
+    timer->frames[ timer->current ].pending = 1;
+    timer->current = ( timer->current + 1 ) % GPU_TIMER_FRAMES;
+  }
+
+  // Oldest first, so that the results end up being from the latest frame
+  for ( unsigned i = 0; i < GPU_TIMER_FRAMES; ++i ) {
+    gpu_timer_frame_t *frame = &timer->frames[ ( timer->current + i ) % GPU_TIMER_FRAMES ];
+    if ( frame->pending && !collect_frame( timer, frame ) )
+      break;
+  }
+}
+
+uint64_t gpu_timer_zones_ns( const gpu_timer_t *timer, const char *first, const char *last ) {
+
+  uint64_t total = 0;
+  int inside = 0;
+
+  for ( unsigned i = 0; i < timer->resultCount; ++i ) {
+    const gpu_zone_result_t *zone = &timer->results[ i ];
+    if ( !inside && !strcmp( zone->name, first ) )
+      inside = 1;
+    if ( !inside )
+      continue;
+    total += zone->duration_ns;
+    if ( !strcmp( zone->name, last ) )
+      break;
+  }
+
+  return total;
+}
+
+void gpu_timer_print( const gpu_timer_t *timer, FILE *out ) {
+
+  fprintf( out, "GPU:" );
+
+  for ( unsigned i = 0; i < timer->resultCount; ++i )
+    fprintf( out, " %s %.3f", timer->results[ i ].name, timer->results[ i ].duration_ns / (double) NS_PER_MS );
+
+  fprintf( out, " ms (skipped frames: %llu)\n", (unsigned long long) timer->skippedFrames );
+}
@@ -0,0 +1,63 @@
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * GPU timing zones using GL_TIMESTAMP queries. Each frame gets its own set of
+ * query objects from a ring that is GPU_TIMER_FRAMES deep, and results are
+ * only read once the GPU reports them as available, so timing never stalls
+ * the pipeline. Results therefore lag a few frames behind.
+ */
+#define GPU_TIMER_FRAMES 4
+#define GPU_TIMER_MAX_ZONES 16
+
+typedef struct gpu_zone_result {
+  const char *name;
+  // On the timing_now_ns() timeline, so that GPU zones line up with CPU ones
+  uint64_t start_ns;
+  uint64_t duration_ns;
+} gpu_zone_result_t;
+
+typedef struct gpu_timer_frame {
+  // Begin and end timestamp query for each zone
+  unsigned queries[ GPU_TIMER_MAX_ZONES * 2 ];
+  const char *names[ GPU_TIMER_MAX_ZONES ];
+  unsigned zoneCount;
+  // CPU clock minus GPU clock, sampled when the frame began
+  int64_t clockOffset;
+  int pending;
+} gpu_timer_frame_t;
+
+typedef struct gpu_timer {
+  gpu_timer_frame_t frames[ GPU_TIMER_FRAMES ];
+  unsigned current;
+  // Zero without GL_TIMESTAMP support, no zones get issued then
+  int supported;
+  // Zero if the ring was full at the start of this frame
+  int recording;
+  // Zones of the most recently completed frame
+  gpu_zone_result_t results[ GPU_TIMER_MAX_ZONES ];
+  unsigned resultCount;
+  uint64_t completedFrames;
+  uint64_t skippedFrames;
+} gpu_timer_t;
+
+// Returns 0 if GPU timing is unsupported, the timer then records nothing
+int gpu_timer_init( gpu_timer_t *timer );
+void gpu_timer_destroy( gpu_timer_t *timer );
+
+void gpu_timer_begin_frame( gpu_timer_t *timer );
+// Returns a zone handle for gpu_timer_zone_end(), or -1 if not recording
+int gpu_timer_zone_begin( gpu_timer_t *timer, const char *name );
+void gpu_timer_zone_end( gpu_timer_t *timer, int zone );
+// Also picks up the results of any earlier frames the GPU has finished
+void gpu_timer_end_frame( gpu_timer_t *timer );
+
+// GPU time of the zones from first through last of the most recently
+// completed frame, 0 if first wasn't timed
+uint64_t gpu_timer_zones_ns( const gpu_timer_t *timer, const char *first, const char *last );
+void gpu_timer_print( const gpu_timer_t *timer, FILE *out );
+
+#endif
@@ -0,0 +1,97 @@
+#include <string.h>
+#include <math.h>
+#include "histogram.h"
+
+void histogram_reset( histogram_t *h ) {
+
+  memset( h, 0, sizeof( histogram_t ) );
+  h->min = UINT64_MAX;
+}
+
+unsigned histogram_bucket_index( uint64_t value ) {
+
+  if ( value < HISTOGRAM_SUB_COUNT )
+    return (unsigned) value;
+
+  // Position of the highest set bit, at least HISTOGRAM_SUB_BITS here
+  unsigned msb = 63 - __builtin_clzll( value );
+  unsigned shift = msb - ( HISTOGRAM_SUB_BITS - 1 );
+
+  if ( shift > HISTOGRAM_SHIFTS )
+    return HISTOGRAM_BUCKETS - 1;
+
+  unsigned top = (unsigned) ( value >> shift );
+
+  return HISTOGRAM_SUB_COUNT + ( shift - 1 ) * HISTOGRAM_SUB_HALF + ( top - HISTOGRAM_SUB_HALF );
+}
+
+uint64_t histogram_bucket_lowest( unsigned index ) {
+
+  if ( index < HISTOGRAM_SUB_COUNT )
+    return index;
+
+  unsigned k = index - HISTOGRAM_SUB_COUNT;
+  unsigned shift = k / HISTOGRAM_SUB_HALF + 1;
+  uint64_t top = k % HISTOGRAM_SUB_HALF + HISTOGRAM_SUB_HALF;
+
+  return top << shift;
+}
+
+uint64_t histogram_bucket_highest( unsigned index ) {
+
+  if ( index < HISTOGRAM_SUB_COUNT )
+    return index;
+
+  unsigned k = index - HISTOGRAM_SUB_COUNT;
+  unsigned shift = k / HISTOGRAM_SUB_HALF + 1;
+  uint64_t top = k % HISTOGRAM_SUB_HALF + HISTOGRAM_SUB_HALF;
+
+  return ( ( top + 1 ) << shift ) - 1;
+}
+
+void histogram_record( histogram_t *h, uint64_t value ) {
+
+  ++h->counts[ histogram_bucket_index( value ) ];
+  ++h->total;
+  h->sum += (double) value;
+
+  if ( value < h->min )
+    h->min = value;
+  if ( value > h->max )
+    h->max = value;
+}
+
+uint64_t histogram_percentile( const histogram_t *h, double percentile ) {
+
+  if ( h->total == 0 )
+    return 0;
+
+  // Rank of the sample we're looking for, 1-based
+  uint64_t rank = (uint64_t) ceil( percentile / 100.0 * (double) h->total );
+  if ( rank < 1 )
+    rank = 1;
+  if ( rank > h->total )
+    rank = h->total;
+
+  uint64_t seen = 0;
+
+  for ( unsigned i = 0; i < HISTOGRAM_BUCKETS; ++i ) {
+    seen += h->counts[ i ];
+    if ( seen >= rank ) {
+      // Report the top of the bucket, so that we never under-report latency,
+      // but don't go past what was actually recorded
+      uint64_t value = histogram_bucket_highest( i );
+      return value > h->max ? h->max : value;
+    }
+  }
+
+  return h->max;
+}
+
+double histogram_mean( const histogram_t *h ) {
+
+  if ( h->total == 0 )
+    return 0;
+
+  return h->sum / (double) h->total;
+}
@@ -0,0 +1,39 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>
+
+/*
+ * Log-linear histogram in the spirit of HdrHistogram. Values below
+ * HISTOGRAM_SUB_COUNT are stored exactly, above that every power of two is
+ * split into HISTOGRAM_SUB_HALF linear buckets, so the recorded value is
+ * always within 1/64 (~1.6%) of the real one no matter how large it is.
+ * Recording is O(1) and never allocates.
+ */
+#define HISTOGRAM_SUB_BITS 7
+#define HISTOGRAM_SUB_COUNT ( 1 << HISTOGRAM_SUB_BITS )
+#define HISTOGRAM_SUB_HALF ( HISTOGRAM_SUB_COUNT / 2 )
+// Enough for ~39 hours worth of nanoseconds
+#define HISTOGRAM_SHIFTS 40
+#define HISTOGRAM_BUCKETS ( HISTOGRAM_SUB_COUNT + HISTOGRAM_SHIFTS * HISTOGRAM_SUB_HALF )
+
+typedef struct histogram {
+  uint32_t counts[ HISTOGRAM_BUCKETS ];
+  uint64_t total;
+  uint64_t min;
+  uint64_t max;
+  double sum;
+} histogram_t;
+
+void histogram_reset( histogram_t *h );
+void histogram_record( histogram_t *h, uint64_t value );
+// percentile is in the range 0-100
+uint64_t histogram_percentile( const histogram_t *h, double percentile );
+double histogram_mean( const histogram_t *h );
+
+// For iterating over the buckets, e.g. when dumping the whole distribution
+unsigned histogram_bucket_index( uint64_t value );
+uint64_t histogram_bucket_lowest( unsigned index );
+uint64_t histogram_bucket_highest( unsigned index );
+
+#endif
@@ -0,0 +1,70 @@
+#include <stdio.h>
+#include <string.h>
+#include <png.h>
+#include "image.h"
+#include "mem.h"
+
+int image_write_png( const char *path, const unsigned char *pixels, int width, int height, int stride, int flipY ) {
+
+  FILE *file = fopen( path, "wb" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write %s\n", path );
+    return 0;
+  }
+
+  png_structp png = png_create_write_struct( PNG_LIBPNG_VER_STRING, NULL, NULL, NULL );
+  png_infop info = png ? png_create_info_struct( png ) : NULL;
+
+  if ( !info || setjmp( png_jmpbuf( png ) ) ) {
+    fprintf( stderr, "Could not encode %s\n", path );
+    png_destroy_write_struct( &png, &info );
+    fclose( file );
+    return 0;
+  }
+
+  png_init_io( png, file );
+  // Captures are written while the game runs, favour speed over size
+  png_set_compression_level( png, 1 );
+  png_set_filter( png, 0, PNG_FILTER_SUB );
+  png_set_IHDR( png, info, width, height, 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE,
+    PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT );
+  png_write_info( png, info );
+
+  for ( int y = 0; y < height; ++y ) {
+    int row = flipY ? height - 1 - y : y;
+    png_write_row( png, (png_const_bytep) ( pixels + (size_t) row * stride ) );
+  }
+
+  png_write_end( png, NULL );
+  png_destroy_write_struct( &png, &info );
+
+  return fclose( file ) == 0;
+}
+
+unsigned char* image_read_png( const char *path, int *width, int *height ) {
+
+  png_image image;
+  memset( &image, 0, sizeof( image ) );
+  image.version = PNG_IMAGE_VERSION;
+
+  if ( !png_image_begin_read_from_file( &image, path ) ) {
+    fprintf( stderr, "Could not read %s: %s\n", path, image.message );
+    return NULL;
+  }
+
+  // libpng expands palettes and grey and adds alpha as needed
+  image.format = PNG_FORMAT_RGBA;
+  unsigned char *pixels = mem_alloc( MEM_ASSETS, PNG_IMAGE_SIZE( image ) );
+
+  if ( !pixels || !png_image_finish_read( &image, NULL, pixels, 0, NULL ) ) {
+    fprintf( stderr, "Could not decode %s: %s\n", path, image.message );
+    png_image_free( &image );
+    mem_free( pixels );
+    return NULL;
+  }
+
+  *width = (int) image.width;
+  *height = (int) image.height;
+
+  return pixels;
+}
@@ -0,0 +1,11 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+
+// RGBA8 pixels, stride is in bytes. flipY writes the rows bottom-up, which is
+// what glReadPixels() gives us.
+int image_write_png( const char *path, const unsigned char *pixels, int width, int height, int stride, int flipY );
+
+// Decodes any PNG to RGBA8, top row first. Free with mem_free().
+unsigned char* image_read_png( const char *path, int *width, int *height );
+
+#endif
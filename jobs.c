@@ -0,0 +1,166 @@
+// pthreads and sysconf() are POSIX, which -std=c99 hides by default
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "jobs.h"
+#include "profiler.h"
+
+typedef struct job_batch {
+  job_fn_t fn;
+  void *ctx;
+  unsigned count;
+  unsigned chunkSize;
+  unsigned chunks;
+  // Next chunk to hand out, and chunks finished
+  unsigned next;
+  unsigned done;
+  int active;
+} job_batch_t;
+
+static pthread_t workers[ JOBS_MAX_THREADS ];
+static unsigned nThreads;
+static job_batch_t batches[ JOBS_MAX_BATCHES ];
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+// Signaled when there is new work, or when a batch finishes
+static pthread_cond_t workCond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t doneCond = PTHREAD_COND_INITIALIZER;
+static int quit;
+
+// Call with the lock held. Returns 0 if the batch has nothing left to hand out.
+static int run_chunk( job_batch_t *batch ) {
+
+  if ( batch->next >= batch->chunks )
+    return 0;
+
+  unsigned chunk = batch->next++;
+  unsigned begin = chunk * batch->chunkSize;
+  unsigned end = begin + batch->chunkSize;
+  if ( end > batch->count )
+    end = batch->count;
+
+  pthread_mutex_unlock( &lock );
+  batch->fn( batch->ctx, begin, end );
+  pthread_mutex_lock( &lock );
+
+  if ( ++batch->done == batch->chunks )
+    pthread_cond_broadcast( &doneCond );
+
+  return 1;
+}
+
+static void* worker_main( void *arg ) {
+
+  PROFILE_THREAD_NAME( "jobs" );
+
+  pthread_mutex_lock( &lock );
+
+  while ( !quit ) {
+    int worked = 0;
+    for ( unsigned i = 0; i < JOBS_MAX_BATCHES; ++i ) {
+      if ( batches[ i ].active && run_chunk( &batches[ i ] ) ) {
+        worked = 1;
+        break;
+      }
+    }
+    if ( !worked )
+      pthread_cond_wait( &workCond, &lock );
+  }
+
+  pthread_mutex_unlock( &lock );
+
+  return NULL;
+}
+
+int jobs_init( unsigned threads ) {
+
+  if ( threads == 0 ) {
+    long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+    threads = cpus > 1 ? (unsigned) cpus - 1 : 0;
+  }
+
+  if ( threads > JOBS_MAX_THREADS )
+    threads = JOBS_MAX_THREADS;
+
+  quit = 0;
+
+  for ( nThreads = 0; nThreads < threads; ++nThreads ) {
+    if ( pthread_create( &workers[ nThreads ], NULL, worker_main, NULL ) != 0 ) {
+      fprintf( stderr, "Could not start job thread %u\n", nThreads );
+      return 0;
+    }
+  }
+
+  return 1;
+}
+
+void jobs_shutdown() {
+
+  pthread_mutex_lock( &lock );
+  quit = 1;
+  pthread_cond_broadcast( &workCond );
+  pthread_mutex_unlock( &lock );
+
+  for ( unsigned i = 0; i < nThreads; ++i )
+    pthread_join( workers[ i ], NULL );
+
+  nThreads = 0;
+}
+
+unsigned jobs_thread_count() {
+  return nThreads;
+}
+
+void jobs_parallel_for( unsigned count, unsigned grain, job_fn_t fn, void *ctx ) {
+
+  if ( count == 0 )
+    return;
+
+  if ( grain < 1 )
+    grain = 1;
+
+  // A few chunks per thread evens out uneven work
+  unsigned chunkSize = count / ( ( nThreads + 1 ) * 4 );
+  if ( chunkSize < grain )
+    chunkSize = grain;
+
+  if ( nThreads == 0 || chunkSize >= count ) {
+    fn( ctx, 0, count );
+    return;
+  }
+
+  pthread_mutex_lock( &lock );
+
+  job_batch_t *batch = NULL;
+  for ( unsigned i = 0; i < JOBS_MAX_BATCHES && !batch; ++i ) {
+    if ( !batches[ i ].active )
+      batch = &batches[ i ];
+  }
+
+  // Too many loops in flight, just do this one ourselves
+  if ( !batch ) {
+    pthread_mutex_unlock( &lock );
+    fn( ctx, 0, count );
+    return;
+  }
+
+  batch->fn = fn;
+  batch->ctx = ctx;
+  batch->count = count;
+  batch->chunkSize = chunkSize;
+  batch->chunks = ( count + chunkSize - 1 ) / chunkSize;
+  batch->next = 0;
+  batch->done = 0;
+  batch->active = 1;
+  pthread_cond_broadcast( &workCond );
+
+  while ( run_chunk( batch ) )
+    ;
+
+  while ( batch->done < batch->chunks )
+    pthread_cond_wait( &doneCond, &lock );
+
+  batch->active = 0;
+  pthread_mutex_unlock( &lock );
+}
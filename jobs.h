@@ -0,0 +1,25 @@
+#ifndef JOBS_H
+#define JOBS_H
+
+/*
+ * A small pool of worker threads for data-parallel loops. Several threads
+ * may run loops at the same time (e.g. the capture thread converting video
+ * while the render thread updates particles); workers help whichever loop
+ * still has work. The calling thread works on its own loop too.
+ */
+#define JOBS_MAX_THREADS 32
+#define JOBS_MAX_BATCHES 8
+
+// Processes items [begin, end)
+typedef void (*job_fn_t)( void *ctx, unsigned begin, unsigned end );
+
+// threads = 0 means one per CPU, minus the calling thread
+int jobs_init( unsigned threads );
+void jobs_shutdown();
+unsigned jobs_thread_count();
+
+// Splits [0, count) into chunks of at least grain items and returns once all
+// of them have been processed. Runs inline if the pool isn't running.
+void jobs_parallel_for( unsigned count, unsigned grain, job_fn_t fn, void *ctx );
+
+#endif
@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+#
+# Generates src/gl_stats.c, the GL call counting wrappers declared in
+# include/glad/gl_stats.h, from the function pointer typedefs in glad.h.
+# Re-run whenever glad is regenerated:
+#
+#   python3 lib/glad/gen_gl_stats.py
+
+import os
+import re
+
+HERE = os.path.dirname( os.path.abspath( __file__ ) )
+GLAD_H = os.path.join( HERE, 'include', 'glad', 'glad.h' )
+OUT = os.path.join( HERE, 'src', 'gl_stats.c' )
+
+TYPEDEF = re.compile( r'^typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);$' )
+POINTER = re.compile( r'^GLAPI (PFNGL\w+PROC) glad_(gl\w+);$' )
+
+STATE_CHANGES = (
+  'glEnable', 'glDisable', 'glEnablei', 'glDisablei', 'glBlendFunc',
+  'glBlendFuncSeparate', 'glBlendEquation', 'glBlendEquationSeparate',
+  'glBlendColor', 'glDepthFunc', 'glDepthMask', 'glDepthRange', 'glCullFace',
+  'glFrontFace', 'glPolygonMode', 'glPolygonOffset', 'glStencilFunc',
+  'glStencilFuncSeparate', 'glStencilOp', 'glStencilOpSeparate',
+  'glStencilMask', 'glStencilMaskSeparate', 'glColorMask', 'glColorMaski',
+  'glViewport', 'glScissor', 'glClearColor', 'glClearDepth', 'glClearStencil',
+  'glLineWidth', 'glPointSize', 'glPixelStorei', 'glPixelStoref',
+  'glEnableVertexAttribArray', 'glDisableVertexAttribArray',
+  'glVertexAttribPointer', 'glVertexAttribIPointer', 'glVertexAttribDivisor',
+)
+
+# Expression for the number of bytes uploaded, in terms of the arguments
+UPLOADS = {
+  'glBufferData': 'data ? (unsigned long long) size : 0',
+  'glBufferSubData': 'data ? (unsigned long long) size : 0',
+  'glTexImage1D': 'pixels ? texel_bytes( format, type ) * width : 0',
+  'glTexImage2D': 'pixels ? texel_bytes( format, type ) * width * height : 0',
+  'glTexImage3D': 'pixels ? texel_bytes( format, type ) * width * height * depth : 0',
+  'glTexSubImage1D': 'pixels ? texel_bytes( format, type ) * width : 0',
+  'glTexSubImage2D': 'pixels ? texel_bytes( format, type ) * width * height : 0',
+  'glTexSubImage3D': 'pixels ? texel_bytes( format, type ) * width * height * depth : 0',
+  'glCompressedTexImage1D': '(unsigned long long) imageSize',
+  'glCompressedTexImage2D': '(unsigned long long) imageSize',
+  'glCompressedTexImage3D': '(unsigned long long) imageSize',
+  'glCompressedTexSubImage1D': '(unsigned long long) imageSize',
+  'glCompressedTexSubImage2D': '(unsigned long long) imageSize',
+  'glCompressedTexSubImage3D': '(unsigned long long) imageSize',
+}
+
+HEADER = '''// Generated by gen_gl_stats.py from glad.h, do not edit.
+
+#ifdef GL_STATS
+
+#include <stdlib.h>
+#include <glad/glad.h>
+#include <glad/gl_stats.h>
+
+static gl_stats_frame_t current;
+static gl_stats_frame_t lastFrame;
+static gl_stats_frame_t total;
+
+static unsigned long long texel_bytes( GLenum format, GLenum type ) {
+
+  unsigned long long components;
+
+  switch ( format ) {
+    case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+      components = 1; break;
+    case GL_RG: case GL_RG_INTEGER:
+      components = 2; break;
+    case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+      components = 3; break;
+    default:
+      components = 4; break;
+  }
+
+  switch ( type ) {
+    case GL_UNSIGNED_BYTE: case GL_BYTE:
+      return components;
+    case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+      return components * 2;
+    case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+      return components * 4;
+    // Packed formats describe the whole texel
+    case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+      return 1;
+    case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+      return 2;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      return 8;
+    default:
+      return 4;
+  }
+}
+'''
+
+FOOTER = '''
+void gl_stats_install( void ) {
+
+  for ( unsigned i = 0; i < GL_STATS_FUNCTIONS; ++i ) {
+    if ( *functions[ i ].pointer ) {
+      *functions[ i ].real = *functions[ i ].pointer;
+      *functions[ i ].pointer = functions[ i ].wrapper;
+    }
+  }
+}
+
+void gl_stats_end_frame( void ) {
+
+  lastFrame = current;
+  total.calls += current.calls;
+  total.draws += current.draws;
+  total.binds += current.binds;
+  total.uniforms += current.uniforms;
+  total.stateChanges += current.stateChanges;
+  total.bytesUploaded += current.bytesUploaded;
+  current = (gl_stats_frame_t) { 0 };
+}
+
+const gl_stats_frame_t* gl_stats_last_frame( void ) {
+
+  return &lastFrame;
+}
+
+const gl_stats_frame_t* gl_stats_total( void ) {
+
+  return &total;
+}
+
+static int compare_counts( const void *a, const void *b ) {
+
+  unsigned long long x = counts[ *(const unsigned*) a ];
+  unsigned long long y = counts[ *(const unsigned*) b ];
+
+  return ( x < y ) - ( x > y );
+}
+
+void gl_stats_print( FILE *out, unsigned maxFunctions ) {
+
+  static unsigned order[ GL_STATS_FUNCTIONS ];
+
+  for ( unsigned i = 0; i < GL_STATS_FUNCTIONS; ++i )
+    order[ i ] = i;
+
+  qsort( order, GL_STATS_FUNCTIONS, sizeof( unsigned ), compare_counts );
+
+  fprintf( out, "GL calls: %llu, draws: %llu, binds: %llu, uniforms: %llu, state changes: %llu, uploaded: %llu bytes\\n",
+    total.calls, total.draws, total.binds, total.uniforms, total.stateChanges, total.bytesUploaded );
+
+  for ( unsigned i = 0; i < maxFunctions && i < GL_STATS_FUNCTIONS && counts[ order[ i ] ]; ++i )
+    fprintf( out, "  %-32s %llu\\n", functions[ order[ i ] ].name, counts[ order[ i ] ] );
+}
+
+#endif
+'''
+
+
+def arg_name( param ):
+  return re.findall( r'\w+', param )[ -1 ]
+
+
+def main():
+
+  types = {}
+  functions = []
+
+  with open( GLAD_H ) as f:
+    for line in f:
+      line = line.strip()
+      m = TYPEDEF.match( line )
+      if m:
+        types[ m.group( 2 ) ] = ( m.group( 1 ), m.group( 3 ) )
+        continue
+      m = POINTER.match( line )
+      if m:
+        functions.append( ( m.group( 2 ), m.group( 1 ) ) )
+
+  out = [ HEADER ]
+  out.append( '#define GL_STATS_FUNCTIONS %d\n' % len( functions ) )
+  out.append( 'static unsigned long long counts[ GL_STATS_FUNCTIONS ];\n' )
+
+  for index, ( name, pfn ) in enumerate( functions ):
+    ret, params = types[ pfn ]
+    if params in ( '', 'void' ):
+      params = 'void'
+      args = []
+    else:
+      args = [ arg_name( p ) for p in params.split( ',' ) ]
+
+    counters = [ '  ++counts[ %d ];' % index, '  ++current.calls;' ]
+    if name.startswith( 'glDraw' ) or name.startswith( 'glMultiDraw' ):
+      counters.append( '  ++current.draws;' )
+    elif name.startswith( 'glBind' ) or name == 'glUseProgram':
+      counters.append( '  ++current.binds;' )
+    elif name.startswith( 'glUniform' ) and not name.startswith( 'glUniformBlock' ):
+      counters.append( '  ++current.uniforms;' )
+    elif name in STATE_CHANGES:
+      counters.append( '  ++current.stateChanges;' )
+    if name in UPLOADS:
+      counters.append( '  current.bytesUploaded += %s;' % UPLOADS[ name ] )
+
+    call = 'real_%s( %s )' % ( name, ', '.join( args ) ) if args else 'real_%s()' % name
+
+    out.append( '' )
+    out.append( 'static %s real_%s;' % ( pfn, name ) )
+    out.append( 'static %s APIENTRY stats_%s( %s ) {' % ( ret, name, params ) )
+    out.append( '' )
+    out.extend( counters )
+    out.append( '  %s%s;' % ( '' if ret == 'void' else 'return ', call ) )
+    out.append( '}' )
+
+  out.append( '' )
+  out.append( '// Any function pointer type will do, they all get cast back before use' )
+  out.append( 'typedef void (APIENTRYP gl_stats_proc)( void );' )
+  out.append( '' )
+  out.append( 'static const struct {' )
+  out.append( '  const char *name;' )
+  out.append( '  gl_stats_proc *pointer;' )
+  out.append( '  gl_stats_proc *real;' )
+  out.append( '  gl_stats_proc wrapper;' )
+  out.append( '} functions[ GL_STATS_FUNCTIONS ] = {' )
+  for name, pfn in functions:
+    out.append( '  { "%s", (gl_stats_proc*) &glad_%s, (gl_stats_proc*) &real_%s, (gl_stats_proc) stats_%s },' % ( name, name, name, name ) )
+  out.append( '};' )
+
+  out.append( FOOTER )
+
+  with open( OUT, 'w' ) as f:
+    f.write( '\n'.join( out ) )
+
+
+if __name__ == '__main__':
+  main()
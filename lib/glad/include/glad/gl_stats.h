@@ -0,0 +1,48 @@
+#ifndef GL_STATS_H
+#define GL_STATS_H
+
+#include <stdio.h>
+
+/*
+ * Optional instrumentation of the glad loader. gl_stats_install() swaps every
+ * loaded glad_gl* pointer for a wrapper that counts the call and forwards it,
+ * so all GL calls in the program are seen without touching any call sites.
+ *
+ * Only compiled in when GL_STATS is defined (GL_STATS=1 ./build.sh),
+ * otherwise all of the below are no-ops and the loader is untouched.
+ */
+
+typedef struct gl_stats_frame {
+  unsigned long long calls;
+  unsigned long long draws;
+  // glBind* and glUseProgram
+  unsigned long long binds;
+  unsigned long long uniforms;
+  // Fixed function state: enables, blend, depth, viewport etc.
+  unsigned long long stateChanges;
+  // Bytes handed to glBuffer(Sub)Data and glTex(Sub)Image*
+  unsigned long long bytesUploaded;
+} gl_stats_frame_t;
+
+#ifdef GL_STATS
+
+// Call right after gladLoadGLLoader()
+void gl_stats_install( void );
+// Latches the counters of the frame that just ended and starts a new one
+void gl_stats_end_frame( void );
+const gl_stats_frame_t* gl_stats_last_frame( void );
+const gl_stats_frame_t* gl_stats_total( void );
+// The most called functions over the whole run
+void gl_stats_print( FILE *out, unsigned maxFunctions );
+
+#else
+
+#define gl_stats_install() ( (void) 0 )
+#define gl_stats_end_frame() ( (void) 0 )
+#define gl_stats_last_frame() ( (const gl_stats_frame_t*) NULL )
+#define gl_stats_total() ( (const gl_stats_frame_t*) NULL )
+#define gl_stats_print( out, maxFunctions ) ( (void) 0 )
+
+#endif
+
+#endif
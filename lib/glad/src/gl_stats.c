@@ -0,0 +1,3597 @@
+// Generated by gen_gl_stats.py from glad.h, do not edit.
+
+#ifdef GL_STATS
+
+#include <stdlib.h>
+#include <glad/glad.h>
+#include <glad/gl_stats.h>
+
+static gl_stats_frame_t current;
+static gl_stats_frame_t lastFrame;
+static gl_stats_frame_t total;
+
+static unsigned long long texel_bytes( GLenum format, GLenum type ) {
+
+  unsigned long long components;
+
+  switch ( format ) {
+    case GL_RED: case GL_RED_INTEGER: case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+      components = 1; break;
+    case GL_RG: case GL_RG_INTEGER:
+      components = 2; break;
+    case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+      components = 3; break;
+    default:
+      components = 4; break;
+  }
+
+  switch ( type ) {
+    case GL_UNSIGNED_BYTE: case GL_BYTE:
+      return components;
+    case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT:
+      return components * 2;
+    case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT:
+      return components * 4;
+    // Packed formats describe the whole texel
+    case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+      return 1;
+    case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+    case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+    case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+      return 2;
+    case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      return 8;
+    default:
+      return 4;
+  }
+}
+
+#define GL_STATS_FUNCTIONS 374
+
+static unsigned long long counts[ GL_STATS_FUNCTIONS ];
+
+
+static PFNGLCULLFACEPROC real_glCullFace;
+static void APIENTRY stats_glCullFace( GLenum mode ) {
+
+  ++counts[ 0 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glCullFace( mode );
+}
+
+static PFNGLFRONTFACEPROC real_glFrontFace;
+static void APIENTRY stats_glFrontFace( GLenum mode ) {
+
+  ++counts[ 1 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glFrontFace( mode );
+}
+
+static PFNGLHINTPROC real_glHint;
+static void APIENTRY stats_glHint( GLenum target, GLenum mode ) {
+
+  ++counts[ 2 ];
+  ++current.calls;
+  real_glHint( target, mode );
+}
+
+static PFNGLLINEWIDTHPROC real_glLineWidth;
+static void APIENTRY stats_glLineWidth( GLfloat width ) {
+
+  ++counts[ 3 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glLineWidth( width );
+}
+
+static PFNGLPOINTSIZEPROC real_glPointSize;
+static void APIENTRY stats_glPointSize( GLfloat size ) {
+
+  ++counts[ 4 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glPointSize( size );
+}
+
+static PFNGLPOLYGONMODEPROC real_glPolygonMode;
+static void APIENTRY stats_glPolygonMode( GLenum face, GLenum mode ) {
+
+  ++counts[ 5 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glPolygonMode( face, mode );
+}
+
+static PFNGLSCISSORPROC real_glScissor;
+static void APIENTRY stats_glScissor( GLint x, GLint y, GLsizei width, GLsizei height ) {
+
+  ++counts[ 6 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glScissor( x, y, width, height );
+}
+
+static PFNGLTEXPARAMETERFPROC real_glTexParameterf;
+static void APIENTRY stats_glTexParameterf( GLenum target, GLenum pname, GLfloat param ) {
+
+  ++counts[ 7 ];
+  ++current.calls;
+  real_glTexParameterf( target, pname, param );
+}
+
+static PFNGLTEXPARAMETERFVPROC real_glTexParameterfv;
+static void APIENTRY stats_glTexParameterfv( GLenum target, GLenum pname, const GLfloat *params ) {
+
+  ++counts[ 8 ];
+  ++current.calls;
+  real_glTexParameterfv( target, pname, params );
+}
+
+static PFNGLTEXPARAMETERIPROC real_glTexParameteri;
+static void APIENTRY stats_glTexParameteri( GLenum target, GLenum pname, GLint param ) {
+
+  ++counts[ 9 ];
+  ++current.calls;
+  real_glTexParameteri( target, pname, param );
+}
+
+static PFNGLTEXPARAMETERIVPROC real_glTexParameteriv;
+static void APIENTRY stats_glTexParameteriv( GLenum target, GLenum pname, const GLint *params ) {
+
+  ++counts[ 10 ];
+  ++current.calls;
+  real_glTexParameteriv( target, pname, params );
+}
+
+static PFNGLTEXIMAGE1DPROC real_glTexImage1D;
+static void APIENTRY stats_glTexImage1D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels ) {
+
+  ++counts[ 11 ];
+  ++current.calls;
+  current.bytesUploaded += pixels ? texel_bytes( format, type ) * width : 0;
+  real_glTexImage1D( target, level, internalformat, width, border, format, type, pixels );
+}
+
+static PFNGLTEXIMAGE2DPROC real_glTexImage2D;
+static void APIENTRY stats_glTexImage2D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels ) {
+
+  ++counts[ 12 ];
+  ++current.calls;
+  current.bytesUploaded += pixels ? texel_bytes( format, type ) * width * height : 0;
+  real_glTexImage2D( target, level, internalformat, width, height, border, format, type, pixels );
+}
+
+static PFNGLDRAWBUFFERPROC real_glDrawBuffer;
+static void APIENTRY stats_glDrawBuffer( GLenum buf ) {
+
+  ++counts[ 13 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawBuffer( buf );
+}
+
+static PFNGLCLEARPROC real_glClear;
+static void APIENTRY stats_glClear( GLbitfield mask ) {
+
+  ++counts[ 14 ];
+  ++current.calls;
+  real_glClear( mask );
+}
+
+static PFNGLCLEARCOLORPROC real_glClearColor;
+static void APIENTRY stats_glClearColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ) {
+
+  ++counts[ 15 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glClearColor( red, green, blue, alpha );
+}
+
+static PFNGLCLEARSTENCILPROC real_glClearStencil;
+static void APIENTRY stats_glClearStencil( GLint s ) {
+
+  ++counts[ 16 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glClearStencil( s );
+}
+
+static PFNGLCLEARDEPTHPROC real_glClearDepth;
+static void APIENTRY stats_glClearDepth( GLdouble depth ) {
+
+  ++counts[ 17 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glClearDepth( depth );
+}
+
+static PFNGLSTENCILMASKPROC real_glStencilMask;
+static void APIENTRY stats_glStencilMask( GLuint mask ) {
+
+  ++counts[ 18 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glStencilMask( mask );
+}
+
+static PFNGLCOLORMASKPROC real_glColorMask;
+static void APIENTRY stats_glColorMask( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha ) {
+
+  ++counts[ 19 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glColorMask( red, green, blue, alpha );
+}
+
+static PFNGLDEPTHMASKPROC real_glDepthMask;
+static void APIENTRY stats_glDepthMask( GLboolean flag ) {
+
+  ++counts[ 20 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glDepthMask( flag );
+}
+
+static PFNGLDISABLEPROC real_glDisable;
+static void APIENTRY stats_glDisable( GLenum cap ) {
+
+  ++counts[ 21 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glDisable( cap );
+}
+
+static PFNGLENABLEPROC real_glEnable;
+static void APIENTRY stats_glEnable( GLenum cap ) {
+
+  ++counts[ 22 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glEnable( cap );
+}
+
+static PFNGLFINISHPROC real_glFinish;
+static void APIENTRY stats_glFinish( void ) {
+
+  ++counts[ 23 ];
+  ++current.calls;
+  real_glFinish();
+}
+
+static PFNGLFLUSHPROC real_glFlush;
+static void APIENTRY stats_glFlush( void ) {
+
+  ++counts[ 24 ];
+  ++current.calls;
+  real_glFlush();
+}
+
+static PFNGLBLENDFUNCPROC real_glBlendFunc;
+static void APIENTRY stats_glBlendFunc( GLenum sfactor, GLenum dfactor ) {
+
+  ++counts[ 25 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glBlendFunc( sfactor, dfactor );
+}
+
+static PFNGLLOGICOPPROC real_glLogicOp;
+static void APIENTRY stats_glLogicOp( GLenum opcode ) {
+
+  ++counts[ 26 ];
+  ++current.calls;
+  real_glLogicOp( opcode );
+}
+
+static PFNGLSTENCILFUNCPROC real_glStencilFunc;
+static void APIENTRY stats_glStencilFunc( GLenum func, GLint ref, GLuint mask ) {
+
+  ++counts[ 27 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glStencilFunc( func, ref, mask );
+}
+
+static PFNGLSTENCILOPPROC real_glStencilOp;
+static void APIENTRY stats_glStencilOp( GLenum fail, GLenum zfail, GLenum zpass ) {
+
+  ++counts[ 28 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glStencilOp( fail, zfail, zpass );
+}
+
+static PFNGLDEPTHFUNCPROC real_glDepthFunc;
+static void APIENTRY stats_glDepthFunc( GLenum func ) {
+
+  ++counts[ 29 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glDepthFunc( func );
+}
+
+static PFNGLPIXELSTOREFPROC real_glPixelStoref;
+static void APIENTRY stats_glPixelStoref( GLenum pname, GLfloat param ) {
+
+  ++counts[ 30 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glPixelStoref( pname, param );
+}
+
+static PFNGLPIXELSTOREIPROC real_glPixelStorei;
+static void APIENTRY stats_glPixelStorei( GLenum pname, GLint param ) {
+
+  ++counts[ 31 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glPixelStorei( pname, param );
+}
+
+static PFNGLREADBUFFERPROC real_glReadBuffer;
+static void APIENTRY stats_glReadBuffer( GLenum src ) {
+
+  ++counts[ 32 ];
+  ++current.calls;
+  real_glReadBuffer( src );
+}
+
+static PFNGLREADPIXELSPROC real_glReadPixels;
+static void APIENTRY stats_glReadPixels( GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels ) {
+
+  ++counts[ 33 ];
+  ++current.calls;
+  real_glReadPixels( x, y, width, height, format, type, pixels );
+}
+
+static PFNGLGETBOOLEANVPROC real_glGetBooleanv;
+static void APIENTRY stats_glGetBooleanv( GLenum pname, GLboolean *data ) {
+
+  ++counts[ 34 ];
+  ++current.calls;
+  real_glGetBooleanv( pname, data );
+}
+
+static PFNGLGETDOUBLEVPROC real_glGetDoublev;
+static void APIENTRY stats_glGetDoublev( GLenum pname, GLdouble *data ) {
+
+  ++counts[ 35 ];
+  ++current.calls;
+  real_glGetDoublev( pname, data );
+}
+
+static PFNGLGETERRORPROC real_glGetError;
+static GLenum APIENTRY stats_glGetError( void ) {
+
+  ++counts[ 36 ];
+  ++current.calls;
+  return real_glGetError();
+}
+
+static PFNGLGETFLOATVPROC real_glGetFloatv;
+static void APIENTRY stats_glGetFloatv( GLenum pname, GLfloat *data ) {
+
+  ++counts[ 37 ];
+  ++current.calls;
+  real_glGetFloatv( pname, data );
+}
+
+static PFNGLGETINTEGERVPROC real_glGetIntegerv;
+static void APIENTRY stats_glGetIntegerv( GLenum pname, GLint *data ) {
+
+  ++counts[ 38 ];
+  ++current.calls;
+  real_glGetIntegerv( pname, data );
+}
+
+static PFNGLGETSTRINGPROC real_glGetString;
+static const GLubyte * APIENTRY stats_glGetString( GLenum name ) {
+
+  ++counts[ 39 ];
+  ++current.calls;
+  return real_glGetString( name );
+}
+
+static PFNGLGETTEXIMAGEPROC real_glGetTexImage;
+static void APIENTRY stats_glGetTexImage( GLenum target, GLint level, GLenum format, GLenum type, void *pixels ) {
+
+  ++counts[ 40 ];
+  ++current.calls;
+  real_glGetTexImage( target, level, format, type, pixels );
+}
+
+static PFNGLGETTEXPARAMETERFVPROC real_glGetTexParameterfv;
+static void APIENTRY stats_glGetTexParameterfv( GLenum target, GLenum pname, GLfloat *params ) {
+
+  ++counts[ 41 ];
+  ++current.calls;
+  real_glGetTexParameterfv( target, pname, params );
+}
+
+static PFNGLGETTEXPARAMETERIVPROC real_glGetTexParameteriv;
+static void APIENTRY stats_glGetTexParameteriv( GLenum target, GLenum pname, GLint *params ) {
+
+  ++counts[ 42 ];
+  ++current.calls;
+  real_glGetTexParameteriv( target, pname, params );
+}
+
+static PFNGLGETTEXLEVELPARAMETERFVPROC real_glGetTexLevelParameterfv;
+static void APIENTRY stats_glGetTexLevelParameterfv( GLenum target, GLint level, GLenum pname, GLfloat *params ) {
+
+  ++counts[ 43 ];
+  ++current.calls;
+  real_glGetTexLevelParameterfv( target, level, pname, params );
+}
+
+static PFNGLGETTEXLEVELPARAMETERIVPROC real_glGetTexLevelParameteriv;
+static void APIENTRY stats_glGetTexLevelParameteriv( GLenum target, GLint level, GLenum pname, GLint *params ) {
+
+  ++counts[ 44 ];
+  ++current.calls;
+  real_glGetTexLevelParameteriv( target, level, pname, params );
+}
+
+static PFNGLISENABLEDPROC real_glIsEnabled;
+static GLboolean APIENTRY stats_glIsEnabled( GLenum cap ) {
+
+  ++counts[ 45 ];
+  ++current.calls;
+  return real_glIsEnabled( cap );
+}
+
+static PFNGLDEPTHRANGEPROC real_glDepthRange;
+static void APIENTRY stats_glDepthRange( GLdouble near, GLdouble far ) {
+
+  ++counts[ 46 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glDepthRange( near, far );
+}
+
+static PFNGLVIEWPORTPROC real_glViewport;
+static void APIENTRY stats_glViewport( GLint x, GLint y, GLsizei width, GLsizei height ) {
+
+  ++counts[ 47 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glViewport( x, y, width, height );
+}
+
+static PFNGLDRAWARRAYSPROC real_glDrawArrays;
+static void APIENTRY stats_glDrawArrays( GLenum mode, GLint first, GLsizei count ) {
+
+  ++counts[ 48 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawArrays( mode, first, count );
+}
+
+static PFNGLDRAWELEMENTSPROC real_glDrawElements;
+static void APIENTRY stats_glDrawElements( GLenum mode, GLsizei count, GLenum type, const void *indices ) {
+
+  ++counts[ 49 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawElements( mode, count, type, indices );
+}
+
+static PFNGLPOLYGONOFFSETPROC real_glPolygonOffset;
+static void APIENTRY stats_glPolygonOffset( GLfloat factor, GLfloat units ) {
+
+  ++counts[ 50 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glPolygonOffset( factor, units );
+}
+
+static PFNGLCOPYTEXIMAGE1DPROC real_glCopyTexImage1D;
+static void APIENTRY stats_glCopyTexImage1D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border ) {
+
+  ++counts[ 51 ];
+  ++current.calls;
+  real_glCopyTexImage1D( target, level, internalformat, x, y, width, border );
+}
+
+static PFNGLCOPYTEXIMAGE2DPROC real_glCopyTexImage2D;
+static void APIENTRY stats_glCopyTexImage2D( GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border ) {
+
+  ++counts[ 52 ];
+  ++current.calls;
+  real_glCopyTexImage2D( target, level, internalformat, x, y, width, height, border );
+}
+
+static PFNGLCOPYTEXSUBIMAGE1DPROC real_glCopyTexSubImage1D;
+static void APIENTRY stats_glCopyTexSubImage1D( GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width ) {
+
+  ++counts[ 53 ];
+  ++current.calls;
+  real_glCopyTexSubImage1D( target, level, xoffset, x, y, width );
+}
+
+static PFNGLCOPYTEXSUBIMAGE2DPROC real_glCopyTexSubImage2D;
+static void APIENTRY stats_glCopyTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height ) {
+
+  ++counts[ 54 ];
+  ++current.calls;
+  real_glCopyTexSubImage2D( target, level, xoffset, yoffset, x, y, width, height );
+}
+
+static PFNGLTEXSUBIMAGE1DPROC real_glTexSubImage1D;
+static void APIENTRY stats_glTexSubImage1D( GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels ) {
+
+  ++counts[ 55 ];
+  ++current.calls;
+  current.bytesUploaded += pixels ? texel_bytes( format, type ) * width : 0;
+  real_glTexSubImage1D( target, level, xoffset, width, format, type, pixels );
+}
+
+static PFNGLTEXSUBIMAGE2DPROC real_glTexSubImage2D;
+static void APIENTRY stats_glTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels ) {
+
+  ++counts[ 56 ];
+  ++current.calls;
+  current.bytesUploaded += pixels ? texel_bytes( format, type ) * width * height : 0;
+  real_glTexSubImage2D( target, level, xoffset, yoffset, width, height, format, type, pixels );
+}
+
+static PFNGLBINDTEXTUREPROC real_glBindTexture;
+static void APIENTRY stats_glBindTexture( GLenum target, GLuint texture ) {
+
+  ++counts[ 57 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindTexture( target, texture );
+}
+
+static PFNGLDELETETEXTURESPROC real_glDeleteTextures;
+static void APIENTRY stats_glDeleteTextures( GLsizei n, const GLuint *textures ) {
+
+  ++counts[ 58 ];
+  ++current.calls;
+  real_glDeleteTextures( n, textures );
+}
+
+static PFNGLGENTEXTURESPROC real_glGenTextures;
+static void APIENTRY stats_glGenTextures( GLsizei n, GLuint *textures ) {
+
+  ++counts[ 59 ];
+  ++current.calls;
+  real_glGenTextures( n, textures );
+}
+
+static PFNGLISTEXTUREPROC real_glIsTexture;
+static GLboolean APIENTRY stats_glIsTexture( GLuint texture ) {
+
+  ++counts[ 60 ];
+  ++current.calls;
+  return real_glIsTexture( texture );
+}
+
+static PFNGLDRAWRANGEELEMENTSPROC real_glDrawRangeElements;
+static void APIENTRY stats_glDrawRangeElements( GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices ) {
+
+  ++counts[ 61 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawRangeElements( mode, start, end, count, type, indices );
+}
+
+static PFNGLTEXIMAGE3DPROC real_glTexImage3D;
+static void APIENTRY stats_glTexImage3D( GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels ) {
+
+  ++counts[ 62 ];
+  ++current.calls;
+  current.bytesUploaded += pixels ? texel_bytes( format, type ) * width * height * depth : 0;
+  real_glTexImage3D( target, level, internalformat, width, height, depth, border, format, type, pixels );
+}
+
+static PFNGLTEXSUBIMAGE3DPROC real_glTexSubImage3D;
+static void APIENTRY stats_glTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels ) {
+
+  ++counts[ 63 ];
+  ++current.calls;
+  current.bytesUploaded += pixels ? texel_bytes( format, type ) * width * height * depth : 0;
+  real_glTexSubImage3D( target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels );
+}
+
+static PFNGLCOPYTEXSUBIMAGE3DPROC real_glCopyTexSubImage3D;
+static void APIENTRY stats_glCopyTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height ) {
+
+  ++counts[ 64 ];
+  ++current.calls;
+  real_glCopyTexSubImage3D( target, level, xoffset, yoffset, zoffset, x, y, width, height );
+}
+
+static PFNGLACTIVETEXTUREPROC real_glActiveTexture;
+static void APIENTRY stats_glActiveTexture( GLenum texture ) {
+
+  ++counts[ 65 ];
+  ++current.calls;
+  real_glActiveTexture( texture );
+}
+
+static PFNGLSAMPLECOVERAGEPROC real_glSampleCoverage;
+static void APIENTRY stats_glSampleCoverage( GLfloat value, GLboolean invert ) {
+
+  ++counts[ 66 ];
+  ++current.calls;
+  real_glSampleCoverage( value, invert );
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC real_glCompressedTexImage3D;
+static void APIENTRY stats_glCompressedTexImage3D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data ) {
+
+  ++counts[ 67 ];
+  ++current.calls;
+  current.bytesUploaded += (unsigned long long) imageSize;
+  real_glCompressedTexImage3D( target, level, internalformat, width, height, depth, border, imageSize, data );
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC real_glCompressedTexImage2D;
+static void APIENTRY stats_glCompressedTexImage2D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data ) {
+
+  ++counts[ 68 ];
+  ++current.calls;
+  current.bytesUploaded += (unsigned long long) imageSize;
+  real_glCompressedTexImage2D( target, level, internalformat, width, height, border, imageSize, data );
+}
+
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC real_glCompressedTexImage1D;
+static void APIENTRY stats_glCompressedTexImage1D( GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data ) {
+
+  ++counts[ 69 ];
+  ++current.calls;
+  current.bytesUploaded += (unsigned long long) imageSize;
+  real_glCompressedTexImage1D( target, level, internalformat, width, border, imageSize, data );
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC real_glCompressedTexSubImage3D;
+static void APIENTRY stats_glCompressedTexSubImage3D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data ) {
+
+  ++counts[ 70 ];
+  ++current.calls;
+  current.bytesUploaded += (unsigned long long) imageSize;
+  real_glCompressedTexSubImage3D( target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data );
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC real_glCompressedTexSubImage2D;
+static void APIENTRY stats_glCompressedTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data ) {
+
+  ++counts[ 71 ];
+  ++current.calls;
+  current.bytesUploaded += (unsigned long long) imageSize;
+  real_glCompressedTexSubImage2D( target, level, xoffset, yoffset, width, height, format, imageSize, data );
+}
+
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC real_glCompressedTexSubImage1D;
+static void APIENTRY stats_glCompressedTexSubImage1D( GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data ) {
+
+  ++counts[ 72 ];
+  ++current.calls;
+  current.bytesUploaded += (unsigned long long) imageSize;
+  real_glCompressedTexSubImage1D( target, level, xoffset, width, format, imageSize, data );
+}
+
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC real_glGetCompressedTexImage;
+static void APIENTRY stats_glGetCompressedTexImage( GLenum target, GLint level, void *img ) {
+
+  ++counts[ 73 ];
+  ++current.calls;
+  real_glGetCompressedTexImage( target, level, img );
+}
+
+static PFNGLBLENDFUNCSEPARATEPROC real_glBlendFuncSeparate;
+static void APIENTRY stats_glBlendFuncSeparate( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha ) {
+
+  ++counts[ 74 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glBlendFuncSeparate( sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
+}
+
+static PFNGLMULTIDRAWARRAYSPROC real_glMultiDrawArrays;
+static void APIENTRY stats_glMultiDrawArrays( GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount ) {
+
+  ++counts[ 75 ];
+  ++current.calls;
+  ++current.draws;
+  real_glMultiDrawArrays( mode, first, count, drawcount );
+}
+
+static PFNGLMULTIDRAWELEMENTSPROC real_glMultiDrawElements;
+static void APIENTRY stats_glMultiDrawElements( GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount ) {
+
+  ++counts[ 76 ];
+  ++current.calls;
+  ++current.draws;
+  real_glMultiDrawElements( mode, count, type, indices, drawcount );
+}
+
+static PFNGLPOINTPARAMETERFPROC real_glPointParameterf;
+static void APIENTRY stats_glPointParameterf( GLenum pname, GLfloat param ) {
+
+  ++counts[ 77 ];
+  ++current.calls;
+  real_glPointParameterf( pname, param );
+}
+
+static PFNGLPOINTPARAMETERFVPROC real_glPointParameterfv;
+static void APIENTRY stats_glPointParameterfv( GLenum pname, const GLfloat *params ) {
+
+  ++counts[ 78 ];
+  ++current.calls;
+  real_glPointParameterfv( pname, params );
+}
+
+static PFNGLPOINTPARAMETERIPROC real_glPointParameteri;
+static void APIENTRY stats_glPointParameteri( GLenum pname, GLint param ) {
+
+  ++counts[ 79 ];
+  ++current.calls;
+  real_glPointParameteri( pname, param );
+}
+
+static PFNGLPOINTPARAMETERIVPROC real_glPointParameteriv;
+static void APIENTRY stats_glPointParameteriv( GLenum pname, const GLint *params ) {
+
+  ++counts[ 80 ];
+  ++current.calls;
+  real_glPointParameteriv( pname, params );
+}
+
+static PFNGLBLENDCOLORPROC real_glBlendColor;
+static void APIENTRY stats_glBlendColor( GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ) {
+
+  ++counts[ 81 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glBlendColor( red, green, blue, alpha );
+}
+
+static PFNGLBLENDEQUATIONPROC real_glBlendEquation;
+static void APIENTRY stats_glBlendEquation( GLenum mode ) {
+
+  ++counts[ 82 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glBlendEquation( mode );
+}
+
+static PFNGLGENQUERIESPROC real_glGenQueries;
+static void APIENTRY stats_glGenQueries( GLsizei n, GLuint *ids ) {
+
+  ++counts[ 83 ];
+  ++current.calls;
+  real_glGenQueries( n, ids );
+}
+
+static PFNGLDELETEQUERIESPROC real_glDeleteQueries;
+static void APIENTRY stats_glDeleteQueries( GLsizei n, const GLuint *ids ) {
+
+  ++counts[ 84 ];
+  ++current.calls;
+  real_glDeleteQueries( n, ids );
+}
+
+static PFNGLISQUERYPROC real_glIsQuery;
+static GLboolean APIENTRY stats_glIsQuery( GLuint id ) {
+
+  ++counts[ 85 ];
+  ++current.calls;
+  return real_glIsQuery( id );
+}
+
+static PFNGLBEGINQUERYPROC real_glBeginQuery;
+static void APIENTRY stats_glBeginQuery( GLenum target, GLuint id ) {
+
+  ++counts[ 86 ];
+  ++current.calls;
+  real_glBeginQuery( target, id );
+}
+
+static PFNGLENDQUERYPROC real_glEndQuery;
+static void APIENTRY stats_glEndQuery( GLenum target ) {
+
+  ++counts[ 87 ];
+  ++current.calls;
+  real_glEndQuery( target );
+}
+
+static PFNGLGETQUERYIVPROC real_glGetQueryiv;
+static void APIENTRY stats_glGetQueryiv( GLenum target, GLenum pname, GLint *params ) {
+
+  ++counts[ 88 ];
+  ++current.calls;
+  real_glGetQueryiv( target, pname, params );
+}
+
+static PFNGLGETQUERYOBJECTIVPROC real_glGetQueryObjectiv;
+static void APIENTRY stats_glGetQueryObjectiv( GLuint id, GLenum pname, GLint *params ) {
+
+  ++counts[ 89 ];
+  ++current.calls;
+  real_glGetQueryObjectiv( id, pname, params );
+}
+
+static PFNGLGETQUERYOBJECTUIVPROC real_glGetQueryObjectuiv;
+static void APIENTRY stats_glGetQueryObjectuiv( GLuint id, GLenum pname, GLuint *params ) {
+
+  ++counts[ 90 ];
+  ++current.calls;
+  real_glGetQueryObjectuiv( id, pname, params );
+}
+
+static PFNGLBINDBUFFERPROC real_glBindBuffer;
+static void APIENTRY stats_glBindBuffer( GLenum target, GLuint buffer ) {
+
+  ++counts[ 91 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindBuffer( target, buffer );
+}
+
+static PFNGLDELETEBUFFERSPROC real_glDeleteBuffers;
+static void APIENTRY stats_glDeleteBuffers( GLsizei n, const GLuint *buffers ) {
+
+  ++counts[ 92 ];
+  ++current.calls;
+  real_glDeleteBuffers( n, buffers );
+}
+
+static PFNGLGENBUFFERSPROC real_glGenBuffers;
+static void APIENTRY stats_glGenBuffers( GLsizei n, GLuint *buffers ) {
+
+  ++counts[ 93 ];
+  ++current.calls;
+  real_glGenBuffers( n, buffers );
+}
+
+static PFNGLISBUFFERPROC real_glIsBuffer;
+static GLboolean APIENTRY stats_glIsBuffer( GLuint buffer ) {
+
+  ++counts[ 94 ];
+  ++current.calls;
+  return real_glIsBuffer( buffer );
+}
+
+static PFNGLBUFFERDATAPROC real_glBufferData;
+static void APIENTRY stats_glBufferData( GLenum target, GLsizeiptr size, const void *data, GLenum usage ) {
+
+  ++counts[ 95 ];
+  ++current.calls;
+  current.bytesUploaded += data ? (unsigned long long) size : 0;
+  real_glBufferData( target, size, data, usage );
+}
+
+static PFNGLBUFFERSUBDATAPROC real_glBufferSubData;
+static void APIENTRY stats_glBufferSubData( GLenum target, GLintptr offset, GLsizeiptr size, const void *data ) {
+
+  ++counts[ 96 ];
+  ++current.calls;
+  current.bytesUploaded += data ? (unsigned long long) size : 0;
+  real_glBufferSubData( target, offset, size, data );
+}
+
+static PFNGLGETBUFFERSUBDATAPROC real_glGetBufferSubData;
+static void APIENTRY stats_glGetBufferSubData( GLenum target, GLintptr offset, GLsizeiptr size, void *data ) {
+
+  ++counts[ 97 ];
+  ++current.calls;
+  real_glGetBufferSubData( target, offset, size, data );
+}
+
+static PFNGLMAPBUFFERPROC real_glMapBuffer;
+static void * APIENTRY stats_glMapBuffer( GLenum target, GLenum access ) {
+
+  ++counts[ 98 ];
+  ++current.calls;
+  return real_glMapBuffer( target, access );
+}
+
+static PFNGLUNMAPBUFFERPROC real_glUnmapBuffer;
+static GLboolean APIENTRY stats_glUnmapBuffer( GLenum target ) {
+
+  ++counts[ 99 ];
+  ++current.calls;
+  return real_glUnmapBuffer( target );
+}
+
+static PFNGLGETBUFFERPARAMETERIVPROC real_glGetBufferParameteriv;
+static void APIENTRY stats_glGetBufferParameteriv( GLenum target, GLenum pname, GLint *params ) {
+
+  ++counts[ 100 ];
+  ++current.calls;
+  real_glGetBufferParameteriv( target, pname, params );
+}
+
+static PFNGLGETBUFFERPOINTERVPROC real_glGetBufferPointerv;
+static void APIENTRY stats_glGetBufferPointerv( GLenum target, GLenum pname, void **params ) {
+
+  ++counts[ 101 ];
+  ++current.calls;
+  real_glGetBufferPointerv( target, pname, params );
+}
+
+static PFNGLBLENDEQUATIONSEPARATEPROC real_glBlendEquationSeparate;
+static void APIENTRY stats_glBlendEquationSeparate( GLenum modeRGB, GLenum modeAlpha ) {
+
+  ++counts[ 102 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glBlendEquationSeparate( modeRGB, modeAlpha );
+}
+
+static PFNGLDRAWBUFFERSPROC real_glDrawBuffers;
+static void APIENTRY stats_glDrawBuffers( GLsizei n, const GLenum *bufs ) {
+
+  ++counts[ 103 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawBuffers( n, bufs );
+}
+
+static PFNGLSTENCILOPSEPARATEPROC real_glStencilOpSeparate;
+static void APIENTRY stats_glStencilOpSeparate( GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass ) {
+
+  ++counts[ 104 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glStencilOpSeparate( face, sfail, dpfail, dppass );
+}
+
+static PFNGLSTENCILFUNCSEPARATEPROC real_glStencilFuncSeparate;
+static void APIENTRY stats_glStencilFuncSeparate( GLenum face, GLenum func, GLint ref, GLuint mask ) {
+
+  ++counts[ 105 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glStencilFuncSeparate( face, func, ref, mask );
+}
+
+static PFNGLSTENCILMASKSEPARATEPROC real_glStencilMaskSeparate;
+static void APIENTRY stats_glStencilMaskSeparate( GLenum face, GLuint mask ) {
+
+  ++counts[ 106 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glStencilMaskSeparate( face, mask );
+}
+
+static PFNGLATTACHSHADERPROC real_glAttachShader;
+static void APIENTRY stats_glAttachShader( GLuint program, GLuint shader ) {
+
+  ++counts[ 107 ];
+  ++current.calls;
+  real_glAttachShader( program, shader );
+}
+
+static PFNGLBINDATTRIBLOCATIONPROC real_glBindAttribLocation;
+static void APIENTRY stats_glBindAttribLocation( GLuint program, GLuint index, const GLchar *name ) {
+
+  ++counts[ 108 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindAttribLocation( program, index, name );
+}
+
+static PFNGLCOMPILESHADERPROC real_glCompileShader;
+static void APIENTRY stats_glCompileShader( GLuint shader ) {
+
+  ++counts[ 109 ];
+  ++current.calls;
+  real_glCompileShader( shader );
+}
+
+static PFNGLCREATEPROGRAMPROC real_glCreateProgram;
+static GLuint APIENTRY stats_glCreateProgram( void ) {
+
+  ++counts[ 110 ];
+  ++current.calls;
+  return real_glCreateProgram();
+}
+
+static PFNGLCREATESHADERPROC real_glCreateShader;
+static GLuint APIENTRY stats_glCreateShader( GLenum type ) {
+
+  ++counts[ 111 ];
+  ++current.calls;
+  return real_glCreateShader( type );
+}
+
+static PFNGLDELETEPROGRAMPROC real_glDeleteProgram;
+static void APIENTRY stats_glDeleteProgram( GLuint program ) {
+
+  ++counts[ 112 ];
+  ++current.calls;
+  real_glDeleteProgram( program );
+}
+
+static PFNGLDELETESHADERPROC real_glDeleteShader;
+static void APIENTRY stats_glDeleteShader( GLuint shader ) {
+
+  ++counts[ 113 ];
+  ++current.calls;
+  real_glDeleteShader( shader );
+}
+
+static PFNGLDETACHSHADERPROC real_glDetachShader;
+static void APIENTRY stats_glDetachShader( GLuint program, GLuint shader ) {
+
+  ++counts[ 114 ];
+  ++current.calls;
+  real_glDetachShader( program, shader );
+}
+
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC real_glDisableVertexAttribArray;
+static void APIENTRY stats_glDisableVertexAttribArray( GLuint index ) {
+
+  ++counts[ 115 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glDisableVertexAttribArray( index );
+}
+
+static PFNGLENABLEVERTEXATTRIBARRAYPROC real_glEnableVertexAttribArray;
+static void APIENTRY stats_glEnableVertexAttribArray( GLuint index ) {
+
+  ++counts[ 116 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glEnableVertexAttribArray( index );
+}
+
+static PFNGLGETACTIVEATTRIBPROC real_glGetActiveAttrib;
+static void APIENTRY stats_glGetActiveAttrib( GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name ) {
+
+  ++counts[ 117 ];
+  ++current.calls;
+  real_glGetActiveAttrib( program, index, bufSize, length, size, type, name );
+}
+
+static PFNGLGETACTIVEUNIFORMPROC real_glGetActiveUniform;
+static void APIENTRY stats_glGetActiveUniform( GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name ) {
+
+  ++counts[ 118 ];
+  ++current.calls;
+  real_glGetActiveUniform( program, index, bufSize, length, size, type, name );
+}
+
+static PFNGLGETATTACHEDSHADERSPROC real_glGetAttachedShaders;
+static void APIENTRY stats_glGetAttachedShaders( GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders ) {
+
+  ++counts[ 119 ];
+  ++current.calls;
+  real_glGetAttachedShaders( program, maxCount, count, shaders );
+}
+
+static PFNGLGETATTRIBLOCATIONPROC real_glGetAttribLocation;
+static GLint APIENTRY stats_glGetAttribLocation( GLuint program, const GLchar *name ) {
+
+  ++counts[ 120 ];
+  ++current.calls;
+  return real_glGetAttribLocation( program, name );
+}
+
+static PFNGLGETPROGRAMIVPROC real_glGetProgramiv;
+static void APIENTRY stats_glGetProgramiv( GLuint program, GLenum pname, GLint *params ) {
+
+  ++counts[ 121 ];
+  ++current.calls;
+  real_glGetProgramiv( program, pname, params );
+}
+
+static PFNGLGETPROGRAMINFOLOGPROC real_glGetProgramInfoLog;
+static void APIENTRY stats_glGetProgramInfoLog( GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog ) {
+
+  ++counts[ 122 ];
+  ++current.calls;
+  real_glGetProgramInfoLog( program, bufSize, length, infoLog );
+}
+
+static PFNGLGETSHADERIVPROC real_glGetShaderiv;
+static void APIENTRY stats_glGetShaderiv( GLuint shader, GLenum pname, GLint *params ) {
+
+  ++counts[ 123 ];
+  ++current.calls;
+  real_glGetShaderiv( shader, pname, params );
+}
+
+static PFNGLGETSHADERINFOLOGPROC real_glGetShaderInfoLog;
+static void APIENTRY stats_glGetShaderInfoLog( GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog ) {
+
+  ++counts[ 124 ];
+  ++current.calls;
+  real_glGetShaderInfoLog( shader, bufSize, length, infoLog );
+}
+
+static PFNGLGETSHADERSOURCEPROC real_glGetShaderSource;
+static void APIENTRY stats_glGetShaderSource( GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source ) {
+
+  ++counts[ 125 ];
+  ++current.calls;
+  real_glGetShaderSource( shader, bufSize, length, source );
+}
+
+static PFNGLGETUNIFORMLOCATIONPROC real_glGetUniformLocation;
+static GLint APIENTRY stats_glGetUniformLocation( GLuint program, const GLchar *name ) {
+
+  ++counts[ 126 ];
+  ++current.calls;
+  return real_glGetUniformLocation( program, name );
+}
+
+static PFNGLGETUNIFORMFVPROC real_glGetUniformfv;
+static void APIENTRY stats_glGetUniformfv( GLuint program, GLint location, GLfloat *params ) {
+
+  ++counts[ 127 ];
+  ++current.calls;
+  real_glGetUniformfv( program, location, params );
+}
+
+static PFNGLGETUNIFORMIVPROC real_glGetUniformiv;
+static void APIENTRY stats_glGetUniformiv( GLuint program, GLint location, GLint *params ) {
+
+  ++counts[ 128 ];
+  ++current.calls;
+  real_glGetUniformiv( program, location, params );
+}
+
+static PFNGLGETVERTEXATTRIBDVPROC real_glGetVertexAttribdv;
+static void APIENTRY stats_glGetVertexAttribdv( GLuint index, GLenum pname, GLdouble *params ) {
+
+  ++counts[ 129 ];
+  ++current.calls;
+  real_glGetVertexAttribdv( index, pname, params );
+}
+
+static PFNGLGETVERTEXATTRIBFVPROC real_glGetVertexAttribfv;
+static void APIENTRY stats_glGetVertexAttribfv( GLuint index, GLenum pname, GLfloat *params ) {
+
+  ++counts[ 130 ];
+  ++current.calls;
+  real_glGetVertexAttribfv( index, pname, params );
+}
+
+static PFNGLGETVERTEXATTRIBIVPROC real_glGetVertexAttribiv;
+static void APIENTRY stats_glGetVertexAttribiv( GLuint index, GLenum pname, GLint *params ) {
+
+  ++counts[ 131 ];
+  ++current.calls;
+  real_glGetVertexAttribiv( index, pname, params );
+}
+
+static PFNGLGETVERTEXATTRIBPOINTERVPROC real_glGetVertexAttribPointerv;
+static void APIENTRY stats_glGetVertexAttribPointerv( GLuint index, GLenum pname, void **pointer ) {
+
+  ++counts[ 132 ];
+  ++current.calls;
+  real_glGetVertexAttribPointerv( index, pname, pointer );
+}
+
+static PFNGLISPROGRAMPROC real_glIsProgram;
+static GLboolean APIENTRY stats_glIsProgram( GLuint program ) {
+
+  ++counts[ 133 ];
+  ++current.calls;
+  return real_glIsProgram( program );
+}
+
+static PFNGLISSHADERPROC real_glIsShader;
+static GLboolean APIENTRY stats_glIsShader( GLuint shader ) {
+
+  ++counts[ 134 ];
+  ++current.calls;
+  return real_glIsShader( shader );
+}
+
+static PFNGLLINKPROGRAMPROC real_glLinkProgram;
+static void APIENTRY stats_glLinkProgram( GLuint program ) {
+
+  ++counts[ 135 ];
+  ++current.calls;
+  real_glLinkProgram( program );
+}
+
+static PFNGLSHADERSOURCEPROC real_glShaderSource;
+static void APIENTRY stats_glShaderSource( GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length ) {
+
+  ++counts[ 136 ];
+  ++current.calls;
+  real_glShaderSource( shader, count, string, length );
+}
+
+static PFNGLUSEPROGRAMPROC real_glUseProgram;
+static void APIENTRY stats_glUseProgram( GLuint program ) {
+
+  ++counts[ 137 ];
+  ++current.calls;
+  ++current.binds;
+  real_glUseProgram( program );
+}
+
+static PFNGLUNIFORM1FPROC real_glUniform1f;
+static void APIENTRY stats_glUniform1f( GLint location, GLfloat v0 ) {
+
+  ++counts[ 138 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform1f( location, v0 );
+}
+
+static PFNGLUNIFORM2FPROC real_glUniform2f;
+static void APIENTRY stats_glUniform2f( GLint location, GLfloat v0, GLfloat v1 ) {
+
+  ++counts[ 139 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform2f( location, v0, v1 );
+}
+
+static PFNGLUNIFORM3FPROC real_glUniform3f;
+static void APIENTRY stats_glUniform3f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2 ) {
+
+  ++counts[ 140 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform3f( location, v0, v1, v2 );
+}
+
+static PFNGLUNIFORM4FPROC real_glUniform4f;
+static void APIENTRY stats_glUniform4f( GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 ) {
+
+  ++counts[ 141 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform4f( location, v0, v1, v2, v3 );
+}
+
+static PFNGLUNIFORM1IPROC real_glUniform1i;
+static void APIENTRY stats_glUniform1i( GLint location, GLint v0 ) {
+
+  ++counts[ 142 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform1i( location, v0 );
+}
+
+static PFNGLUNIFORM2IPROC real_glUniform2i;
+static void APIENTRY stats_glUniform2i( GLint location, GLint v0, GLint v1 ) {
+
+  ++counts[ 143 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform2i( location, v0, v1 );
+}
+
+static PFNGLUNIFORM3IPROC real_glUniform3i;
+static void APIENTRY stats_glUniform3i( GLint location, GLint v0, GLint v1, GLint v2 ) {
+
+  ++counts[ 144 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform3i( location, v0, v1, v2 );
+}
+
+static PFNGLUNIFORM4IPROC real_glUniform4i;
+static void APIENTRY stats_glUniform4i( GLint location, GLint v0, GLint v1, GLint v2, GLint v3 ) {
+
+  ++counts[ 145 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform4i( location, v0, v1, v2, v3 );
+}
+
+static PFNGLUNIFORM1FVPROC real_glUniform1fv;
+static void APIENTRY stats_glUniform1fv( GLint location, GLsizei count, const GLfloat *value ) {
+
+  ++counts[ 146 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform1fv( location, count, value );
+}
+
+static PFNGLUNIFORM2FVPROC real_glUniform2fv;
+static void APIENTRY stats_glUniform2fv( GLint location, GLsizei count, const GLfloat *value ) {
+
+  ++counts[ 147 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform2fv( location, count, value );
+}
+
+static PFNGLUNIFORM3FVPROC real_glUniform3fv;
+static void APIENTRY stats_glUniform3fv( GLint location, GLsizei count, const GLfloat *value ) {
+
+  ++counts[ 148 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform3fv( location, count, value );
+}
+
+static PFNGLUNIFORM4FVPROC real_glUniform4fv;
+static void APIENTRY stats_glUniform4fv( GLint location, GLsizei count, const GLfloat *value ) {
+
+  ++counts[ 149 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform4fv( location, count, value );
+}
+
+static PFNGLUNIFORM1IVPROC real_glUniform1iv;
+static void APIENTRY stats_glUniform1iv( GLint location, GLsizei count, const GLint *value ) {
+
+  ++counts[ 150 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform1iv( location, count, value );
+}
+
+static PFNGLUNIFORM2IVPROC real_glUniform2iv;
+static void APIENTRY stats_glUniform2iv( GLint location, GLsizei count, const GLint *value ) {
+
+  ++counts[ 151 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform2iv( location, count, value );
+}
+
+static PFNGLUNIFORM3IVPROC real_glUniform3iv;
+static void APIENTRY stats_glUniform3iv( GLint location, GLsizei count, const GLint *value ) {
+
+  ++counts[ 152 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform3iv( location, count, value );
+}
+
+static PFNGLUNIFORM4IVPROC real_glUniform4iv;
+static void APIENTRY stats_glUniform4iv( GLint location, GLsizei count, const GLint *value ) {
+
+  ++counts[ 153 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform4iv( location, count, value );
+}
+
+static PFNGLUNIFORMMATRIX2FVPROC real_glUniformMatrix2fv;
+static void APIENTRY stats_glUniformMatrix2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 154 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix2fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX3FVPROC real_glUniformMatrix3fv;
+static void APIENTRY stats_glUniformMatrix3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 155 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix3fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX4FVPROC real_glUniformMatrix4fv;
+static void APIENTRY stats_glUniformMatrix4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 156 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix4fv( location, count, transpose, value );
+}
+
+static PFNGLVALIDATEPROGRAMPROC real_glValidateProgram;
+static void APIENTRY stats_glValidateProgram( GLuint program ) {
+
+  ++counts[ 157 ];
+  ++current.calls;
+  real_glValidateProgram( program );
+}
+
+static PFNGLVERTEXATTRIB1DPROC real_glVertexAttrib1d;
+static void APIENTRY stats_glVertexAttrib1d( GLuint index, GLdouble x ) {
+
+  ++counts[ 158 ];
+  ++current.calls;
+  real_glVertexAttrib1d( index, x );
+}
+
+static PFNGLVERTEXATTRIB1DVPROC real_glVertexAttrib1dv;
+static void APIENTRY stats_glVertexAttrib1dv( GLuint index, const GLdouble *v ) {
+
+  ++counts[ 159 ];
+  ++current.calls;
+  real_glVertexAttrib1dv( index, v );
+}
+
+static PFNGLVERTEXATTRIB1FPROC real_glVertexAttrib1f;
+static void APIENTRY stats_glVertexAttrib1f( GLuint index, GLfloat x ) {
+
+  ++counts[ 160 ];
+  ++current.calls;
+  real_glVertexAttrib1f( index, x );
+}
+
+static PFNGLVERTEXATTRIB1FVPROC real_glVertexAttrib1fv;
+static void APIENTRY stats_glVertexAttrib1fv( GLuint index, const GLfloat *v ) {
+
+  ++counts[ 161 ];
+  ++current.calls;
+  real_glVertexAttrib1fv( index, v );
+}
+
+static PFNGLVERTEXATTRIB1SPROC real_glVertexAttrib1s;
+static void APIENTRY stats_glVertexAttrib1s( GLuint index, GLshort x ) {
+
+  ++counts[ 162 ];
+  ++current.calls;
+  real_glVertexAttrib1s( index, x );
+}
+
+static PFNGLVERTEXATTRIB1SVPROC real_glVertexAttrib1sv;
+static void APIENTRY stats_glVertexAttrib1sv( GLuint index, const GLshort *v ) {
+
+  ++counts[ 163 ];
+  ++current.calls;
+  real_glVertexAttrib1sv( index, v );
+}
+
+static PFNGLVERTEXATTRIB2DPROC real_glVertexAttrib2d;
+static void APIENTRY stats_glVertexAttrib2d( GLuint index, GLdouble x, GLdouble y ) {
+
+  ++counts[ 164 ];
+  ++current.calls;
+  real_glVertexAttrib2d( index, x, y );
+}
+
+static PFNGLVERTEXATTRIB2DVPROC real_glVertexAttrib2dv;
+static void APIENTRY stats_glVertexAttrib2dv( GLuint index, const GLdouble *v ) {
+
+  ++counts[ 165 ];
+  ++current.calls;
+  real_glVertexAttrib2dv( index, v );
+}
+
+static PFNGLVERTEXATTRIB2FPROC real_glVertexAttrib2f;
+static void APIENTRY stats_glVertexAttrib2f( GLuint index, GLfloat x, GLfloat y ) {
+
+  ++counts[ 166 ];
+  ++current.calls;
+  real_glVertexAttrib2f( index, x, y );
+}
+
+static PFNGLVERTEXATTRIB2FVPROC real_glVertexAttrib2fv;
+static void APIENTRY stats_glVertexAttrib2fv( GLuint index, const GLfloat *v ) {
+
+  ++counts[ 167 ];
+  ++current.calls;
+  real_glVertexAttrib2fv( index, v );
+}
+
+static PFNGLVERTEXATTRIB2SPROC real_glVertexAttrib2s;
+static void APIENTRY stats_glVertexAttrib2s( GLuint index, GLshort x, GLshort y ) {
+
+  ++counts[ 168 ];
+  ++current.calls;
+  real_glVertexAttrib2s( index, x, y );
+}
+
+static PFNGLVERTEXATTRIB2SVPROC real_glVertexAttrib2sv;
+static void APIENTRY stats_glVertexAttrib2sv( GLuint index, const GLshort *v ) {
+
+  ++counts[ 169 ];
+  ++current.calls;
+  real_glVertexAttrib2sv( index, v );
+}
+
+static PFNGLVERTEXATTRIB3DPROC real_glVertexAttrib3d;
+static void APIENTRY stats_glVertexAttrib3d( GLuint index, GLdouble x, GLdouble y, GLdouble z ) {
+
+  ++counts[ 170 ];
+  ++current.calls;
+  real_glVertexAttrib3d( index, x, y, z );
+}
+
+static PFNGLVERTEXATTRIB3DVPROC real_glVertexAttrib3dv;
+static void APIENTRY stats_glVertexAttrib3dv( GLuint index, const GLdouble *v ) {
+
+  ++counts[ 171 ];
+  ++current.calls;
+  real_glVertexAttrib3dv( index, v );
+}
+
+static PFNGLVERTEXATTRIB3FPROC real_glVertexAttrib3f;
+static void APIENTRY stats_glVertexAttrib3f( GLuint index, GLfloat x, GLfloat y, GLfloat z ) {
+
+  ++counts[ 172 ];
+  ++current.calls;
+  real_glVertexAttrib3f( index, x, y, z );
+}
+
+static PFNGLVERTEXATTRIB3FVPROC real_glVertexAttrib3fv;
+static void APIENTRY stats_glVertexAttrib3fv( GLuint index, const GLfloat *v ) {
+
+  ++counts[ 173 ];
+  ++current.calls;
+  real_glVertexAttrib3fv( index, v );
+}
+
+static PFNGLVERTEXATTRIB3SPROC real_glVertexAttrib3s;
+static void APIENTRY stats_glVertexAttrib3s( GLuint index, GLshort x, GLshort y, GLshort z ) {
+
+  ++counts[ 174 ];
+  ++current.calls;
+  real_glVertexAttrib3s( index, x, y, z );
+}
+
+static PFNGLVERTEXATTRIB3SVPROC real_glVertexAttrib3sv;
+static void APIENTRY stats_glVertexAttrib3sv( GLuint index, const GLshort *v ) {
+
+  ++counts[ 175 ];
+  ++current.calls;
+  real_glVertexAttrib3sv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4NBVPROC real_glVertexAttrib4Nbv;
+static void APIENTRY stats_glVertexAttrib4Nbv( GLuint index, const GLbyte *v ) {
+
+  ++counts[ 176 ];
+  ++current.calls;
+  real_glVertexAttrib4Nbv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4NIVPROC real_glVertexAttrib4Niv;
+static void APIENTRY stats_glVertexAttrib4Niv( GLuint index, const GLint *v ) {
+
+  ++counts[ 177 ];
+  ++current.calls;
+  real_glVertexAttrib4Niv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4NSVPROC real_glVertexAttrib4Nsv;
+static void APIENTRY stats_glVertexAttrib4Nsv( GLuint index, const GLshort *v ) {
+
+  ++counts[ 178 ];
+  ++current.calls;
+  real_glVertexAttrib4Nsv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4NUBPROC real_glVertexAttrib4Nub;
+static void APIENTRY stats_glVertexAttrib4Nub( GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w ) {
+
+  ++counts[ 179 ];
+  ++current.calls;
+  real_glVertexAttrib4Nub( index, x, y, z, w );
+}
+
+static PFNGLVERTEXATTRIB4NUBVPROC real_glVertexAttrib4Nubv;
+static void APIENTRY stats_glVertexAttrib4Nubv( GLuint index, const GLubyte *v ) {
+
+  ++counts[ 180 ];
+  ++current.calls;
+  real_glVertexAttrib4Nubv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4NUIVPROC real_glVertexAttrib4Nuiv;
+static void APIENTRY stats_glVertexAttrib4Nuiv( GLuint index, const GLuint *v ) {
+
+  ++counts[ 181 ];
+  ++current.calls;
+  real_glVertexAttrib4Nuiv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4NUSVPROC real_glVertexAttrib4Nusv;
+static void APIENTRY stats_glVertexAttrib4Nusv( GLuint index, const GLushort *v ) {
+
+  ++counts[ 182 ];
+  ++current.calls;
+  real_glVertexAttrib4Nusv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4BVPROC real_glVertexAttrib4bv;
+static void APIENTRY stats_glVertexAttrib4bv( GLuint index, const GLbyte *v ) {
+
+  ++counts[ 183 ];
+  ++current.calls;
+  real_glVertexAttrib4bv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4DPROC real_glVertexAttrib4d;
+static void APIENTRY stats_glVertexAttrib4d( GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w ) {
+
+  ++counts[ 184 ];
+  ++current.calls;
+  real_glVertexAttrib4d( index, x, y, z, w );
+}
+
+static PFNGLVERTEXATTRIB4DVPROC real_glVertexAttrib4dv;
+static void APIENTRY stats_glVertexAttrib4dv( GLuint index, const GLdouble *v ) {
+
+  ++counts[ 185 ];
+  ++current.calls;
+  real_glVertexAttrib4dv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4FPROC real_glVertexAttrib4f;
+static void APIENTRY stats_glVertexAttrib4f( GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w ) {
+
+  ++counts[ 186 ];
+  ++current.calls;
+  real_glVertexAttrib4f( index, x, y, z, w );
+}
+
+static PFNGLVERTEXATTRIB4FVPROC real_glVertexAttrib4fv;
+static void APIENTRY stats_glVertexAttrib4fv( GLuint index, const GLfloat *v ) {
+
+  ++counts[ 187 ];
+  ++current.calls;
+  real_glVertexAttrib4fv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4IVPROC real_glVertexAttrib4iv;
+static void APIENTRY stats_glVertexAttrib4iv( GLuint index, const GLint *v ) {
+
+  ++counts[ 188 ];
+  ++current.calls;
+  real_glVertexAttrib4iv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4SPROC real_glVertexAttrib4s;
+static void APIENTRY stats_glVertexAttrib4s( GLuint index, GLshort x, GLshort y, GLshort z, GLshort w ) {
+
+  ++counts[ 189 ];
+  ++current.calls;
+  real_glVertexAttrib4s( index, x, y, z, w );
+}
+
+static PFNGLVERTEXATTRIB4SVPROC real_glVertexAttrib4sv;
+static void APIENTRY stats_glVertexAttrib4sv( GLuint index, const GLshort *v ) {
+
+  ++counts[ 190 ];
+  ++current.calls;
+  real_glVertexAttrib4sv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4UBVPROC real_glVertexAttrib4ubv;
+static void APIENTRY stats_glVertexAttrib4ubv( GLuint index, const GLubyte *v ) {
+
+  ++counts[ 191 ];
+  ++current.calls;
+  real_glVertexAttrib4ubv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4UIVPROC real_glVertexAttrib4uiv;
+static void APIENTRY stats_glVertexAttrib4uiv( GLuint index, const GLuint *v ) {
+
+  ++counts[ 192 ];
+  ++current.calls;
+  real_glVertexAttrib4uiv( index, v );
+}
+
+static PFNGLVERTEXATTRIB4USVPROC real_glVertexAttrib4usv;
+static void APIENTRY stats_glVertexAttrib4usv( GLuint index, const GLushort *v ) {
+
+  ++counts[ 193 ];
+  ++current.calls;
+  real_glVertexAttrib4usv( index, v );
+}
+
+static PFNGLVERTEXATTRIBPOINTERPROC real_glVertexAttribPointer;
+static void APIENTRY stats_glVertexAttribPointer( GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer ) {
+
+  ++counts[ 194 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glVertexAttribPointer( index, size, type, normalized, stride, pointer );
+}
+
+static PFNGLUNIFORMMATRIX2X3FVPROC real_glUniformMatrix2x3fv;
+static void APIENTRY stats_glUniformMatrix2x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 195 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix2x3fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX3X2FVPROC real_glUniformMatrix3x2fv;
+static void APIENTRY stats_glUniformMatrix3x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 196 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix3x2fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX2X4FVPROC real_glUniformMatrix2x4fv;
+static void APIENTRY stats_glUniformMatrix2x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 197 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix2x4fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX4X2FVPROC real_glUniformMatrix4x2fv;
+static void APIENTRY stats_glUniformMatrix4x2fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 198 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix4x2fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX3X4FVPROC real_glUniformMatrix3x4fv;
+static void APIENTRY stats_glUniformMatrix3x4fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 199 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix3x4fv( location, count, transpose, value );
+}
+
+static PFNGLUNIFORMMATRIX4X3FVPROC real_glUniformMatrix4x3fv;
+static void APIENTRY stats_glUniformMatrix4x3fv( GLint location, GLsizei count, GLboolean transpose, const GLfloat *value ) {
+
+  ++counts[ 200 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniformMatrix4x3fv( location, count, transpose, value );
+}
+
+static PFNGLCOLORMASKIPROC real_glColorMaski;
+static void APIENTRY stats_glColorMaski( GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a ) {
+
+  ++counts[ 201 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glColorMaski( index, r, g, b, a );
+}
+
+static PFNGLGETBOOLEANI_VPROC real_glGetBooleani_v;
+static void APIENTRY stats_glGetBooleani_v( GLenum target, GLuint index, GLboolean *data ) {
+
+  ++counts[ 202 ];
+  ++current.calls;
+  real_glGetBooleani_v( target, index, data );
+}
+
+static PFNGLGETINTEGERI_VPROC real_glGetIntegeri_v;
+static void APIENTRY stats_glGetIntegeri_v( GLenum target, GLuint index, GLint *data ) {
+
+  ++counts[ 203 ];
+  ++current.calls;
+  real_glGetIntegeri_v( target, index, data );
+}
+
+static PFNGLENABLEIPROC real_glEnablei;
+static void APIENTRY stats_glEnablei( GLenum target, GLuint index ) {
+
+  ++counts[ 204 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glEnablei( target, index );
+}
+
+static PFNGLDISABLEIPROC real_glDisablei;
+static void APIENTRY stats_glDisablei( GLenum target, GLuint index ) {
+
+  ++counts[ 205 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glDisablei( target, index );
+}
+
+static PFNGLISENABLEDIPROC real_glIsEnabledi;
+static GLboolean APIENTRY stats_glIsEnabledi( GLenum target, GLuint index ) {
+
+  ++counts[ 206 ];
+  ++current.calls;
+  return real_glIsEnabledi( target, index );
+}
+
+static PFNGLBEGINTRANSFORMFEEDBACKPROC real_glBeginTransformFeedback;
+static void APIENTRY stats_glBeginTransformFeedback( GLenum primitiveMode ) {
+
+  ++counts[ 207 ];
+  ++current.calls;
+  real_glBeginTransformFeedback( primitiveMode );
+}
+
+static PFNGLENDTRANSFORMFEEDBACKPROC real_glEndTransformFeedback;
+static void APIENTRY stats_glEndTransformFeedback( void ) {
+
+  ++counts[ 208 ];
+  ++current.calls;
+  real_glEndTransformFeedback();
+}
+
+static PFNGLBINDBUFFERRANGEPROC real_glBindBufferRange;
+static void APIENTRY stats_glBindBufferRange( GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size ) {
+
+  ++counts[ 209 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindBufferRange( target, index, buffer, offset, size );
+}
+
+static PFNGLBINDBUFFERBASEPROC real_glBindBufferBase;
+static void APIENTRY stats_glBindBufferBase( GLenum target, GLuint index, GLuint buffer ) {
+
+  ++counts[ 210 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindBufferBase( target, index, buffer );
+}
+
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC real_glTransformFeedbackVaryings;
+static void APIENTRY stats_glTransformFeedbackVaryings( GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode ) {
+
+  ++counts[ 211 ];
+  ++current.calls;
+  real_glTransformFeedbackVaryings( program, count, varyings, bufferMode );
+}
+
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC real_glGetTransformFeedbackVarying;
+static void APIENTRY stats_glGetTransformFeedbackVarying( GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name ) {
+
+  ++counts[ 212 ];
+  ++current.calls;
+  real_glGetTransformFeedbackVarying( program, index, bufSize, length, size, type, name );
+}
+
+static PFNGLCLAMPCOLORPROC real_glClampColor;
+static void APIENTRY stats_glClampColor( GLenum target, GLenum clamp ) {
+
+  ++counts[ 213 ];
+  ++current.calls;
+  real_glClampColor( target, clamp );
+}
+
+static PFNGLBEGINCONDITIONALRENDERPROC real_glBeginConditionalRender;
+static void APIENTRY stats_glBeginConditionalRender( GLuint id, GLenum mode ) {
+
+  ++counts[ 214 ];
+  ++current.calls;
+  real_glBeginConditionalRender( id, mode );
+}
+
+static PFNGLENDCONDITIONALRENDERPROC real_glEndConditionalRender;
+static void APIENTRY stats_glEndConditionalRender( void ) {
+
+  ++counts[ 215 ];
+  ++current.calls;
+  real_glEndConditionalRender();
+}
+
+static PFNGLVERTEXATTRIBIPOINTERPROC real_glVertexAttribIPointer;
+static void APIENTRY stats_glVertexAttribIPointer( GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer ) {
+
+  ++counts[ 216 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glVertexAttribIPointer( index, size, type, stride, pointer );
+}
+
+static PFNGLGETVERTEXATTRIBIIVPROC real_glGetVertexAttribIiv;
+static void APIENTRY stats_glGetVertexAttribIiv( GLuint index, GLenum pname, GLint *params ) {
+
+  ++counts[ 217 ];
+  ++current.calls;
+  real_glGetVertexAttribIiv( index, pname, params );
+}
+
+static PFNGLGETVERTEXATTRIBIUIVPROC real_glGetVertexAttribIuiv;
+static void APIENTRY stats_glGetVertexAttribIuiv( GLuint index, GLenum pname, GLuint *params ) {
+
+  ++counts[ 218 ];
+  ++current.calls;
+  real_glGetVertexAttribIuiv( index, pname, params );
+}
+
+static PFNGLVERTEXATTRIBI1IPROC real_glVertexAttribI1i;
+static void APIENTRY stats_glVertexAttribI1i( GLuint index, GLint x ) {
+
+  ++counts[ 219 ];
+  ++current.calls;
+  real_glVertexAttribI1i( index, x );
+}
+
+static PFNGLVERTEXATTRIBI2IPROC real_glVertexAttribI2i;
+static void APIENTRY stats_glVertexAttribI2i( GLuint index, GLint x, GLint y ) {
+
+  ++counts[ 220 ];
+  ++current.calls;
+  real_glVertexAttribI2i( index, x, y );
+}
+
+static PFNGLVERTEXATTRIBI3IPROC real_glVertexAttribI3i;
+static void APIENTRY stats_glVertexAttribI3i( GLuint index, GLint x, GLint y, GLint z ) {
+
+  ++counts[ 221 ];
+  ++current.calls;
+  real_glVertexAttribI3i( index, x, y, z );
+}
+
+static PFNGLVERTEXATTRIBI4IPROC real_glVertexAttribI4i;
+static void APIENTRY stats_glVertexAttribI4i( GLuint index, GLint x, GLint y, GLint z, GLint w ) {
+
+  ++counts[ 222 ];
+  ++current.calls;
+  real_glVertexAttribI4i( index, x, y, z, w );
+}
+
+static PFNGLVERTEXATTRIBI1UIPROC real_glVertexAttribI1ui;
+static void APIENTRY stats_glVertexAttribI1ui( GLuint index, GLuint x ) {
+
+  ++counts[ 223 ];
+  ++current.calls;
+  real_glVertexAttribI1ui( index, x );
+}
+
+static PFNGLVERTEXATTRIBI2UIPROC real_glVertexAttribI2ui;
+static void APIENTRY stats_glVertexAttribI2ui( GLuint index, GLuint x, GLuint y ) {
+
+  ++counts[ 224 ];
+  ++current.calls;
+  real_glVertexAttribI2ui( index, x, y );
+}
+
+static PFNGLVERTEXATTRIBI3UIPROC real_glVertexAttribI3ui;
+static void APIENTRY stats_glVertexAttribI3ui( GLuint index, GLuint x, GLuint y, GLuint z ) {
+
+  ++counts[ 225 ];
+  ++current.calls;
+  real_glVertexAttribI3ui( index, x, y, z );
+}
+
+static PFNGLVERTEXATTRIBI4UIPROC real_glVertexAttribI4ui;
+static void APIENTRY stats_glVertexAttribI4ui( GLuint index, GLuint x, GLuint y, GLuint z, GLuint w ) {
+
+  ++counts[ 226 ];
+  ++current.calls;
+  real_glVertexAttribI4ui( index, x, y, z, w );
+}
+
+static PFNGLVERTEXATTRIBI1IVPROC real_glVertexAttribI1iv;
+static void APIENTRY stats_glVertexAttribI1iv( GLuint index, const GLint *v ) {
+
+  ++counts[ 227 ];
+  ++current.calls;
+  real_glVertexAttribI1iv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI2IVPROC real_glVertexAttribI2iv;
+static void APIENTRY stats_glVertexAttribI2iv( GLuint index, const GLint *v ) {
+
+  ++counts[ 228 ];
+  ++current.calls;
+  real_glVertexAttribI2iv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI3IVPROC real_glVertexAttribI3iv;
+static void APIENTRY stats_glVertexAttribI3iv( GLuint index, const GLint *v ) {
+
+  ++counts[ 229 ];
+  ++current.calls;
+  real_glVertexAttribI3iv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI4IVPROC real_glVertexAttribI4iv;
+static void APIENTRY stats_glVertexAttribI4iv( GLuint index, const GLint *v ) {
+
+  ++counts[ 230 ];
+  ++current.calls;
+  real_glVertexAttribI4iv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI1UIVPROC real_glVertexAttribI1uiv;
+static void APIENTRY stats_glVertexAttribI1uiv( GLuint index, const GLuint *v ) {
+
+  ++counts[ 231 ];
+  ++current.calls;
+  real_glVertexAttribI1uiv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI2UIVPROC real_glVertexAttribI2uiv;
+static void APIENTRY stats_glVertexAttribI2uiv( GLuint index, const GLuint *v ) {
+
+  ++counts[ 232 ];
+  ++current.calls;
+  real_glVertexAttribI2uiv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI3UIVPROC real_glVertexAttribI3uiv;
+static void APIENTRY stats_glVertexAttribI3uiv( GLuint index, const GLuint *v ) {
+
+  ++counts[ 233 ];
+  ++current.calls;
+  real_glVertexAttribI3uiv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI4UIVPROC real_glVertexAttribI4uiv;
+static void APIENTRY stats_glVertexAttribI4uiv( GLuint index, const GLuint *v ) {
+
+  ++counts[ 234 ];
+  ++current.calls;
+  real_glVertexAttribI4uiv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI4BVPROC real_glVertexAttribI4bv;
+static void APIENTRY stats_glVertexAttribI4bv( GLuint index, const GLbyte *v ) {
+
+  ++counts[ 235 ];
+  ++current.calls;
+  real_glVertexAttribI4bv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI4SVPROC real_glVertexAttribI4sv;
+static void APIENTRY stats_glVertexAttribI4sv( GLuint index, const GLshort *v ) {
+
+  ++counts[ 236 ];
+  ++current.calls;
+  real_glVertexAttribI4sv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI4UBVPROC real_glVertexAttribI4ubv;
+static void APIENTRY stats_glVertexAttribI4ubv( GLuint index, const GLubyte *v ) {
+
+  ++counts[ 237 ];
+  ++current.calls;
+  real_glVertexAttribI4ubv( index, v );
+}
+
+static PFNGLVERTEXATTRIBI4USVPROC real_glVertexAttribI4usv;
+static void APIENTRY stats_glVertexAttribI4usv( GLuint index, const GLushort *v ) {
+
+  ++counts[ 238 ];
+  ++current.calls;
+  real_glVertexAttribI4usv( index, v );
+}
+
+static PFNGLGETUNIFORMUIVPROC real_glGetUniformuiv;
+static void APIENTRY stats_glGetUniformuiv( GLuint program, GLint location, GLuint *params ) {
+
+  ++counts[ 239 ];
+  ++current.calls;
+  real_glGetUniformuiv( program, location, params );
+}
+
+static PFNGLBINDFRAGDATALOCATIONPROC real_glBindFragDataLocation;
+static void APIENTRY stats_glBindFragDataLocation( GLuint program, GLuint color, const GLchar *name ) {
+
+  ++counts[ 240 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindFragDataLocation( program, color, name );
+}
+
+static PFNGLGETFRAGDATALOCATIONPROC real_glGetFragDataLocation;
+static GLint APIENTRY stats_glGetFragDataLocation( GLuint program, const GLchar *name ) {
+
+  ++counts[ 241 ];
+  ++current.calls;
+  return real_glGetFragDataLocation( program, name );
+}
+
+static PFNGLUNIFORM1UIPROC real_glUniform1ui;
+static void APIENTRY stats_glUniform1ui( GLint location, GLuint v0 ) {
+
+  ++counts[ 242 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform1ui( location, v0 );
+}
+
+static PFNGLUNIFORM2UIPROC real_glUniform2ui;
+static void APIENTRY stats_glUniform2ui( GLint location, GLuint v0, GLuint v1 ) {
+
+  ++counts[ 243 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform2ui( location, v0, v1 );
+}
+
+static PFNGLUNIFORM3UIPROC real_glUniform3ui;
+static void APIENTRY stats_glUniform3ui( GLint location, GLuint v0, GLuint v1, GLuint v2 ) {
+
+  ++counts[ 244 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform3ui( location, v0, v1, v2 );
+}
+
+static PFNGLUNIFORM4UIPROC real_glUniform4ui;
+static void APIENTRY stats_glUniform4ui( GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3 ) {
+
+  ++counts[ 245 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform4ui( location, v0, v1, v2, v3 );
+}
+
+static PFNGLUNIFORM1UIVPROC real_glUniform1uiv;
+static void APIENTRY stats_glUniform1uiv( GLint location, GLsizei count, const GLuint *value ) {
+
+  ++counts[ 246 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform1uiv( location, count, value );
+}
+
+static PFNGLUNIFORM2UIVPROC real_glUniform2uiv;
+static void APIENTRY stats_glUniform2uiv( GLint location, GLsizei count, const GLuint *value ) {
+
+  ++counts[ 247 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform2uiv( location, count, value );
+}
+
+static PFNGLUNIFORM3UIVPROC real_glUniform3uiv;
+static void APIENTRY stats_glUniform3uiv( GLint location, GLsizei count, const GLuint *value ) {
+
+  ++counts[ 248 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform3uiv( location, count, value );
+}
+
+static PFNGLUNIFORM4UIVPROC real_glUniform4uiv;
+static void APIENTRY stats_glUniform4uiv( GLint location, GLsizei count, const GLuint *value ) {
+
+  ++counts[ 249 ];
+  ++current.calls;
+  ++current.uniforms;
+  real_glUniform4uiv( location, count, value );
+}
+
+static PFNGLTEXPARAMETERIIVPROC real_glTexParameterIiv;
+static void APIENTRY stats_glTexParameterIiv( GLenum target, GLenum pname, const GLint *params ) {
+
+  ++counts[ 250 ];
+  ++current.calls;
+  real_glTexParameterIiv( target, pname, params );
+}
+
+static PFNGLTEXPARAMETERIUIVPROC real_glTexParameterIuiv;
+static void APIENTRY stats_glTexParameterIuiv( GLenum target, GLenum pname, const GLuint *params ) {
+
+  ++counts[ 251 ];
+  ++current.calls;
+  real_glTexParameterIuiv( target, pname, params );
+}
+
+static PFNGLGETTEXPARAMETERIIVPROC real_glGetTexParameterIiv;
+static void APIENTRY stats_glGetTexParameterIiv( GLenum target, GLenum pname, GLint *params ) {
+
+  ++counts[ 252 ];
+  ++current.calls;
+  real_glGetTexParameterIiv( target, pname, params );
+}
+
+static PFNGLGETTEXPARAMETERIUIVPROC real_glGetTexParameterIuiv;
+static void APIENTRY stats_glGetTexParameterIuiv( GLenum target, GLenum pname, GLuint *params ) {
+
+  ++counts[ 253 ];
+  ++current.calls;
+  real_glGetTexParameterIuiv( target, pname, params );
+}
+
+static PFNGLCLEARBUFFERIVPROC real_glClearBufferiv;
+static void APIENTRY stats_glClearBufferiv( GLenum buffer, GLint drawbuffer, const GLint *value ) {
+
+  ++counts[ 254 ];
+  ++current.calls;
+  real_glClearBufferiv( buffer, drawbuffer, value );
+}
+
+static PFNGLCLEARBUFFERUIVPROC real_glClearBufferuiv;
+static void APIENTRY stats_glClearBufferuiv( GLenum buffer, GLint drawbuffer, const GLuint *value ) {
+
+  ++counts[ 255 ];
+  ++current.calls;
+  real_glClearBufferuiv( buffer, drawbuffer, value );
+}
+
+static PFNGLCLEARBUFFERFVPROC real_glClearBufferfv;
+static void APIENTRY stats_glClearBufferfv( GLenum buffer, GLint drawbuffer, const GLfloat *value ) {
+
+  ++counts[ 256 ];
+  ++current.calls;
+  real_glClearBufferfv( buffer, drawbuffer, value );
+}
+
+static PFNGLCLEARBUFFERFIPROC real_glClearBufferfi;
+static void APIENTRY stats_glClearBufferfi( GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil ) {
+
+  ++counts[ 257 ];
+  ++current.calls;
+  real_glClearBufferfi( buffer, drawbuffer, depth, stencil );
+}
+
+static PFNGLGETSTRINGIPROC real_glGetStringi;
+static const GLubyte * APIENTRY stats_glGetStringi( GLenum name, GLuint index ) {
+
+  ++counts[ 258 ];
+  ++current.calls;
+  return real_glGetStringi( name, index );
+}
+
+static PFNGLISRENDERBUFFERPROC real_glIsRenderbuffer;
+static GLboolean APIENTRY stats_glIsRenderbuffer( GLuint renderbuffer ) {
+
+  ++counts[ 259 ];
+  ++current.calls;
+  return real_glIsRenderbuffer( renderbuffer );
+}
+
+static PFNGLBINDRENDERBUFFERPROC real_glBindRenderbuffer;
+static void APIENTRY stats_glBindRenderbuffer( GLenum target, GLuint renderbuffer ) {
+
+  ++counts[ 260 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindRenderbuffer( target, renderbuffer );
+}
+
+static PFNGLDELETERENDERBUFFERSPROC real_glDeleteRenderbuffers;
+static void APIENTRY stats_glDeleteRenderbuffers( GLsizei n, const GLuint *renderbuffers ) {
+
+  ++counts[ 261 ];
+  ++current.calls;
+  real_glDeleteRenderbuffers( n, renderbuffers );
+}
+
+static PFNGLGENRENDERBUFFERSPROC real_glGenRenderbuffers;
+static void APIENTRY stats_glGenRenderbuffers( GLsizei n, GLuint *renderbuffers ) {
+
+  ++counts[ 262 ];
+  ++current.calls;
+  real_glGenRenderbuffers( n, renderbuffers );
+}
+
+static PFNGLRENDERBUFFERSTORAGEPROC real_glRenderbufferStorage;
+static void APIENTRY stats_glRenderbufferStorage( GLenum target, GLenum internalformat, GLsizei width, GLsizei height ) {
+
+  ++counts[ 263 ];
+  ++current.calls;
+  real_glRenderbufferStorage( target, internalformat, width, height );
+}
+
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC real_glGetRenderbufferParameteriv;
+static void APIENTRY stats_glGetRenderbufferParameteriv( GLenum target, GLenum pname, GLint *params ) {
+
+  ++counts[ 264 ];
+  ++current.calls;
+  real_glGetRenderbufferParameteriv( target, pname, params );
+}
+
+static PFNGLISFRAMEBUFFERPROC real_glIsFramebuffer;
+static GLboolean APIENTRY stats_glIsFramebuffer( GLuint framebuffer ) {
+
+  ++counts[ 265 ];
+  ++current.calls;
+  return real_glIsFramebuffer( framebuffer );
+}
+
+static PFNGLBINDFRAMEBUFFERPROC real_glBindFramebuffer;
+static void APIENTRY stats_glBindFramebuffer( GLenum target, GLuint framebuffer ) {
+
+  ++counts[ 266 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindFramebuffer( target, framebuffer );
+}
+
+static PFNGLDELETEFRAMEBUFFERSPROC real_glDeleteFramebuffers;
+static void APIENTRY stats_glDeleteFramebuffers( GLsizei n, const GLuint *framebuffers ) {
+
+  ++counts[ 267 ];
+  ++current.calls;
+  real_glDeleteFramebuffers( n, framebuffers );
+}
+
+static PFNGLGENFRAMEBUFFERSPROC real_glGenFramebuffers;
+static void APIENTRY stats_glGenFramebuffers( GLsizei n, GLuint *framebuffers ) {
+
+  ++counts[ 268 ];
+  ++current.calls;
+  real_glGenFramebuffers( n, framebuffers );
+}
+
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC real_glCheckFramebufferStatus;
+static GLenum APIENTRY stats_glCheckFramebufferStatus( GLenum target ) {
+
+  ++counts[ 269 ];
+  ++current.calls;
+  return real_glCheckFramebufferStatus( target );
+}
+
+static PFNGLFRAMEBUFFERTEXTURE1DPROC real_glFramebufferTexture1D;
+static void APIENTRY stats_glFramebufferTexture1D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level ) {
+
+  ++counts[ 270 ];
+  ++current.calls;
+  real_glFramebufferTexture1D( target, attachment, textarget, texture, level );
+}
+
+static PFNGLFRAMEBUFFERTEXTURE2DPROC real_glFramebufferTexture2D;
+static void APIENTRY stats_glFramebufferTexture2D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level ) {
+
+  ++counts[ 271 ];
+  ++current.calls;
+  real_glFramebufferTexture2D( target, attachment, textarget, texture, level );
+}
+
+static PFNGLFRAMEBUFFERTEXTURE3DPROC real_glFramebufferTexture3D;
+static void APIENTRY stats_glFramebufferTexture3D( GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset ) {
+
+  ++counts[ 272 ];
+  ++current.calls;
+  real_glFramebufferTexture3D( target, attachment, textarget, texture, level, zoffset );
+}
+
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC real_glFramebufferRenderbuffer;
+static void APIENTRY stats_glFramebufferRenderbuffer( GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer ) {
+
+  ++counts[ 273 ];
+  ++current.calls;
+  real_glFramebufferRenderbuffer( target, attachment, renderbuffertarget, renderbuffer );
+}
+
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC real_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY stats_glGetFramebufferAttachmentParameteriv( GLenum target, GLenum attachment, GLenum pname, GLint *params ) {
+
+  ++counts[ 274 ];
+  ++current.calls;
+  real_glGetFramebufferAttachmentParameteriv( target, attachment, pname, params );
+}
+
+static PFNGLGENERATEMIPMAPPROC real_glGenerateMipmap;
+static void APIENTRY stats_glGenerateMipmap( GLenum target ) {
+
+  ++counts[ 275 ];
+  ++current.calls;
+  real_glGenerateMipmap( target );
+}
+
+static PFNGLBLITFRAMEBUFFERPROC real_glBlitFramebuffer;
+static void APIENTRY stats_glBlitFramebuffer( GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter ) {
+
+  ++counts[ 276 ];
+  ++current.calls;
+  real_glBlitFramebuffer( srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter );
+}
+
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC real_glRenderbufferStorageMultisample;
+static void APIENTRY stats_glRenderbufferStorageMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height ) {
+
+  ++counts[ 277 ];
+  ++current.calls;
+  real_glRenderbufferStorageMultisample( target, samples, internalformat, width, height );
+}
+
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC real_glFramebufferTextureLayer;
+static void APIENTRY stats_glFramebufferTextureLayer( GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer ) {
+
+  ++counts[ 278 ];
+  ++current.calls;
+  real_glFramebufferTextureLayer( target, attachment, texture, level, layer );
+}
+
+static PFNGLMAPBUFFERRANGEPROC real_glMapBufferRange;
+static void * APIENTRY stats_glMapBufferRange( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access ) {
+
+  ++counts[ 279 ];
+  ++current.calls;
+  return real_glMapBufferRange( target, offset, length, access );
+}
+
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC real_glFlushMappedBufferRange;
+static void APIENTRY stats_glFlushMappedBufferRange( GLenum target, GLintptr offset, GLsizeiptr length ) {
+
+  ++counts[ 280 ];
+  ++current.calls;
+  real_glFlushMappedBufferRange( target, offset, length );
+}
+
+static PFNGLBINDVERTEXARRAYPROC real_glBindVertexArray;
+static void APIENTRY stats_glBindVertexArray( GLuint array ) {
+
+  ++counts[ 281 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindVertexArray( array );
+}
+
+static PFNGLDELETEVERTEXARRAYSPROC real_glDeleteVertexArrays;
+static void APIENTRY stats_glDeleteVertexArrays( GLsizei n, const GLuint *arrays ) {
+
+  ++counts[ 282 ];
+  ++current.calls;
+  real_glDeleteVertexArrays( n, arrays );
+}
+
+static PFNGLGENVERTEXARRAYSPROC real_glGenVertexArrays;
+static void APIENTRY stats_glGenVertexArrays( GLsizei n, GLuint *arrays ) {
+
+  ++counts[ 283 ];
+  ++current.calls;
+  real_glGenVertexArrays( n, arrays );
+}
+
+static PFNGLISVERTEXARRAYPROC real_glIsVertexArray;
+static GLboolean APIENTRY stats_glIsVertexArray( GLuint array ) {
+
+  ++counts[ 284 ];
+  ++current.calls;
+  return real_glIsVertexArray( array );
+}
+
+static PFNGLDRAWARRAYSINSTANCEDPROC real_glDrawArraysInstanced;
+static void APIENTRY stats_glDrawArraysInstanced( GLenum mode, GLint first, GLsizei count, GLsizei instancecount ) {
+
+  ++counts[ 285 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawArraysInstanced( mode, first, count, instancecount );
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDPROC real_glDrawElementsInstanced;
+static void APIENTRY stats_glDrawElementsInstanced( GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount ) {
+
+  ++counts[ 286 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawElementsInstanced( mode, count, type, indices, instancecount );
+}
+
+static PFNGLTEXBUFFERPROC real_glTexBuffer;
+static void APIENTRY stats_glTexBuffer( GLenum target, GLenum internalformat, GLuint buffer ) {
+
+  ++counts[ 287 ];
+  ++current.calls;
+  real_glTexBuffer( target, internalformat, buffer );
+}
+
+static PFNGLPRIMITIVERESTARTINDEXPROC real_glPrimitiveRestartIndex;
+static void APIENTRY stats_glPrimitiveRestartIndex( GLuint index ) {
+
+  ++counts[ 288 ];
+  ++current.calls;
+  real_glPrimitiveRestartIndex( index );
+}
+
+static PFNGLCOPYBUFFERSUBDATAPROC real_glCopyBufferSubData;
+static void APIENTRY stats_glCopyBufferSubData( GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size ) {
+
+  ++counts[ 289 ];
+  ++current.calls;
+  real_glCopyBufferSubData( readTarget, writeTarget, readOffset, writeOffset, size );
+}
+
+static PFNGLGETUNIFORMINDICESPROC real_glGetUniformIndices;
+static void APIENTRY stats_glGetUniformIndices( GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices ) {
+
+  ++counts[ 290 ];
+  ++current.calls;
+  real_glGetUniformIndices( program, uniformCount, uniformNames, uniformIndices );
+}
+
+static PFNGLGETACTIVEUNIFORMSIVPROC real_glGetActiveUniformsiv;
+static void APIENTRY stats_glGetActiveUniformsiv( GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params ) {
+
+  ++counts[ 291 ];
+  ++current.calls;
+  real_glGetActiveUniformsiv( program, uniformCount, uniformIndices, pname, params );
+}
+
+static PFNGLGETACTIVEUNIFORMNAMEPROC real_glGetActiveUniformName;
+static void APIENTRY stats_glGetActiveUniformName( GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName ) {
+
+  ++counts[ 292 ];
+  ++current.calls;
+  real_glGetActiveUniformName( program, uniformIndex, bufSize, length, uniformName );
+}
+
+static PFNGLGETUNIFORMBLOCKINDEXPROC real_glGetUniformBlockIndex;
+static GLuint APIENTRY stats_glGetUniformBlockIndex( GLuint program, const GLchar *uniformBlockName ) {
+
+  ++counts[ 293 ];
+  ++current.calls;
+  return real_glGetUniformBlockIndex( program, uniformBlockName );
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC real_glGetActiveUniformBlockiv;
+static void APIENTRY stats_glGetActiveUniformBlockiv( GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params ) {
+
+  ++counts[ 294 ];
+  ++current.calls;
+  real_glGetActiveUniformBlockiv( program, uniformBlockIndex, pname, params );
+}
+
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC real_glGetActiveUniformBlockName;
+static void APIENTRY stats_glGetActiveUniformBlockName( GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName ) {
+
+  ++counts[ 295 ];
+  ++current.calls;
+  real_glGetActiveUniformBlockName( program, uniformBlockIndex, bufSize, length, uniformBlockName );
+}
+
+static PFNGLUNIFORMBLOCKBINDINGPROC real_glUniformBlockBinding;
+static void APIENTRY stats_glUniformBlockBinding( GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding ) {
+
+  ++counts[ 296 ];
+  ++current.calls;
+  real_glUniformBlockBinding( program, uniformBlockIndex, uniformBlockBinding );
+}
+
+static PFNGLDRAWELEMENTSBASEVERTEXPROC real_glDrawElementsBaseVertex;
+static void APIENTRY stats_glDrawElementsBaseVertex( GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex ) {
+
+  ++counts[ 297 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawElementsBaseVertex( mode, count, type, indices, basevertex );
+}
+
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC real_glDrawRangeElementsBaseVertex;
+static void APIENTRY stats_glDrawRangeElementsBaseVertex( GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex ) {
+
+  ++counts[ 298 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawRangeElementsBaseVertex( mode, start, end, count, type, indices, basevertex );
+}
+
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC real_glDrawElementsInstancedBaseVertex;
+static void APIENTRY stats_glDrawElementsInstancedBaseVertex( GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex ) {
+
+  ++counts[ 299 ];
+  ++current.calls;
+  ++current.draws;
+  real_glDrawElementsInstancedBaseVertex( mode, count, type, indices, instancecount, basevertex );
+}
+
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC real_glMultiDrawElementsBaseVertex;
+static void APIENTRY stats_glMultiDrawElementsBaseVertex( GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex ) {
+
+  ++counts[ 300 ];
+  ++current.calls;
+  ++current.draws;
+  real_glMultiDrawElementsBaseVertex( mode, count, type, indices, drawcount, basevertex );
+}
+
+static PFNGLPROVOKINGVERTEXPROC real_glProvokingVertex;
+static void APIENTRY stats_glProvokingVertex( GLenum mode ) {
+
+  ++counts[ 301 ];
+  ++current.calls;
+  real_glProvokingVertex( mode );
+}
+
+static PFNGLFENCESYNCPROC real_glFenceSync;
+static GLsync APIENTRY stats_glFenceSync( GLenum condition, GLbitfield flags ) {
+
+  ++counts[ 302 ];
+  ++current.calls;
+  return real_glFenceSync( condition, flags );
+}
+
+static PFNGLISSYNCPROC real_glIsSync;
+static GLboolean APIENTRY stats_glIsSync( GLsync sync ) {
+
+  ++counts[ 303 ];
+  ++current.calls;
+  return real_glIsSync( sync );
+}
+
+static PFNGLDELETESYNCPROC real_glDeleteSync;
+static void APIENTRY stats_glDeleteSync( GLsync sync ) {
+
+  ++counts[ 304 ];
+  ++current.calls;
+  real_glDeleteSync( sync );
+}
+
+static PFNGLCLIENTWAITSYNCPROC real_glClientWaitSync;
+static GLenum APIENTRY stats_glClientWaitSync( GLsync sync, GLbitfield flags, GLuint64 timeout ) {
+
+  ++counts[ 305 ];
+  ++current.calls;
+  return real_glClientWaitSync( sync, flags, timeout );
+}
+
+static PFNGLWAITSYNCPROC real_glWaitSync;
+static void APIENTRY stats_glWaitSync( GLsync sync, GLbitfield flags, GLuint64 timeout ) {
+
+  ++counts[ 306 ];
+  ++current.calls;
+  real_glWaitSync( sync, flags, timeout );
+}
+
+static PFNGLGETINTEGER64VPROC real_glGetInteger64v;
+static void APIENTRY stats_glGetInteger64v( GLenum pname, GLint64 *data ) {
+
+  ++counts[ 307 ];
+  ++current.calls;
+  real_glGetInteger64v( pname, data );
+}
+
+static PFNGLGETSYNCIVPROC real_glGetSynciv;
+static void APIENTRY stats_glGetSynciv( GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values ) {
+
+  ++counts[ 308 ];
+  ++current.calls;
+  real_glGetSynciv( sync, pname, bufSize, length, values );
+}
+
+static PFNGLGETINTEGER64I_VPROC real_glGetInteger64i_v;
+static void APIENTRY stats_glGetInteger64i_v( GLenum target, GLuint index, GLint64 *data ) {
+
+  ++counts[ 309 ];
+  ++current.calls;
+  real_glGetInteger64i_v( target, index, data );
+}
+
+static PFNGLGETBUFFERPARAMETERI64VPROC real_glGetBufferParameteri64v;
+static void APIENTRY stats_glGetBufferParameteri64v( GLenum target, GLenum pname, GLint64 *params ) {
+
+  ++counts[ 310 ];
+  ++current.calls;
+  real_glGetBufferParameteri64v( target, pname, params );
+}
+
+static PFNGLFRAMEBUFFERTEXTUREPROC real_glFramebufferTexture;
+static void APIENTRY stats_glFramebufferTexture( GLenum target, GLenum attachment, GLuint texture, GLint level ) {
+
+  ++counts[ 311 ];
+  ++current.calls;
+  real_glFramebufferTexture( target, attachment, texture, level );
+}
+
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC real_glTexImage2DMultisample;
+static void APIENTRY stats_glTexImage2DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations ) {
+
+  ++counts[ 312 ];
+  ++current.calls;
+  real_glTexImage2DMultisample( target, samples, internalformat, width, height, fixedsamplelocations );
+}
+
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC real_glTexImage3DMultisample;
+static void APIENTRY stats_glTexImage3DMultisample( GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations ) {
+
+  ++counts[ 313 ];
+  ++current.calls;
+  real_glTexImage3DMultisample( target, samples, internalformat, width, height, depth, fixedsamplelocations );
+}
+
+static PFNGLGETMULTISAMPLEFVPROC real_glGetMultisamplefv;
+static void APIENTRY stats_glGetMultisamplefv( GLenum pname, GLuint index, GLfloat *val ) {
+
+  ++counts[ 314 ];
+  ++current.calls;
+  real_glGetMultisamplefv( pname, index, val );
+}
+
+static PFNGLSAMPLEMASKIPROC real_glSampleMaski;
+static void APIENTRY stats_glSampleMaski( GLuint maskNumber, GLbitfield mask ) {
+
+  ++counts[ 315 ];
+  ++current.calls;
+  real_glSampleMaski( maskNumber, mask );
+}
+
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC real_glBindFragDataLocationIndexed;
+static void APIENTRY stats_glBindFragDataLocationIndexed( GLuint program, GLuint colorNumber, GLuint index, const GLchar *name ) {
+
+  ++counts[ 316 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindFragDataLocationIndexed( program, colorNumber, index, name );
+}
+
+static PFNGLGETFRAGDATAINDEXPROC real_glGetFragDataIndex;
+static GLint APIENTRY stats_glGetFragDataIndex( GLuint program, const GLchar *name ) {
+
+  ++counts[ 317 ];
+  ++current.calls;
+  return real_glGetFragDataIndex( program, name );
+}
+
+static PFNGLGENSAMPLERSPROC real_glGenSamplers;
+static void APIENTRY stats_glGenSamplers( GLsizei count, GLuint *samplers ) {
+
+  ++counts[ 318 ];
+  ++current.calls;
+  real_glGenSamplers( count, samplers );
+}
+
+static PFNGLDELETESAMPLERSPROC real_glDeleteSamplers;
+static void APIENTRY stats_glDeleteSamplers( GLsizei count, const GLuint *samplers ) {
+
+  ++counts[ 319 ];
+  ++current.calls;
+  real_glDeleteSamplers( count, samplers );
+}
+
+static PFNGLISSAMPLERPROC real_glIsSampler;
+static GLboolean APIENTRY stats_glIsSampler( GLuint sampler ) {
+
+  ++counts[ 320 ];
+  ++current.calls;
+  return real_glIsSampler( sampler );
+}
+
+static PFNGLBINDSAMPLERPROC real_glBindSampler;
+static void APIENTRY stats_glBindSampler( GLuint unit, GLuint sampler ) {
+
+  ++counts[ 321 ];
+  ++current.calls;
+  ++current.binds;
+  real_glBindSampler( unit, sampler );
+}
+
+static PFNGLSAMPLERPARAMETERIPROC real_glSamplerParameteri;
+static void APIENTRY stats_glSamplerParameteri( GLuint sampler, GLenum pname, GLint param ) {
+
+  ++counts[ 322 ];
+  ++current.calls;
+  real_glSamplerParameteri( sampler, pname, param );
+}
+
+static PFNGLSAMPLERPARAMETERIVPROC real_glSamplerParameteriv;
+static void APIENTRY stats_glSamplerParameteriv( GLuint sampler, GLenum pname, const GLint *param ) {
+
+  ++counts[ 323 ];
+  ++current.calls;
+  real_glSamplerParameteriv( sampler, pname, param );
+}
+
+static PFNGLSAMPLERPARAMETERFPROC real_glSamplerParameterf;
+static void APIENTRY stats_glSamplerParameterf( GLuint sampler, GLenum pname, GLfloat param ) {
+
+  ++counts[ 324 ];
+  ++current.calls;
+  real_glSamplerParameterf( sampler, pname, param );
+}
+
+static PFNGLSAMPLERPARAMETERFVPROC real_glSamplerParameterfv;
+static void APIENTRY stats_glSamplerParameterfv( GLuint sampler, GLenum pname, const GLfloat *param ) {
+
+  ++counts[ 325 ];
+  ++current.calls;
+  real_glSamplerParameterfv( sampler, pname, param );
+}
+
+static PFNGLSAMPLERPARAMETERIIVPROC real_glSamplerParameterIiv;
+static void APIENTRY stats_glSamplerParameterIiv( GLuint sampler, GLenum pname, const GLint *param ) {
+
+  ++counts[ 326 ];
+  ++current.calls;
+  real_glSamplerParameterIiv( sampler, pname, param );
+}
+
+static PFNGLSAMPLERPARAMETERIUIVPROC real_glSamplerParameterIuiv;
+static void APIENTRY stats_glSamplerParameterIuiv( GLuint sampler, GLenum pname, const GLuint *param ) {
+
+  ++counts[ 327 ];
+  ++current.calls;
+  real_glSamplerParameterIuiv( sampler, pname, param );
+}
+
+static PFNGLGETSAMPLERPARAMETERIVPROC real_glGetSamplerParameteriv;
+static void APIENTRY stats_glGetSamplerParameteriv( GLuint sampler, GLenum pname, GLint *params ) {
+
+  ++counts[ 328 ];
+  ++current.calls;
+  real_glGetSamplerParameteriv( sampler, pname, params );
+}
+
+static PFNGLGETSAMPLERPARAMETERIIVPROC real_glGetSamplerParameterIiv;
+static void APIENTRY stats_glGetSamplerParameterIiv( GLuint sampler, GLenum pname, GLint *params ) {
+
+  ++counts[ 329 ];
+  ++current.calls;
+  real_glGetSamplerParameterIiv( sampler, pname, params );
+}
+
+static PFNGLGETSAMPLERPARAMETERFVPROC real_glGetSamplerParameterfv;
+static void APIENTRY stats_glGetSamplerParameterfv( GLuint sampler, GLenum pname, GLfloat *params ) {
+
+  ++counts[ 330 ];
+  ++current.calls;
+  real_glGetSamplerParameterfv( sampler, pname, params );
+}
+
+static PFNGLGETSAMPLERPARAMETERIUIVPROC real_glGetSamplerParameterIuiv;
+static void APIENTRY stats_glGetSamplerParameterIuiv( GLuint sampler, GLenum pname, GLuint *params ) {
+
+  ++counts[ 331 ];
+  ++current.calls;
+  real_glGetSamplerParameterIuiv( sampler, pname, params );
+}
+
+static PFNGLQUERYCOUNTERPROC real_glQueryCounter;
+static void APIENTRY stats_glQueryCounter( GLuint id, GLenum target ) {
+
+  ++counts[ 332 ];
+  ++current.calls;
+  real_glQueryCounter( id, target );
+}
+
+static PFNGLGETQUERYOBJECTI64VPROC real_glGetQueryObjecti64v;
+static void APIENTRY stats_glGetQueryObjecti64v( GLuint id, GLenum pname, GLint64 *params ) {
+
+  ++counts[ 333 ];
+  ++current.calls;
+  real_glGetQueryObjecti64v( id, pname, params );
+}
+
+static PFNGLGETQUERYOBJECTUI64VPROC real_glGetQueryObjectui64v;
+static void APIENTRY stats_glGetQueryObjectui64v( GLuint id, GLenum pname, GLuint64 *params ) {
+
+  ++counts[ 334 ];
+  ++current.calls;
+  real_glGetQueryObjectui64v( id, pname, params );
+}
+
+static PFNGLVERTEXATTRIBDIVISORPROC real_glVertexAttribDivisor;
+static void APIENTRY stats_glVertexAttribDivisor( GLuint index, GLuint divisor ) {
+
+  ++counts[ 335 ];
+  ++current.calls;
+  ++current.stateChanges;
+  real_glVertexAttribDivisor( index, divisor );
+}
+
+static PFNGLVERTEXATTRIBP1UIPROC real_glVertexAttribP1ui;
+static void APIENTRY stats_glVertexAttribP1ui( GLuint index, GLenum type, GLboolean normalized, GLuint value ) {
+
+  ++counts[ 336 ];
+  ++current.calls;
+  real_glVertexAttribP1ui( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP1UIVPROC real_glVertexAttribP1uiv;
+static void APIENTRY stats_glVertexAttribP1uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value ) {
+
+  ++counts[ 337 ];
+  ++current.calls;
+  real_glVertexAttribP1uiv( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP2UIPROC real_glVertexAttribP2ui;
+static void APIENTRY stats_glVertexAttribP2ui( GLuint index, GLenum type, GLboolean normalized, GLuint value ) {
+
+  ++counts[ 338 ];
+  ++current.calls;
+  real_glVertexAttribP2ui( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP2UIVPROC real_glVertexAttribP2uiv;
+static void APIENTRY stats_glVertexAttribP2uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value ) {
+
+  ++counts[ 339 ];
+  ++current.calls;
+  real_glVertexAttribP2uiv( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP3UIPROC real_glVertexAttribP3ui;
+static void APIENTRY stats_glVertexAttribP3ui( GLuint index, GLenum type, GLboolean normalized, GLuint value ) {
+
+  ++counts[ 340 ];
+  ++current.calls;
+  real_glVertexAttribP3ui( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP3UIVPROC real_glVertexAttribP3uiv;
+static void APIENTRY stats_glVertexAttribP3uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value ) {
+
+  ++counts[ 341 ];
+  ++current.calls;
+  real_glVertexAttribP3uiv( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP4UIPROC real_glVertexAttribP4ui;
+static void APIENTRY stats_glVertexAttribP4ui( GLuint index, GLenum type, GLboolean normalized, GLuint value ) {
+
+  ++counts[ 342 ];
+  ++current.calls;
+  real_glVertexAttribP4ui( index, type, normalized, value );
+}
+
+static PFNGLVERTEXATTRIBP4UIVPROC real_glVertexAttribP4uiv;
+static void APIENTRY stats_glVertexAttribP4uiv( GLuint index, GLenum type, GLboolean normalized, const GLuint *value ) {
+
+  ++counts[ 343 ];
+  ++current.calls;
+  real_glVertexAttribP4uiv( index, type, normalized, value );
+}
+
+static PFNGLVERTEXP2UIPROC real_glVertexP2ui;
+static void APIENTRY stats_glVertexP2ui( GLenum type, GLuint value ) {
+
+  ++counts[ 344 ];
+  ++current.calls;
+  real_glVertexP2ui( type, value );
+}
+
+static PFNGLVERTEXP2UIVPROC real_glVertexP2uiv;
+static void APIENTRY stats_glVertexP2uiv( GLenum type, const GLuint *value ) {
+
+  ++counts[ 345 ];
+  ++current.calls;
+  real_glVertexP2uiv( type, value );
+}
+
+static PFNGLVERTEXP3UIPROC real_glVertexP3ui;
+static void APIENTRY stats_glVertexP3ui( GLenum type, GLuint value ) {
+
+  ++counts[ 346 ];
+  ++current.calls;
+  real_glVertexP3ui( type, value );
+}
+
+static PFNGLVERTEXP3UIVPROC real_glVertexP3uiv;
+static void APIENTRY stats_glVertexP3uiv( GLenum type, const GLuint *value ) {
+
+  ++counts[ 347 ];
+  ++current.calls;
+  real_glVertexP3uiv( type, value );
+}
+
+static PFNGLVERTEXP4UIPROC real_glVertexP4ui;
+static void APIENTRY stats_glVertexP4ui( GLenum type, GLuint value ) {
+
+  ++counts[ 348 ];
+  ++current.calls;
+  real_glVertexP4ui( type, value );
+}
+
+static PFNGLVERTEXP4UIVPROC real_glVertexP4uiv;
+static void APIENTRY stats_glVertexP4uiv( GLenum type, const GLuint *value ) {
+
+  ++counts[ 349 ];
+  ++current.calls;
+  real_glVertexP4uiv( type, value );
+}
+
+static PFNGLTEXCOORDP1UIPROC real_glTexCoordP1ui;
+static void APIENTRY stats_glTexCoordP1ui( GLenum type, GLuint coords ) {
+
+  ++counts[ 350 ];
+  ++current.calls;
+  real_glTexCoordP1ui( type, coords );
+}
+
+static PFNGLTEXCOORDP1UIVPROC real_glTexCoordP1uiv;
+static void APIENTRY stats_glTexCoordP1uiv( GLenum type, const GLuint *coords ) {
+
+  ++counts[ 351 ];
+  ++current.calls;
+  real_glTexCoordP1uiv( type, coords );
+}
+
+static PFNGLTEXCOORDP2UIPROC real_glTexCoordP2ui;
+static void APIENTRY stats_glTexCoordP2ui( GLenum type, GLuint coords ) {
+
+  ++counts[ 352 ];
+  ++current.calls;
+  real_glTexCoordP2ui( type, coords );
+}
+
+static PFNGLTEXCOORDP2UIVPROC real_glTexCoordP2uiv;
+static void APIENTRY stats_glTexCoordP2uiv( GLenum type, const GLuint *coords ) {
+
+  ++counts[ 353 ];
+  ++current.calls;
+  real_glTexCoordP2uiv( type, coords );
+}
+
+static PFNGLTEXCOORDP3UIPROC real_glTexCoordP3ui;
+static void APIENTRY stats_glTexCoordP3ui( GLenum type, GLuint coords ) {
+
+  ++counts[ 354 ];
+  ++current.calls;
+  real_glTexCoordP3ui( type, coords );
+}
+
+static PFNGLTEXCOORDP3UIVPROC real_glTexCoordP3uiv;
+static void APIENTRY stats_glTexCoordP3uiv( GLenum type, const GLuint *coords ) {
+
+  ++counts[ 355 ];
+  ++current.calls;
+  real_glTexCoordP3uiv( type, coords );
+}
+
+static PFNGLTEXCOORDP4UIPROC real_glTexCoordP4ui;
+static void APIENTRY stats_glTexCoordP4ui( GLenum type, GLuint coords ) {
+
+  ++counts[ 356 ];
+  ++current.calls;
+  real_glTexCoordP4ui( type, coords );
+}
+
+static PFNGLTEXCOORDP4UIVPROC real_glTexCoordP4uiv;
+static void APIENTRY stats_glTexCoordP4uiv( GLenum type, const GLuint *coords ) {
+
+  ++counts[ 357 ];
+  ++current.calls;
+  real_glTexCoordP4uiv( type, coords );
+}
+
+static PFNGLMULTITEXCOORDP1UIPROC real_glMultiTexCoordP1ui;
+static void APIENTRY stats_glMultiTexCoordP1ui( GLenum texture, GLenum type, GLuint coords ) {
+
+  ++counts[ 358 ];
+  ++current.calls;
+  real_glMultiTexCoordP1ui( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP1UIVPROC real_glMultiTexCoordP1uiv;
+static void APIENTRY stats_glMultiTexCoordP1uiv( GLenum texture, GLenum type, const GLuint *coords ) {
+
+  ++counts[ 359 ];
+  ++current.calls;
+  real_glMultiTexCoordP1uiv( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP2UIPROC real_glMultiTexCoordP2ui;
+static void APIENTRY stats_glMultiTexCoordP2ui( GLenum texture, GLenum type, GLuint coords ) {
+
+  ++counts[ 360 ];
+  ++current.calls;
+  real_glMultiTexCoordP2ui( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP2UIVPROC real_glMultiTexCoordP2uiv;
+static void APIENTRY stats_glMultiTexCoordP2uiv( GLenum texture, GLenum type, const GLuint *coords ) {
+
+  ++counts[ 361 ];
+  ++current.calls;
+  real_glMultiTexCoordP2uiv( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP3UIPROC real_glMultiTexCoordP3ui;
+static void APIENTRY stats_glMultiTexCoordP3ui( GLenum texture, GLenum type, GLuint coords ) {
+
+  ++counts[ 362 ];
+  ++current.calls;
+  real_glMultiTexCoordP3ui( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP3UIVPROC real_glMultiTexCoordP3uiv;
+static void APIENTRY stats_glMultiTexCoordP3uiv( GLenum texture, GLenum type, const GLuint *coords ) {
+
+  ++counts[ 363 ];
+  ++current.calls;
+  real_glMultiTexCoordP3uiv( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP4UIPROC real_glMultiTexCoordP4ui;
+static void APIENTRY stats_glMultiTexCoordP4ui( GLenum texture, GLenum type, GLuint coords ) {
+
+  ++counts[ 364 ];
+  ++current.calls;
+  real_glMultiTexCoordP4ui( texture, type, coords );
+}
+
+static PFNGLMULTITEXCOORDP4UIVPROC real_glMultiTexCoordP4uiv;
+static void APIENTRY stats_glMultiTexCoordP4uiv( GLenum texture, GLenum type, const GLuint *coords ) {
+
+  ++counts[ 365 ];
+  ++current.calls;
+  real_glMultiTexCoordP4uiv( texture, type, coords );
+}
+
+static PFNGLNORMALP3UIPROC real_glNormalP3ui;
+static void APIENTRY stats_glNormalP3ui( GLenum type, GLuint coords ) {
+
+  ++counts[ 366 ];
+  ++current.calls;
+  real_glNormalP3ui( type, coords );
+}
+
+static PFNGLNORMALP3UIVPROC real_glNormalP3uiv;
+static void APIENTRY stats_glNormalP3uiv( GLenum type, const GLuint *coords ) {
+
+  ++counts[ 367 ];
+  ++current.calls;
+  real_glNormalP3uiv( type, coords );
+}
+
+static PFNGLCOLORP3UIPROC real_glColorP3ui;
+static void APIENTRY stats_glColorP3ui( GLenum type, GLuint color ) {
+
+  ++counts[ 368 ];
+  ++current.calls;
+  real_glColorP3ui( type, color );
+}
+
+static PFNGLCOLORP3UIVPROC real_glColorP3uiv;
+static void APIENTRY stats_glColorP3uiv( GLenum type, const GLuint *color ) {
+
+  ++counts[ 369 ];
+  ++current.calls;
+  real_glColorP3uiv( type, color );
+}
+
+static PFNGLCOLORP4UIPROC real_glColorP4ui;
+static void APIENTRY stats_glColorP4ui( GLenum type, GLuint color ) {
+
+  ++counts[ 370 ];
+  ++current.calls;
+  real_glColorP4ui( type, color );
+}
+
+static PFNGLCOLORP4UIVPROC real_glColorP4uiv;
+static void APIENTRY stats_glColorP4uiv( GLenum type, const GLuint *color ) {
+
+  ++counts[ 371 ];
+  ++current.calls;
+  real_glColorP4uiv( type, color );
+}
+
+static PFNGLSECONDARYCOLORP3UIPROC real_glSecondaryColorP3ui;
+static void APIENTRY stats_glSecondaryColorP3ui( GLenum type, GLuint color ) {
+
+  ++counts[ 372 ];
+  ++current.calls;
+  real_glSecondaryColorP3ui( type, color );
+}
+
+static PFNGLSECONDARYCOLORP3UIVPROC real_glSecondaryColorP3uiv;
+static void APIENTRY stats_glSecondaryColorP3uiv( GLenum type, const GLuint *color ) {
+
+  ++counts[ 373 ];
+  ++current.calls;
+  real_glSecondaryColorP3uiv( type, color );
+}
+
+// Any function pointer type will do, they all get cast back before use
+typedef void (APIENTRYP gl_stats_proc)( void );
+
+static const struct {
+  const char *name;
+  gl_stats_proc *pointer;
+  gl_stats_proc *real;
+  gl_stats_proc wrapper;
+} functions[ GL_STATS_FUNCTIONS ] = {
+  { "glCullFace", (gl_stats_proc*) &glad_glCullFace, (gl_stats_proc*) &real_glCullFace, (gl_stats_proc) stats_glCullFace },
+  { "glFrontFace", (gl_stats_proc*) &glad_glFrontFace, (gl_stats_proc*) &real_glFrontFace, (gl_stats_proc) stats_glFrontFace },
+  { "glHint", (gl_stats_proc*) &glad_glHint, (gl_stats_proc*) &real_glHint, (gl_stats_proc) stats_glHint },
+  { "glLineWidth", (gl_stats_proc*) &glad_glLineWidth, (gl_stats_proc*) &real_glLineWidth, (gl_stats_proc) stats_glLineWidth },
+  { "glPointSize", (gl_stats_proc*) &glad_glPointSize, (gl_stats_proc*) &real_glPointSize, (gl_stats_proc) stats_glPointSize },
+  { "glPolygonMode", (gl_stats_proc*) &glad_glPolygonMode, (gl_stats_proc*) &real_glPolygonMode, (gl_stats_proc) stats_glPolygonMode },
+  { "glScissor", (gl_stats_proc*) &glad_glScissor, (gl_stats_proc*) &real_glScissor, (gl_stats_proc) stats_glScissor },
+  { "glTexParameterf", (gl_stats_proc*) &glad_glTexParameterf, (gl_stats_proc*) &real_glTexParameterf, (gl_stats_proc) stats_glTexParameterf },
+  { "glTexParameterfv", (gl_stats_proc*) &glad_glTexParameterfv, (gl_stats_proc*) &real_glTexParameterfv, (gl_stats_proc) stats_glTexParameterfv },
+  { "glTexParameteri", (gl_stats_proc*) &glad_glTexParameteri, (gl_stats_proc*) &real_glTexParameteri, (gl_stats_proc) stats_glTexParameteri },
+  { "glTexParameteriv", (gl_stats_proc*) &glad_glTexParameteriv, (gl_stats_proc*) &real_glTexParameteriv, (gl_stats_proc) stats_glTexParameteriv },
+  { "glTexImage1D", (gl_stats_proc*) &glad_glTexImage1D, (gl_stats_proc*) &real_glTexImage1D, (gl_stats_proc) stats_glTexImage1D },
+  { "glTexImage2D", (gl_stats_proc*) &glad_glTexImage2D, (gl_stats_proc*) &real_glTexImage2D, (gl_stats_proc) stats_glTexImage2D },
+  { "glDrawBuffer", (gl_stats_proc*) &glad_glDrawBuffer, (gl_stats_proc*) &real_glDrawBuffer, (gl_stats_proc) stats_glDrawBuffer },
+  { "glClear", (gl_stats_proc*) &glad_glClear, (gl_stats_proc*) &real_glClear, (gl_stats_proc) stats_glClear },
+  { "glClearColor", (gl_stats_proc*) &glad_glClearColor, (gl_stats_proc*) &real_glClearColor, (gl_stats_proc) stats_glClearColor },
+  { "glClearStencil", (gl_stats_proc*) &glad_glClearStencil, (gl_stats_proc*) &real_glClearStencil, (gl_stats_proc) stats_glClearStencil },
+  { "glClearDepth", (gl_stats_proc*) &glad_glClearDepth, (gl_stats_proc*) &real_glClearDepth, (gl_stats_proc) stats_glClearDepth },
+  { "glStencilMask", (gl_stats_proc*) &glad_glStencilMask, (gl_stats_proc*) &real_glStencilMask, (gl_stats_proc) stats_glStencilMask },
+  { "glColorMask", (gl_stats_proc*) &glad_glColorMask, (gl_stats_proc*) &real_glColorMask, (gl_stats_proc) stats_glColorMask },
+  { "glDepthMask", (gl_stats_proc*) &glad_glDepthMask, (gl_stats_proc*) &real_glDepthMask, (gl_stats_proc) stats_glDepthMask },
+  { "glDisable", (gl_stats_proc*) &glad_glDisable, (gl_stats_proc*) &real_glDisable, (gl_stats_proc) stats_glDisable },
+  { "glEnable", (gl_stats_proc*) &glad_glEnable, (gl_stats_proc*) &real_glEnable, (gl_stats_proc) stats_glEnable },
+  { "glFinish", (gl_stats_proc*) &glad_glFinish, (gl_stats_proc*) &real_glFinish, (gl_stats_proc) stats_glFinish },
+  { "glFlush", (gl_stats_proc*) &glad_glFlush, (gl_stats_proc*) &real_glFlush, (gl_stats_proc) stats_glFlush },
+  { "glBlendFunc", (gl_stats_proc*) &glad_glBlendFunc, (gl_stats_proc*) &real_glBlendFunc, (gl_stats_proc) stats_glBlendFunc },
+  { "glLogicOp", (gl_stats_proc*) &glad_glLogicOp, (gl_stats_proc*) &real_glLogicOp, (gl_stats_proc) stats_glLogicOp },
+  { "glStencilFunc", (gl_stats_proc*) &glad_glStencilFunc, (gl_stats_proc*) &real_glStencilFunc, (gl_stats_proc) stats_glStencilFunc },
+  { "glStencilOp", (gl_stats_proc*) &glad_glStencilOp, (gl_stats_proc*) &real_glStencilOp, (gl_stats_proc) stats_glStencilOp },
+  { "glDepthFunc", (gl_stats_proc*) &glad_glDepthFunc, (gl_stats_proc*) &real_glDepthFunc, (gl_stats_proc) stats_glDepthFunc },
+  { "glPixelStoref", (gl_stats_proc*) &glad_glPixelStoref, (gl_stats_proc*) &real_glPixelStoref, (gl_stats_proc) stats_glPixelStoref },
+  { "glPixelStorei", (gl_stats_proc*) &glad_glPixelStorei, (gl_stats_proc*) &real_glPixelStorei, (gl_stats_proc) stats_glPixelStorei },
+  { "glReadBuffer", (gl_stats_proc*) &glad_glReadBuffer, (gl_stats_proc*) &real_glReadBuffer, (gl_stats_proc) stats_glReadBuffer },
+  { "glReadPixels", (gl_stats_proc*) &glad_glReadPixels, (gl_stats_proc*) &real_glReadPixels, (gl_stats_proc) stats_glReadPixels },
+  { "glGetBooleanv", (gl_stats_proc*) &glad_glGetBooleanv, (gl_stats_proc*) &real_glGetBooleanv, (gl_stats_proc) stats_glGetBooleanv },
+  { "glGetDoublev", (gl_stats_proc*) &glad_glGetDoublev, (gl_stats_proc*) &real_glGetDoublev, (gl_stats_proc) stats_glGetDoublev },
+  { "glGetError", (gl_stats_proc*) &glad_glGetError, (gl_stats_proc*) &real_glGetError, (gl_stats_proc) stats_glGetError },
+  { "glGetFloatv", (gl_stats_proc*) &glad_glGetFloatv, (gl_stats_proc*) &real_glGetFloatv, (gl_stats_proc) stats_glGetFloatv },
+  { "glGetIntegerv", (gl_stats_proc*) &glad_glGetIntegerv, (gl_stats_proc*) &real_glGetIntegerv, (gl_stats_proc) stats_glGetIntegerv },
+  { "glGetString", (gl_stats_proc*) &glad_glGetString, (gl_stats_proc*) &real_glGetString, (gl_stats_proc) stats_glGetString },
+  { "glGetTexImage", (gl_stats_proc*) &glad_glGetTexImage, (gl_stats_proc*) &real_glGetTexImage, (gl_stats_proc) stats_glGetTexImage },
+  { "glGetTexParameterfv", (gl_stats_proc*) &glad_glGetTexParameterfv, (gl_stats_proc*) &real_glGetTexParameterfv, (gl_stats_proc) stats_glGetTexParameterfv },
+  { "glGetTexParameteriv", (gl_stats_proc*) &glad_glGetTexParameteriv, (gl_stats_proc*) &real_glGetTexParameteriv, (gl_stats_proc) stats_glGetTexParameteriv },
+  { "glGetTexLevelParameterfv", (gl_stats_proc*) &glad_glGetTexLevelParameterfv, (gl_stats_proc*) &real_glGetTexLevelParameterfv, (gl_stats_proc) stats_glGetTexLevelParameterfv },
+  { "glGetTexLevelParameteriv", (gl_stats_proc*) &glad_glGetTexLevelParameteriv, (gl_stats_proc*) &real_glGetTexLevelParameteriv, (gl_stats_proc) stats_glGetTexLevelParameteriv },
+  { "glIsEnabled", (gl_stats_proc*) &glad_glIsEnabled, (gl_stats_proc*) &real_glIsEnabled, (gl_stats_proc) stats_glIsEnabled },
+  { "glDepthRange", (gl_stats_proc*) &glad_glDepthRange, (gl_stats_proc*) &real_glDepthRange, (gl_stats_proc) stats_glDepthRange },
+  { "glViewport", (gl_stats_proc*) &glad_glViewport, (gl_stats_proc*) &real_glViewport, (gl_stats_proc) stats_glViewport },
+  { "glDrawArrays", (gl_stats_proc*) &glad_glDrawArrays, (gl_stats_proc*) &real_glDrawArrays, (gl_stats_proc) stats_glDrawArrays },
+  { "glDrawElements", (gl_stats_proc*) &glad_glDrawElements, (gl_stats_proc*) &real_glDrawElements, (gl_stats_proc) stats_glDrawElements },
+  { "glPolygonOffset", (gl_stats_proc*) &glad_glPolygonOffset, (gl_stats_proc*) &real_glPolygonOffset, (gl_stats_proc) stats_glPolygonOffset },
+  { "glCopyTexImage1D", (gl_stats_proc*) &glad_glCopyTexImage1D, (gl_stats_proc*) &real_glCopyTexImage1D, (gl_stats_proc) stats_glCopyTexImage1D },
+  { "glCopyTexImage2D", (gl_stats_proc*) &glad_glCopyTexImage2D, (gl_stats_proc*) &real_glCopyTexImage2D, (gl_stats_proc) stats_glCopyTexImage2D },
+  { "glCopyTexSubImage1D", (gl_stats_proc*) &glad_glCopyTexSubImage1D, (gl_stats_proc*) &real_glCopyTexSubImage1D, (gl_stats_proc) stats_glCopyTexSubImage1D },
+  { "glCopyTexSubImage2D", (gl_stats_proc*) &glad_glCopyTexSubImage2D, (gl_stats_proc*) &real_glCopyTexSubImage2D, (gl_stats_proc) stats_glCopyTexSubImage2D },
+  { "glTexSubImage1D", (gl_stats_proc*) &glad_glTexSubImage1D, (gl_stats_proc*) &real_glTexSubImage1D, (gl_stats_proc) stats_glTexSubImage1D },
+  { "glTexSubImage2D", (gl_stats_proc*) &glad_glTexSubImage2D, (gl_stats_proc*) &real_glTexSubImage2D, (gl_stats_proc) stats_glTexSubImage2D },
+  { "glBindTexture", (gl_stats_proc*) &glad_glBindTexture, (gl_stats_proc*) &real_glBindTexture, (gl_stats_proc) stats_glBindTexture },
+  { "glDeleteTextures", (gl_stats_proc*) &glad_glDeleteTextures, (gl_stats_proc*) &real_glDeleteTextures, (gl_stats_proc) stats_glDeleteTextures },
+  { "glGenTextures", (gl_stats_proc*) &glad_glGenTextures, (gl_stats_proc*) &real_glGenTextures, (gl_stats_proc) stats_glGenTextures },
+  { "glIsTexture", (gl_stats_proc*) &glad_glIsTexture, (gl_stats_proc*) &real_glIsTexture, (gl_stats_proc) stats_glIsTexture },
+  { "glDrawRangeElements", (gl_stats_proc*) &glad_glDrawRangeElements, (gl_stats_proc*) &real_glDrawRangeElements, (gl_stats_proc) stats_glDrawRangeElements },
+  { "glTexImage3D", (gl_stats_proc*) &glad_glTexImage3D, (gl_stats_proc*) &real_glTexImage3D, (gl_stats_proc) stats_glTexImage3D },
+  { "glTexSubImage3D", (gl_stats_proc*) &glad_glTexSubImage3D, (gl_stats_proc*) &real_glTexSubImage3D, (gl_stats_proc) stats_glTexSubImage3D },
+  { "glCopyTexSubImage3D", (gl_stats_proc*) &glad_glCopyTexSubImage3D, (gl_stats_proc*) &real_glCopyTexSubImage3D, (gl_stats_proc) stats_glCopyTexSubImage3D },
+  { "glActiveTexture", (gl_stats_proc*) &glad_glActiveTexture, (gl_stats_proc*) &real_glActiveTexture, (gl_stats_proc) stats_glActiveTexture },
+  { "glSampleCoverage", (gl_stats_proc*) &glad_glSampleCoverage, (gl_stats_proc*) &real_glSampleCoverage, (gl_stats_proc) stats_glSampleCoverage },
+  { "glCompressedTexImage3D", (gl_stats_proc*) &glad_glCompressedTexImage3D, (gl_stats_proc*) &real_glCompressedTexImage3D, (gl_stats_proc) stats_glCompressedTexImage3D },
+  { "glCompressedTexImage2D", (gl_stats_proc*) &glad_glCompressedTexImage2D, (gl_stats_proc*) &real_glCompressedTexImage2D, (gl_stats_proc) stats_glCompressedTexImage2D },
+  { "glCompressedTexImage1D", (gl_stats_proc*) &glad_glCompressedTexImage1D, (gl_stats_proc*) &real_glCompressedTexImage1D, (gl_stats_proc) stats_glCompressedTexImage1D },
+  { "glCompressedTexSubImage3D", (gl_stats_proc*) &glad_glCompressedTexSubImage3D, (gl_stats_proc*) &real_glCompressedTexSubImage3D, (gl_stats_proc) stats_glCompressedTexSubImage3D },
+  { "glCompressedTexSubImage2D", (gl_stats_proc*) &glad_glCompressedTexSubImage2D, (gl_stats_proc*) &real_glCompressedTexSubImage2D, (gl_stats_proc) stats_glCompressedTexSubImage2D },
+  { "glCompressedTexSubImage1D", (gl_stats_proc*) &glad_glCompressedTexSubImage1D, (gl_stats_proc*) &real_glCompressedTexSubImage1D, (gl_stats_proc) stats_glCompressedTexSubImage1D },
+  { "glGetCompressedTexImage", (gl_stats_proc*) &glad_glGetCompressedTexImage, (gl_stats_proc*) &real_glGetCompressedTexImage, (gl_stats_proc) stats_glGetCompressedTexImage },
+  { "glBlendFuncSeparate", (gl_stats_proc*) &glad_glBlendFuncSeparate, (gl_stats_proc*) &real_glBlendFuncSeparate, (gl_stats_proc) stats_glBlendFuncSeparate },
+  { "glMultiDrawArrays", (gl_stats_proc*) &glad_glMultiDrawArrays, (gl_stats_proc*) &real_glMultiDrawArrays, (gl_stats_proc) stats_glMultiDrawArrays },
+  { "glMultiDrawElements", (gl_stats_proc*) &glad_glMultiDrawElements, (gl_stats_proc*) &real_glMultiDrawElements, (gl_stats_proc) stats_glMultiDrawElements },
+  { "glPointParameterf", (gl_stats_proc*) &glad_glPointParameterf, (gl_stats_proc*) &real_glPointParameterf, (gl_stats_proc) stats_glPointParameterf },
+  { "glPointParameterfv", (gl_stats_proc*) &glad_glPointParameterfv, (gl_stats_proc*) &real_glPointParameterfv, (gl_stats_proc) stats_glPointParameterfv },
+  { "glPointParameteri", (gl_stats_proc*) &glad_glPointParameteri, (gl_stats_proc*) &real_glPointParameteri, (gl_stats_proc) stats_glPointParameteri },
+  { "glPointParameteriv", (gl_stats_proc*) &glad_glPointParameteriv, (gl_stats_proc*) &real_glPointParameteriv, (gl_stats_proc) stats_glPointParameteriv },
+  { "glBlendColor", (gl_stats_proc*) &glad_glBlendColor, (gl_stats_proc*) &real_glBlendColor, (gl_stats_proc) stats_glBlendColor },
+  { "glBlendEquation", (gl_stats_proc*) &glad_glBlendEquation, (gl_stats_proc*) &real_glBlendEquation, (gl_stats_proc) stats_glBlendEquation },
+  { "glGenQueries", (gl_stats_proc*) &glad_glGenQueries, (gl_stats_proc*) &real_glGenQueries, (gl_stats_proc) stats_glGenQueries },
+  { "glDeleteQueries", (gl_stats_proc*) &glad_glDeleteQueries, (gl_stats_proc*) &real_glDeleteQueries, (gl_stats_proc) stats_glDeleteQueries },
+  { "glIsQuery", (gl_stats_proc*) &glad_glIsQuery, (gl_stats_proc*) &real_glIsQuery, (gl_stats_proc) stats_glIsQuery },
+  { "glBeginQuery", (gl_stats_proc*) &glad_glBeginQuery, (gl_stats_proc*) &real_glBeginQuery, (gl_stats_proc) stats_glBeginQuery },
+  { "glEndQuery", (gl_stats_proc*) &glad_glEndQuery, (gl_stats_proc*) &real_glEndQuery, (gl_stats_proc) stats_glEndQuery },
+  { "glGetQueryiv", (gl_stats_proc*) &glad_glGetQueryiv, (gl_stats_proc*) &real_glGetQueryiv, (gl_stats_proc) stats_glGetQueryiv },
+  { "glGetQueryObjectiv", (gl_stats_proc*) &glad_glGetQueryObjectiv, (gl_stats_proc*) &real_glGetQueryObjectiv, (gl_stats_proc) stats_glGetQueryObjectiv },
+  { "glGetQueryObjectuiv", (gl_stats_proc*) &glad_glGetQueryObjectuiv, (gl_stats_proc*) &real_glGetQueryObjectuiv, (gl_stats_proc) stats_glGetQueryObjectuiv },
+  { "glBindBuffer", (gl_stats_proc*) &glad_glBindBuffer, (gl_stats_proc*) &real_glBindBuffer, (gl_stats_proc) stats_glBindBuffer },
+  { "glDeleteBuffers", (gl_stats_proc*) &glad_glDeleteBuffers, (gl_stats_proc*) &real_glDeleteBuffers, (gl_stats_proc) stats_glDeleteBuffers },
+  { "glGenBuffers", (gl_stats_proc*) &glad_glGenBuffers, (gl_stats_proc*) &real_glGenBuffers, (gl_stats_proc) stats_glGenBuffers },
+  { "glIsBuffer", (gl_stats_proc*) &glad_glIsBuffer, (gl_stats_proc*) &real_glIsBuffer, (gl_stats_proc) stats_glIsBuffer },
+  { "glBufferData", (gl_stats_proc*) &glad_glBufferData, (gl_stats_proc*) &real_glBufferData, (gl_stats_proc) stats_glBufferData },
+  { "glBufferSubData", (gl_stats_proc*) &glad_glBufferSubData, (gl_stats_proc*) &real_glBufferSubData, (gl_stats_proc) stats_glBufferSubData },
+  { "glGetBufferSubData", (gl_stats_proc*) &glad_glGetBufferSubData, (gl_stats_proc*) &real_glGetBufferSubData, (gl_stats_proc) stats_glGetBufferSubData },
+  { "glMapBuffer", (gl_stats_proc*) &glad_glMapBuffer, (gl_stats_proc*) &real_glMapBuffer, (gl_stats_proc) stats_glMapBuffer },
+  { "glUnmapBuffer", (gl_stats_proc*) &glad_glUnmapBuffer, (gl_stats_proc*) &real_glUnmapBuffer, (gl_stats_proc) stats_glUnmapBuffer },
+  { "glGetBufferParameteriv", (gl_stats_proc*) &glad_glGetBufferParameteriv, (gl_stats_proc*) &real_glGetBufferParameteriv, (gl_stats_proc) stats_glGetBufferParameteriv },
+  { "glGetBufferPointerv", (gl_stats_proc*) &glad_glGetBufferPointerv, (gl_stats_proc*) &real_glGetBufferPointerv, (gl_stats_proc) stats_glGetBufferPointerv },
+  { "glBlendEquationSeparate", (gl_stats_proc*) &glad_glBlendEquationSeparate, (gl_stats_proc*) &real_glBlendEquationSeparate, (gl_stats_proc) stats_glBlendEquationSeparate },
+  { "glDrawBuffers", (gl_stats_proc*) &glad_glDrawBuffers, (gl_stats_proc*) &real_glDrawBuffers, (gl_stats_proc) stats_glDrawBuffers },
+  { "glStencilOpSeparate", (gl_stats_proc*) &glad_glStencilOpSeparate, (gl_stats_proc*) &real_glStencilOpSeparate, (gl_stats_proc) stats_glStencilOpSeparate },
+  { "glStencilFuncSeparate", (gl_stats_proc*) &glad_glStencilFuncSeparate, (gl_stats_proc*) &real_glStencilFuncSeparate, (gl_stats_proc) stats_glStencilFuncSeparate },
+  { "glStencilMaskSeparate", (gl_stats_proc*) &glad_glStencilMaskSeparate, (gl_stats_proc*) &real_glStencilMaskSeparate, (gl_stats_proc) stats_glStencilMaskSeparate },
+  { "glAttachShader", (gl_stats_proc*) &glad_glAttachShader, (gl_stats_proc*) &real_glAttachShader, (gl_stats_proc) stats_glAttachShader },
+  { "glBindAttribLocation", (gl_stats_proc*) &glad_glBindAttribLocation, (gl_stats_proc*) &real_glBindAttribLocation, (gl_stats_proc) stats_glBindAttribLocation },
+  { "glCompileShader", (gl_stats_proc*) &glad_glCompileShader, (gl_stats_proc*) &real_glCompileShader, (gl_stats_proc) stats_glCompileShader },
+  { "glCreateProgram", (gl_stats_proc*) &glad_glCreateProgram, (gl_stats_proc*) &real_glCreateProgram, (gl_stats_proc) stats_glCreateProgram },
+  { "glCreateShader", (gl_stats_proc*) &glad_glCreateShader, (gl_stats_proc*) &real_glCreateShader, (gl_stats_proc) stats_glCreateShader },
+  { "glDeleteProgram", (gl_stats_proc*) &glad_glDeleteProgram, (gl_stats_proc*) &real_glDeleteProgram, (gl_stats_proc) stats_glDeleteProgram },
+  { "glDeleteShader", (gl_stats_proc*) &glad_glDeleteShader, (gl_stats_proc*) &real_glDeleteShader, (gl_stats_proc) stats_glDeleteShader },
+  { "glDetachShader", (gl_stats_proc*) &glad_glDetachShader, (gl_stats_proc*) &real_glDetachShader, (gl_stats_proc) stats_glDetachShader },
+  { "glDisableVertexAttribArray", (gl_stats_proc*) &glad_glDisableVertexAttribArray, (gl_stats_proc*) &real_glDisableVertexAttribArray, (gl_stats_proc) stats_glDisableVertexAttribArray },
+  { "glEnableVertexAttribArray", (gl_stats_proc*) &glad_glEnableVertexAttribArray, (gl_stats_proc*) &real_glEnableVertexAttribArray, (gl_stats_proc) stats_glEnableVertexAttribArray },
+  { "glGetActiveAttrib", (gl_stats_proc*) &glad_glGetActiveAttrib, (gl_stats_proc*) &real_glGetActiveAttrib, (gl_stats_proc) stats_glGetActiveAttrib },
+  { "glGetActiveUniform", (gl_stats_proc*) &glad_glGetActiveUniform, (gl_stats_proc*) &real_glGetActiveUniform, (gl_stats_proc) stats_glGetActiveUniform },
+  { "glGetAttachedShaders", (gl_stats_proc*) &glad_glGetAttachedShaders, (gl_stats_proc*) &real_glGetAttachedShaders, (gl_stats_proc) stats_glGetAttachedShaders },
+  { "glGetAttribLocation", (gl_stats_proc*) &glad_glGetAttribLocation, (gl_stats_proc*) &real_glGetAttribLocation, (gl_stats_proc) stats_glGetAttribLocation },
+  { "glGetProgramiv", (gl_stats_proc*) &glad_glGetProgramiv, (gl_stats_proc*) &real_glGetProgramiv, (gl_stats_proc) stats_glGetProgramiv },
+  { "glGetProgramInfoLog", (gl_stats_proc*) &glad_glGetProgramInfoLog, (gl_stats_proc*) &real_glGetProgramInfoLog, (gl_stats_proc) stats_glGetProgramInfoLog },
+  { "glGetShaderiv", (gl_stats_proc*) &glad_glGetShaderiv, (gl_stats_proc*) &real_glGetShaderiv, (gl_stats_proc) stats_glGetShaderiv },
+  { "glGetShaderInfoLog", (gl_stats_proc*) &glad_glGetShaderInfoLog, (gl_stats_proc*) &real_glGetShaderInfoLog, (gl_stats_proc) stats_glGetShaderInfoLog },
+  { "glGetShaderSource", (gl_stats_proc*) &glad_glGetShaderSource, (gl_stats_proc*) &real_glGetShaderSource, (gl_stats_proc) stats_glGetShaderSource },
+  { "glGetUniformLocation", (gl_stats_proc*) &glad_glGetUniformLocation, (gl_stats_proc*) &real_glGetUniformLocation, (gl_stats_proc) stats_glGetUniformLocation },
+  { "glGetUniformfv", (gl_stats_proc*) &glad_glGetUniformfv, (gl_stats_proc*) &real_glGetUniformfv, (gl_stats_proc) stats_glGetUniformfv },
+  { "glGetUniformiv", (gl_stats_proc*) &glad_glGetUniformiv, (gl_stats_proc*) &real_glGetUniformiv, (gl_stats_proc) stats_glGetUniformiv },
+  { "glGetVertexAttribdv", (gl_stats_proc*) &glad_glGetVertexAttribdv, (gl_stats_proc*) &real_glGetVertexAttribdv, (gl_stats_proc) stats_glGetVertexAttribdv },
+  { "glGetVertexAttribfv", (gl_stats_proc*) &glad_glGetVertexAttribfv, (gl_stats_proc*) &real_glGetVertexAttribfv, (gl_stats_proc) stats_glGetVertexAttribfv },
+  { "glGetVertexAttribiv", (gl_stats_proc*) &glad_glGetVertexAttribiv, (gl_stats_proc*) &real_glGetVertexAttribiv, (gl_stats_proc) stats_glGetVertexAttribiv },
+  { "glGetVertexAttribPointerv", (gl_stats_proc*) &glad_glGetVertexAttribPointerv, (gl_stats_proc*) &real_glGetVertexAttribPointerv, (gl_stats_proc) stats_glGetVertexAttribPointerv },
+  { "glIsProgram", (gl_stats_proc*) &glad_glIsProgram, (gl_stats_proc*) &real_glIsProgram, (gl_stats_proc) stats_glIsProgram },
+  { "glIsShader", (gl_stats_proc*) &glad_glIsShader, (gl_stats_proc*) &real_glIsShader, (gl_stats_proc) stats_glIsShader },
+  { "glLinkProgram", (gl_stats_proc*) &glad_glLinkProgram, (gl_stats_proc*) &real_glLinkProgram, (gl_stats_proc) stats_glLinkProgram },
+  { "glShaderSource", (gl_stats_proc*) &glad_glShaderSource, (gl_stats_proc*) &real_glShaderSource, (gl_stats_proc) stats_glShaderSource },
+  { "glUseProgram", (gl_stats_proc*) &glad_glUseProgram, (gl_stats_proc*) &real_glUseProgram, (gl_stats_proc) stats_glUseProgram },
+  { "glUniform1f", (gl_stats_proc*) &glad_glUniform1f, (gl_stats_proc*) &real_glUniform1f, (gl_stats_proc) stats_glUniform1f },
+  { "glUniform2f", (gl_stats_proc*) &glad_glUniform2f, (gl_stats_proc*) &real_glUniform2f, (gl_stats_proc) stats_glUniform2f },
+  { "glUniform3f", (gl_stats_proc*) &glad_glUniform3f, (gl_stats_proc*) &real_glUniform3f, (gl_stats_proc) stats_glUniform3f },
+  { "glUniform4f", (gl_stats_proc*) &glad_glUniform4f, (gl_stats_proc*) &real_glUniform4f, (gl_stats_proc) stats_glUniform4f },
+  { "glUniform1i", (gl_stats_proc*) &glad_glUniform1i, (gl_stats_proc*) &real_glUniform1i, (gl_stats_proc) stats_glUniform1i },
+  { "glUniform2i", (gl_stats_proc*) &glad_glUniform2i, (gl_stats_proc*) &real_glUniform2i, (gl_stats_proc) stats_glUniform2i },
+  { "glUniform3i", (gl_stats_proc*) &glad_glUniform3i, (gl_stats_proc*) &real_glUniform3i, (gl_stats_proc) stats_glUniform3i },
+  { "glUniform4i", (gl_stats_proc*) &glad_glUniform4i, (gl_stats_proc*) &real_glUniform4i, (gl_stats_proc) stats_glUniform4i },
+  { "glUniform1fv", (gl_stats_proc*) &glad_glUniform1fv, (gl_stats_proc*) &real_glUniform1fv, (gl_stats_proc) stats_glUniform1fv },
+  { "glUniform2fv", (gl_stats_proc*) &glad_glUniform2fv, (gl_stats_proc*) &real_glUniform2fv, (gl_stats_proc) stats_glUniform2fv },
+  { "glUniform3fv", (gl_stats_proc*) &glad_glUniform3fv, (gl_stats_proc*) &real_glUniform3fv, (gl_stats_proc) stats_glUniform3fv },
+  { "glUniform4fv", (gl_stats_proc*) &glad_glUniform4fv, (gl_stats_proc*) &real_glUniform4fv, (gl_stats_proc) stats_glUniform4fv },
+  { "glUniform1iv", (gl_stats_proc*) &glad_glUniform1iv, (gl_stats_proc*) &real_glUniform1iv, (gl_stats_proc) stats_glUniform1iv },
+  { "glUniform2iv", (gl_stats_proc*) &glad_glUniform2iv, (gl_stats_proc*) &real_glUniform2iv, (gl_stats_proc) stats_glUniform2iv },
+  { "glUniform3iv", (gl_stats_proc*) &glad_glUniform3iv, (gl_stats_proc*) &real_glUniform3iv, (gl_stats_proc) stats_glUniform3iv },
+  { "glUniform4iv", (gl_stats_proc*) &glad_glUniform4iv, (gl_stats_proc*) &real_glUniform4iv, (gl_stats_proc) stats_glUniform4iv },
+  { "glUniformMatrix2fv", (gl_stats_proc*) &glad_glUniformMatrix2fv, (gl_stats_proc*) &real_glUniformMatrix2fv, (gl_stats_proc) stats_glUniformMatrix2fv },
+  { "glUniformMatrix3fv", (gl_stats_proc*) &glad_glUniformMatrix3fv, (gl_stats_proc*) &real_glUniformMatrix3fv, (gl_stats_proc) stats_glUniformMatrix3fv },
+  { "glUniformMatrix4fv", (gl_stats_proc*) &glad_glUniformMatrix4fv, (gl_stats_proc*) &real_glUniformMatrix4fv, (gl_stats_proc) stats_glUniformMatrix4fv },
+  { "glValidateProgram", (gl_stats_proc*) &glad_glValidateProgram, (gl_stats_proc*) &real_glValidateProgram, (gl_stats_proc) stats_glValidateProgram },
+  { "glVertexAttrib1d", (gl_stats_proc*) &glad_glVertexAttrib1d, (gl_stats_proc*) &real_glVertexAttrib1d, (gl_stats_proc) stats_glVertexAttrib1d },
+  { "glVertexAttrib1dv", (gl_stats_proc*) &glad_glVertexAttrib1dv, (gl_stats_proc*) &real_glVertexAttrib1dv, (gl_stats_proc) stats_glVertexAttrib1dv },
+  { "glVertexAttrib1f", (gl_stats_proc*) &glad_glVertexAttrib1f, (gl_stats_proc*) &real_glVertexAttrib1f, (gl_stats_proc) stats_glVertexAttrib1f },
+  { "glVertexAttrib1fv", (gl_stats_proc*) &glad_glVertexAttrib1fv, (gl_stats_proc*) &real_glVertexAttrib1fv, (gl_stats_proc) stats_glVertexAttrib1fv },
+  { "glVertexAttrib1s", (gl_stats_proc*) &glad_glVertexAttrib1s, (gl_stats_proc*) &real_glVertexAttrib1s, (gl_stats_proc) stats_glVertexAttrib1s },
+  { "glVertexAttrib1sv", (gl_stats_proc*) &glad_glVertexAttrib1sv, (gl_stats_proc*) &real_glVertexAttrib1sv, (gl_stats_proc) stats_glVertexAttrib1sv },
+  { "glVertexAttrib2d", (gl_stats_proc*) &glad_glVertexAttrib2d, (gl_stats_proc*) &real_glVertexAttrib2d, (gl_stats_proc) stats_glVertexAttrib2d },
+  { "glVertexAttrib2dv", (gl_stats_proc*) &glad_glVertexAttrib2dv, (gl_stats_proc*) &real_glVertexAttrib2dv, (gl_stats_proc) stats_glVertexAttrib2dv },
+  { "glVertexAttrib2f", (gl_stats_proc*) &glad_glVertexAttrib2f, (gl_stats_proc*) &real_glVertexAttrib2f, (gl_stats_proc) stats_glVertexAttrib2f },
+  { "glVertexAttrib2fv", (gl_stats_proc*) &glad_glVertexAttrib2fv, (gl_stats_proc*) &real_glVertexAttrib2fv, (gl_stats_proc) stats_glVertexAttrib2fv },
+  { "glVertexAttrib2s", (gl_stats_proc*) &glad_glVertexAttrib2s, (gl_stats_proc*) &real_glVertexAttrib2s, (gl_stats_proc) stats_glVertexAttrib2s },
+  { "glVertexAttrib2sv", (gl_stats_proc*) &glad_glVertexAttrib2sv, (gl_stats_proc*) &real_glVertexAttrib2sv, (gl_stats_proc) stats_glVertexAttrib2sv },
+  { "glVertexAttrib3d", (gl_stats_proc*) &glad_glVertexAttrib3d, (gl_stats_proc*) &real_glVertexAttrib3d, (gl_stats_proc) stats_glVertexAttrib3d },
+  { "glVertexAttrib3dv", (gl_stats_proc*) &glad_glVertexAttrib3dv, (gl_stats_proc*) &real_glVertexAttrib3dv, (gl_stats_proc) stats_glVertexAttrib3dv },
+  { "glVertexAttrib3f", (gl_stats_proc*) &glad_glVertexAttrib3f, (gl_stats_proc*) &real_glVertexAttrib3f, (gl_stats_proc) stats_glVertexAttrib3f },
+  { "glVertexAttrib3fv", (gl_stats_proc*) &glad_glVertexAttrib3fv, (gl_stats_proc*) &real_glVertexAttrib3fv, (gl_stats_proc) stats_glVertexAttrib3fv },
+  { "glVertexAttrib3s", (gl_stats_proc*) &glad_glVertexAttrib3s, (gl_stats_proc*) &real_glVertexAttrib3s, (gl_stats_proc) stats_glVertexAttrib3s },
+  { "glVertexAttrib3sv", (gl_stats_proc*) &glad_glVertexAttrib3sv, (gl_stats_proc*) &real_glVertexAttrib3sv, (gl_stats_proc) stats_glVertexAttrib3sv },
+  { "glVertexAttrib4Nbv", (gl_stats_proc*) &glad_glVertexAttrib4Nbv, (gl_stats_proc*) &real_glVertexAttrib4Nbv, (gl_stats_proc) stats_glVertexAttrib4Nbv },
+  { "glVertexAttrib4Niv", (gl_stats_proc*) &glad_glVertexAttrib4Niv, (gl_stats_proc*) &real_glVertexAttrib4Niv, (gl_stats_proc) stats_glVertexAttrib4Niv },
+  { "glVertexAttrib4Nsv", (gl_stats_proc*) &glad_glVertexAttrib4Nsv, (gl_stats_proc*) &real_glVertexAttrib4Nsv, (gl_stats_proc) stats_glVertexAttrib4Nsv },
+  { "glVertexAttrib4Nub", (gl_stats_proc*) &glad_glVertexAttrib4Nub, (gl_stats_proc*) &real_glVertexAttrib4Nub, (gl_stats_proc) stats_glVertexAttrib4Nub },
+  { "glVertexAttrib4Nubv", (gl_stats_proc*) &glad_glVertexAttrib4Nubv, (gl_stats_proc*) &real_glVertexAttrib4Nubv, (gl_stats_proc) stats_glVertexAttrib4Nubv },
+  { "glVertexAttrib4Nuiv", (gl_stats_proc*) &glad_glVertexAttrib4Nuiv, (gl_stats_proc*) &real_glVertexAttrib4Nuiv, (gl_stats_proc) stats_glVertexAttrib4Nuiv },
+  { "glVertexAttrib4Nusv", (gl_stats_proc*) &glad_glVertexAttrib4Nusv, (gl_stats_proc*) &real_glVertexAttrib4Nusv, (gl_stats_proc) stats_glVertexAttrib4Nusv },
+  { "glVertexAttrib4bv", (gl_stats_proc*) &glad_glVertexAttrib4bv, (gl_stats_proc*) &real_glVertexAttrib4bv, (gl_stats_proc) stats_glVertexAttrib4bv },
+  { "glVertexAttrib4d", (gl_stats_proc*) &glad_glVertexAttrib4d, (gl_stats_proc*) &real_glVertexAttrib4d, (gl_stats_proc) stats_glVertexAttrib4d },
+  { "glVertexAttrib4dv", (gl_stats_proc*) &glad_glVertexAttrib4dv, (gl_stats_proc*) &real_glVertexAttrib4dv, (gl_stats_proc) stats_glVertexAttrib4dv },
+  { "glVertexAttrib4f", (gl_stats_proc*) &glad_glVertexAttrib4f, (gl_stats_proc*) &real_glVertexAttrib4f, (gl_stats_proc) stats_glVertexAttrib4f },
+  { "glVertexAttrib4fv", (gl_stats_proc*) &glad_glVertexAttrib4fv, (gl_stats_proc*) &real_glVertexAttrib4fv, (gl_stats_proc) stats_glVertexAttrib4fv },
+  { "glVertexAttrib4iv", (gl_stats_proc*) &glad_glVertexAttrib4iv, (gl_stats_proc*) &real_glVertexAttrib4iv, (gl_stats_proc) stats_glVertexAttrib4iv },
+  { "glVertexAttrib4s", (gl_stats_proc*) &glad_glVertexAttrib4s, (gl_stats_proc*) &real_glVertexAttrib4s, (gl_stats_proc) stats_glVertexAttrib4s },
+  { "glVertexAttrib4sv", (gl_stats_proc*) &glad_glVertexAttrib4sv, (gl_stats_proc*) &real_glVertexAttrib4sv, (gl_stats_proc) stats_glVertexAttrib4sv },
+  { "glVertexAttrib4ubv", (gl_stats_proc*) &glad_glVertexAttrib4ubv, (gl_stats_proc*) &real_glVertexAttrib4ubv, (gl_stats_proc) stats_glVertexAttrib4ubv },
+  { "glVertexAttrib4uiv", (gl_stats_proc*) &glad_glVertexAttrib4uiv, (gl_stats_proc*) &real_glVertexAttrib4uiv, (gl_stats_proc) stats_glVertexAttrib4uiv },
+  { "glVertexAttrib4usv", (gl_stats_proc*) &glad_glVertexAttrib4usv, (gl_stats_proc*) &real_glVertexAttrib4usv, (gl_stats_proc) stats_glVertexAttrib4usv },
+  { "glVertexAttribPointer", (gl_stats_proc*) &glad_glVertexAttribPointer, (gl_stats_proc*) &real_glVertexAttribPointer, (gl_stats_proc) stats_glVertexAttribPointer },
+  { "glUniformMatrix2x3fv", (gl_stats_proc*) &glad_glUniformMatrix2x3fv, (gl_stats_proc*) &real_glUniformMatrix2x3fv, (gl_stats_proc) stats_glUniformMatrix2x3fv },
+  { "glUniformMatrix3x2fv", (gl_stats_proc*) &glad_glUniformMatrix3x2fv, (gl_stats_proc*) &real_glUniformMatrix3x2fv, (gl_stats_proc) stats_glUniformMatrix3x2fv },
+  { "glUniformMatrix2x4fv", (gl_stats_proc*) &glad_glUniformMatrix2x4fv, (gl_stats_proc*) &real_glUniformMatrix2x4fv, (gl_stats_proc) stats_glUniformMatrix2x4fv },
+  { "glUniformMatrix4x2fv", (gl_stats_proc*) &glad_glUniformMatrix4x2fv, (gl_stats_proc*) &real_glUniformMatrix4x2fv, (gl_stats_proc) stats_glUniformMatrix4x2fv },
+  { "glUniformMatrix3x4fv", (gl_stats_proc*) &glad_glUniformMatrix3x4fv, (gl_stats_proc*) &real_glUniformMatrix3x4fv, (gl_stats_proc) stats_glUniformMatrix3x4fv },
+  { "glUniformMatrix4x3fv", (gl_stats_proc*) &glad_glUniformMatrix4x3fv, (gl_stats_proc*) &real_glUniformMatrix4x3fv, (gl_stats_proc) stats_glUniformMatrix4x3fv },
+  { "glColorMaski", (gl_stats_proc*) &glad_glColorMaski, (gl_stats_proc*) &real_glColorMaski, (gl_stats_proc) stats_glColorMaski },
+  { "glGetBooleani_v", (gl_stats_proc*) &glad_glGetBooleani_v, (gl_stats_proc*) &real_glGetBooleani_v, (gl_stats_proc) stats_glGetBooleani_v },
+  { "glGetIntegeri_v", (gl_stats_proc*) &glad_glGetIntegeri_v, (gl_stats_proc*) &real_glGetIntegeri_v, (gl_stats_proc) stats_glGetIntegeri_v },
+  { "glEnablei", (gl_stats_proc*) &glad_glEnablei, (gl_stats_proc*) &real_glEnablei, (gl_stats_proc) stats_glEnablei },
+  { "glDisablei", (gl_stats_proc*) &glad_glDisablei, (gl_stats_proc*) &real_glDisablei, (gl_stats_proc) stats_glDisablei },
+  { "glIsEnabledi", (gl_stats_proc*) &glad_glIsEnabledi, (gl_stats_proc*) &real_glIsEnabledi, (gl_stats_proc) stats_glIsEnabledi },
+  { "glBeginTransformFeedback", (gl_stats_proc*) &glad_glBeginTransformFeedback, (gl_stats_proc*) &real_glBeginTransformFeedback, (gl_stats_proc) stats_glBeginTransformFeedback },
+  { "glEndTransformFeedback", (gl_stats_proc*) &glad_glEndTransformFeedback, (gl_stats_proc*) &real_glEndTransformFeedback, (gl_stats_proc) stats_glEndTransformFeedback },
+  { "glBindBufferRange", (gl_stats_proc*) &glad_glBindBufferRange, (gl_stats_proc*) &real_glBindBufferRange, (gl_stats_proc) stats_glBindBufferRange },
+  { "glBindBufferBase", (gl_stats_proc*) &glad_glBindBufferBase, (gl_stats_proc*) &real_glBindBufferBase, (gl_stats_proc) stats_glBindBufferBase },
+  { "glTransformFeedbackVaryings", (gl_stats_proc*) &glad_glTransformFeedbackVaryings, (gl_stats_proc*) &real_glTransformFeedbackVaryings, (gl_stats_proc) stats_glTransformFeedbackVaryings },
+  { "glGetTransformFeedbackVarying", (gl_stats_proc*) &glad_glGetTransformFeedbackVarying, (gl_stats_proc*) &real_glGetTransformFeedbackVarying, (gl_stats_proc) stats_glGetTransformFeedbackVarying },
+  { "glClampColor", (gl_stats_proc*) &glad_glClampColor, (gl_stats_proc*) &real_glClampColor, (gl_stats_proc) stats_glClampColor },
+  { "glBeginConditionalRender", (gl_stats_proc*) &glad_glBeginConditionalRender, (gl_stats_proc*) &real_glBeginConditionalRender, (gl_stats_proc) stats_glBeginConditionalRender },
+  { "glEndConditionalRender", (gl_stats_proc*) &glad_glEndConditionalRender, (gl_stats_proc*) &real_glEndConditionalRender, (gl_stats_proc) stats_glEndConditionalRender },
+  { "glVertexAttribIPointer", (gl_stats_proc*) &glad_glVertexAttribIPointer, (gl_stats_proc*) &real_glVertexAttribIPointer, (gl_stats_proc) stats_glVertexAttribIPointer },
+  { "glGetVertexAttribIiv", (gl_stats_proc*) &glad_glGetVertexAttribIiv, (gl_stats_proc*) &real_glGetVertexAttribIiv, (gl_stats_proc) stats_glGetVertexAttribIiv },
+  { "glGetVertexAttribIuiv", (gl_stats_proc*) &glad_glGetVertexAttribIuiv, (gl_stats_proc*) &real_glGetVertexAttribIuiv, (gl_stats_proc) stats_glGetVertexAttribIuiv },
+  { "glVertexAttribI1i", (gl_stats_proc*) &glad_glVertexAttribI1i, (gl_stats_proc*) &real_glVertexAttribI1i, (gl_stats_proc) stats_glVertexAttribI1i },
+  { "glVertexAttribI2i", (gl_stats_proc*) &glad_glVertexAttribI2i, (gl_stats_proc*) &real_glVertexAttribI2i, (gl_stats_proc) stats_glVertexAttribI2i },
+  { "glVertexAttribI3i", (gl_stats_proc*) &glad_glVertexAttribI3i, (gl_stats_proc*) &real_glVertexAttribI3i, (gl_stats_proc) stats_glVertexAttribI3i },
+  { "glVertexAttribI4i", (gl_stats_proc*) &glad_glVertexAttribI4i, (gl_stats_proc*) &real_glVertexAttribI4i, (gl_stats_proc) stats_glVertexAttribI4i },
+  { "glVertexAttribI1ui", (gl_stats_proc*) &glad_glVertexAttribI1ui, (gl_stats_proc*) &real_glVertexAttribI1ui, (gl_stats_proc) stats_glVertexAttribI1ui },
+  { "glVertexAttribI2ui", (gl_stats_proc*) &glad_glVertexAttribI2ui, (gl_stats_proc*) &real_glVertexAttribI2ui, (gl_stats_proc) stats_glVertexAttribI2ui },
+  { "glVertexAttribI3ui", (gl_stats_proc*) &glad_glVertexAttribI3ui, (gl_stats_proc*) &real_glVertexAttribI3ui, (gl_stats_proc) stats_glVertexAttribI3ui },
+  { "glVertexAttribI4ui", (gl_stats_proc*) &glad_glVertexAttribI4ui, (gl_stats_proc*) &real_glVertexAttribI4ui, (gl_stats_proc) stats_glVertexAttribI4ui },
+  { "glVertexAttribI1iv", (gl_stats_proc*) &glad_glVertexAttribI1iv, (gl_stats_proc*) &real_glVertexAttribI1iv, (gl_stats_proc) stats_glVertexAttribI1iv },
+  { "glVertexAttribI2iv", (gl_stats_proc*) &glad_glVertexAttribI2iv, (gl_stats_proc*) &real_glVertexAttribI2iv, (gl_stats_proc) stats_glVertexAttribI2iv },
+  { "glVertexAttribI3iv", (gl_stats_proc*) &glad_glVertexAttribI3iv, (gl_stats_proc*) &real_glVertexAttribI3iv, (gl_stats_proc) stats_glVertexAttribI3iv },
+  { "glVertexAttribI4iv", (gl_stats_proc*) &glad_glVertexAttribI4iv, (gl_stats_proc*) &real_glVertexAttribI4iv, (gl_stats_proc) stats_glVertexAttribI4iv },
+  { "glVertexAttribI1uiv", (gl_stats_proc*) &glad_glVertexAttribI1uiv, (gl_stats_proc*) &real_glVertexAttribI1uiv, (gl_stats_proc) stats_glVertexAttribI1uiv },
+  { "glVertexAttribI2uiv", (gl_stats_proc*) &glad_glVertexAttribI2uiv, (gl_stats_proc*) &real_glVertexAttribI2uiv, (gl_stats_proc) stats_glVertexAttribI2uiv },
+  { "glVertexAttribI3uiv", (gl_stats_proc*) &glad_glVertexAttribI3uiv, (gl_stats_proc*) &real_glVertexAttribI3uiv, (gl_stats_proc) stats_glVertexAttribI3uiv },
+  { "glVertexAttribI4uiv", (gl_stats_proc*) &glad_glVertexAttribI4uiv, (gl_stats_proc*) &real_glVertexAttribI4uiv, (gl_stats_proc) stats_glVertexAttribI4uiv },
+  { "glVertexAttribI4bv", (gl_stats_proc*) &glad_glVertexAttribI4bv, (gl_stats_proc*) &real_glVertexAttribI4bv, (gl_stats_proc) stats_glVertexAttribI4bv },
+  { "glVertexAttribI4sv", (gl_stats_proc*) &glad_glVertexAttribI4sv, (gl_stats_proc*) &real_glVertexAttribI4sv, (gl_stats_proc) stats_glVertexAttribI4sv },
+  { "glVertexAttribI4ubv", (gl_stats_proc*) &glad_glVertexAttribI4ubv, (gl_stats_proc*) &real_glVertexAttribI4ubv, (gl_stats_proc) stats_glVertexAttribI4ubv },
+  { "glVertexAttribI4usv", (gl_stats_proc*) &glad_glVertexAttribI4usv, (gl_stats_proc*) &real_glVertexAttribI4usv, (gl_stats_proc) stats_glVertexAttribI4usv },
+  { "glGetUniformuiv", (gl_stats_proc*) &glad_glGetUniformuiv, (gl_stats_proc*) &real_glGetUniformuiv, (gl_stats_proc) stats_glGetUniformuiv },
+  { "glBindFragDataLocation", (gl_stats_proc*) &glad_glBindFragDataLocation, (gl_stats_proc*) &real_glBindFragDataLocation, (gl_stats_proc) stats_glBindFragDataLocation },
+  { "glGetFragDataLocation", (gl_stats_proc*) &glad_glGetFragDataLocation, (gl_stats_proc*) &real_glGetFragDataLocation, (gl_stats_proc) stats_glGetFragDataLocation },
+  { "glUniform1ui", (gl_stats_proc*) &glad_glUniform1ui, (gl_stats_proc*) &real_glUniform1ui, (gl_stats_proc) stats_glUniform1ui },
+  { "glUniform2ui", (gl_stats_proc*) &glad_glUniform2ui, (gl_stats_proc*) &real_glUniform2ui, (gl_stats_proc) stats_glUniform2ui },
+  { "glUniform3ui", (gl_stats_proc*) &glad_glUniform3ui, (gl_stats_proc*) &real_glUniform3ui, (gl_stats_proc) stats_glUniform3ui },
+  { "glUniform4ui", (gl_stats_proc*) &glad_glUniform4ui, (gl_stats_proc*) &real_glUniform4ui, (gl_stats_proc) stats_glUniform4ui },
+  { "glUniform1uiv", (gl_stats_proc*) &glad_glUniform1uiv, (gl_stats_proc*) &real_glUniform1uiv, (gl_stats_proc) stats_glUniform1uiv },
+  { "glUniform2uiv", (gl_stats_proc*) &glad_glUniform2uiv, (gl_stats_proc*) &real_glUniform2uiv, (gl_stats_proc) stats_glUniform2uiv },
+  { "glUniform3uiv", (gl_stats_proc*) &glad_glUniform3uiv, (gl_stats_proc*) &real_glUniform3uiv, (gl_stats_proc) stats_glUniform3uiv },
+  { "glUniform4uiv", (gl_stats_proc*) &glad_glUniform4uiv, (gl_stats_proc*) &real_glUniform4uiv, (gl_stats_proc) stats_glUniform4uiv },
+  { "glTexParameterIiv", (gl_stats_proc*) &glad_glTexParameterIiv, (gl_stats_proc*) &real_glTexParameterIiv, (gl_stats_proc) stats_glTexParameterIiv },
+  { "glTexParameterIuiv", (gl_stats_proc*) &glad_glTexParameterIuiv, (gl_stats_proc*) &real_glTexParameterIuiv, (gl_stats_proc) stats_glTexParameterIuiv },
+  { "glGetTexParameterIiv", (gl_stats_proc*) &glad_glGetTexParameterIiv, (gl_stats_proc*) &real_glGetTexParameterIiv, (gl_stats_proc) stats_glGetTexParameterIiv },
+  { "glGetTexParameterIuiv", (gl_stats_proc*) &glad_glGetTexParameterIuiv, (gl_stats_proc*) &real_glGetTexParameterIuiv, (gl_stats_proc) stats_glGetTexParameterIuiv },
+  { "glClearBufferiv", (gl_stats_proc*) &glad_glClearBufferiv, (gl_stats_proc*) &real_glClearBufferiv, (gl_stats_proc) stats_glClearBufferiv },
+  { "glClearBufferuiv", (gl_stats_proc*) &glad_glClearBufferuiv, (gl_stats_proc*) &real_glClearBufferuiv, (gl_stats_proc) stats_glClearBufferuiv },
+  { "glClearBufferfv", (gl_stats_proc*) &glad_glClearBufferfv, (gl_stats_proc*) &real_glClearBufferfv, (gl_stats_proc) stats_glClearBufferfv },
+  { "glClearBufferfi", (gl_stats_proc*) &glad_glClearBufferfi, (gl_stats_proc*) &real_glClearBufferfi, (gl_stats_proc) stats_glClearBufferfi },
+  { "glGetStringi", (gl_stats_proc*) &glad_glGetStringi, (gl_stats_proc*) &real_glGetStringi, (gl_stats_proc) stats_glGetStringi },
+  { "glIsRenderbuffer", (gl_stats_proc*) &glad_glIsRenderbuffer, (gl_stats_proc*) &real_glIsRenderbuffer, (gl_stats_proc) stats_glIsRenderbuffer },
+  { "glBindRenderbuffer", (gl_stats_proc*) &glad_glBindRenderbuffer, (gl_stats_proc*) &real_glBindRenderbuffer, (gl_stats_proc) stats_glBindRenderbuffer },
+  { "glDeleteRenderbuffers", (gl_stats_proc*) &glad_glDeleteRenderbuffers, (gl_stats_proc*) &real_glDeleteRenderbuffers, (gl_stats_proc) stats_glDeleteRenderbuffers },
+  { "glGenRenderbuffers", (gl_stats_proc*) &glad_glGenRenderbuffers, (gl_stats_proc*) &real_glGenRenderbuffers, (gl_stats_proc) stats_glGenRenderbuffers },
+  { "glRenderbufferStorage", (gl_stats_proc*) &glad_glRenderbufferStorage, (gl_stats_proc*) &real_glRenderbufferStorage, (gl_stats_proc) stats_glRenderbufferStorage },
+  { "glGetRenderbufferParameteriv", (gl_stats_proc*) &glad_glGetRenderbufferParameteriv, (gl_stats_proc*) &real_glGetRenderbufferParameteriv, (gl_stats_proc) stats_glGetRenderbufferParameteriv },
+  { "glIsFramebuffer", (gl_stats_proc*) &glad_glIsFramebuffer, (gl_stats_proc*) &real_glIsFramebuffer, (gl_stats_proc) stats_glIsFramebuffer },
+  { "glBindFramebuffer", (gl_stats_proc*) &glad_glBindFramebuffer, (gl_stats_proc*) &real_glBindFramebuffer, (gl_stats_proc) stats_glBindFramebuffer },
+  { "glDeleteFramebuffers", (gl_stats_proc*) &glad_glDeleteFramebuffers, (gl_stats_proc*) &real_glDeleteFramebuffers, (gl_stats_proc) stats_glDeleteFramebuffers },
+  { "glGenFramebuffers", (gl_stats_proc*) &glad_glGenFramebuffers, (gl_stats_proc*) &real_glGenFramebuffers, (gl_stats_proc) stats_glGenFramebuffers },
+  { "glCheckFramebufferStatus", (gl_stats_proc*) &glad_glCheckFramebufferStatus, (gl_stats_proc*) &real_glCheckFramebufferStatus, (gl_stats_proc) stats_glCheckFramebufferStatus },
+  { "glFramebufferTexture1D", (gl_stats_proc*) &glad_glFramebufferTexture1D, (gl_stats_proc*) &real_glFramebufferTexture1D, (gl_stats_proc) stats_glFramebufferTexture1D },
+  { "glFramebufferTexture2D", (gl_stats_proc*) &glad_glFramebufferTexture2D, (gl_stats_proc*) &real_glFramebufferTexture2D, (gl_stats_proc) stats_glFramebufferTexture2D },
+  { "glFramebufferTexture3D", (gl_stats_proc*) &glad_glFramebufferTexture3D, (gl_stats_proc*) &real_glFramebufferTexture3D, (gl_stats_proc) stats_glFramebufferTexture3D },
+  { "glFramebufferRenderbuffer", (gl_stats_proc*) &glad_glFramebufferRenderbuffer, (gl_stats_proc*) &real_glFramebufferRenderbuffer, (gl_stats_proc) stats_glFramebufferRenderbuffer },
+  { "glGetFramebufferAttachmentParameteriv", (gl_stats_proc*) &glad_glGetFramebufferAttachmentParameteriv, (gl_stats_proc*) &real_glGetFramebufferAttachmentParameteriv, (gl_stats_proc) stats_glGetFramebufferAttachmentParameteriv },
+  { "glGenerateMipmap", (gl_stats_proc*) &glad_glGenerateMipmap, (gl_stats_proc*) &real_glGenerateMipmap, (gl_stats_proc) stats_glGenerateMipmap },
+  { "glBlitFramebuffer", (gl_stats_proc*) &glad_glBlitFramebuffer, (gl_stats_proc*) &real_glBlitFramebuffer, (gl_stats_proc) stats_glBlitFramebuffer },
+  { "glRenderbufferStorageMultisample", (gl_stats_proc*) &glad_glRenderbufferStorageMultisample, (gl_stats_proc*) &real_glRenderbufferStorageMultisample, (gl_stats_proc) stats_glRenderbufferStorageMultisample },
+  { "glFramebufferTextureLayer", (gl_stats_proc*) &glad_glFramebufferTextureLayer, (gl_stats_proc*) &real_glFramebufferTextureLayer, (gl_stats_proc) stats_glFramebufferTextureLayer },
+  { "glMapBufferRange", (gl_stats_proc*) &glad_glMapBufferRange, (gl_stats_proc*) &real_glMapBufferRange, (gl_stats_proc) stats_glMapBufferRange },
+  { "glFlushMappedBufferRange", (gl_stats_proc*) &glad_glFlushMappedBufferRange, (gl_stats_proc*) &real_glFlushMappedBufferRange, (gl_stats_proc) stats_glFlushMappedBufferRange },
+  { "glBindVertexArray", (gl_stats_proc*) &glad_glBindVertexArray, (gl_stats_proc*) &real_glBindVertexArray, (gl_stats_proc) stats_glBindVertexArray },
+  { "glDeleteVertexArrays", (gl_stats_proc*) &glad_glDeleteVertexArrays, (gl_stats_proc*) &real_glDeleteVertexArrays, (gl_stats_proc) stats_glDeleteVertexArrays },
+  { "glGenVertexArrays", (gl_stats_proc*) &glad_glGenVertexArrays, (gl_stats_proc*) &real_glGenVertexArrays, (gl_stats_proc) stats_glGenVertexArrays },
+  { "glIsVertexArray", (gl_stats_proc*) &glad_glIsVertexArray, (gl_stats_proc*) &real_glIsVertexArray, (gl_stats_proc) stats_glIsVertexArray },
+  { "glDrawArraysInstanced", (gl_stats_proc*) &glad_glDrawArraysInstanced, (gl_stats_proc*) &real_glDrawArraysInstanced, (gl_stats_proc) stats_glDrawArraysInstanced },
+  { "glDrawElementsInstanced", (gl_stats_proc*) &glad_glDrawElementsInstanced, (gl_stats_proc*) &real_glDrawElementsInstanced, (gl_stats_proc) stats_glDrawElementsInstanced },
+  { "glTexBuffer", (gl_stats_proc*) &glad_glTexBuffer, (gl_stats_proc*) &real_glTexBuffer, (gl_stats_proc) stats_glTexBuffer },
+  { "glPrimitiveRestartIndex", (gl_stats_proc*) &glad_glPrimitiveRestartIndex, (gl_stats_proc*) &real_glPrimitiveRestartIndex, (gl_stats_proc) stats_glPrimitiveRestartIndex },
+  { "glCopyBufferSubData", (gl_stats_proc*) &glad_glCopyBufferSubData, (gl_stats_proc*) &real_glCopyBufferSubData, (gl_stats_proc) stats_glCopyBufferSubData },
+  { "glGetUniformIndices", (gl_stats_proc*) &glad_glGetUniformIndices, (gl_stats_proc*) &real_glGetUniformIndices, (gl_stats_proc) stats_glGetUniformIndices },
+  { "glGetActiveUniformsiv", (gl_stats_proc*) &glad_glGetActiveUniformsiv, (gl_stats_proc*) &real_glGetActiveUniformsiv, (gl_stats_proc) stats_glGetActiveUniformsiv },
+  { "glGetActiveUniformName", (gl_stats_proc*) &glad_glGetActiveUniformName, (gl_stats_proc*) &real_glGetActiveUniformName, (gl_stats_proc) stats_glGetActiveUniformName },
+  { "glGetUniformBlockIndex", (gl_stats_proc*) &glad_glGetUniformBlockIndex, (gl_stats_proc*) &real_glGetUniformBlockIndex, (gl_stats_proc) stats_glGetUniformBlockIndex },
+  { "glGetActiveUniformBlockiv", (gl_stats_proc*) &glad_glGetActiveUniformBlockiv, (gl_stats_proc*) &real_glGetActiveUniformBlockiv, (gl_stats_proc) stats_glGetActiveUniformBlockiv },
+  { "glGetActiveUniformBlockName", (gl_stats_proc*) &glad_glGetActiveUniformBlockName, (gl_stats_proc*) &real_glGetActiveUniformBlockName, (gl_stats_proc) stats_glGetActiveUniformBlockName },
+  { "glUniformBlockBinding", (gl_stats_proc*) &glad_glUniformBlockBinding, (gl_stats_proc*) &real_glUniformBlockBinding, (gl_stats_proc) stats_glUniformBlockBinding },
+  { "glDrawElementsBaseVertex", (gl_stats_proc*) &glad_glDrawElementsBaseVertex, (gl_stats_proc*) &real_glDrawElementsBaseVertex, (gl_stats_proc) stats_glDrawElementsBaseVertex },
+  { "glDrawRangeElementsBaseVertex", (gl_stats_proc*) &glad_glDrawRangeElementsBaseVertex, (gl_stats_proc*) &real_glDrawRangeElementsBaseVertex, (gl_stats_proc) stats_glDrawRangeElementsBaseVertex },
+  { "glDrawElementsInstancedBaseVertex", (gl_stats_proc*) &glad_glDrawElementsInstancedBaseVertex, (gl_stats_proc*) &real_glDrawElementsInstancedBaseVertex, (gl_stats_proc) stats_glDrawElementsInstancedBaseVertex },
+  { "glMultiDrawElementsBaseVertex", (gl_stats_proc*) &glad_glMultiDrawElementsBaseVertex, (gl_stats_proc*) &real_glMultiDrawElementsBaseVertex, (gl_stats_proc) stats_glMultiDrawElementsBaseVertex },
+  { "glProvokingVertex", (gl_stats_proc*) &glad_glProvokingVertex, (gl_stats_proc*) &real_glProvokingVertex, (gl_stats_proc) stats_glProvokingVertex },
+  { "glFenceSync", (gl_stats_proc*) &glad_glFenceSync, (gl_stats_proc*) &real_glFenceSync, (gl_stats_proc) stats_glFenceSync },
+  { "glIsSync", (gl_stats_proc*) &glad_glIsSync, (gl_stats_proc*) &real_glIsSync, (gl_stats_proc) stats_glIsSync },
+  { "glDeleteSync", (gl_stats_proc*) &glad_glDeleteSync, (gl_stats_proc*) &real_glDeleteSync, (gl_stats_proc) stats_glDeleteSync },
+  { "glClientWaitSync", (gl_stats_proc*) &glad_glClientWaitSync, (gl_stats_proc*) &real_glClientWaitSync, (gl_stats_proc) stats_glClientWaitSync },
+  { "glWaitSync", (gl_stats_proc*) &glad_glWaitSync, (gl_stats_proc*) &real_glWaitSync, (gl_stats_proc) stats_glWaitSync },
+  { "glGetInteger64v", (gl_stats_proc*) &glad_glGetInteger64v, (gl_stats_proc*) &real_glGetInteger64v, (gl_stats_proc) stats_glGetInteger64v },
+  { "glGetSynciv", (gl_stats_proc*) &glad_glGetSynciv, (gl_stats_proc*) &real_glGetSynciv, (gl_stats_proc) stats_glGetSynciv },
+  { "glGetInteger64i_v", (gl_stats_proc*) &glad_glGetInteger64i_v, (gl_stats_proc*) &real_glGetInteger64i_v, (gl_stats_proc) stats_glGetInteger64i_v },
+  { "glGetBufferParameteri64v", (gl_stats_proc*) &glad_glGetBufferParameteri64v, (gl_stats_proc*) &real_glGetBufferParameteri64v, (gl_stats_proc) stats_glGetBufferParameteri64v },
+  { "glFramebufferTexture", (gl_stats_proc*) &glad_glFramebufferTexture, (gl_stats_proc*) &real_glFramebufferTexture, (gl_stats_proc) stats_glFramebufferTexture },
+  { "glTexImage2DMultisample", (gl_stats_proc*) &glad_glTexImage2DMultisample, (gl_stats_proc*) &real_glTexImage2DMultisample, (gl_stats_proc) stats_glTexImage2DMultisample },
+  { "glTexImage3DMultisample", (gl_stats_proc*) &glad_glTexImage3DMultisample, (gl_stats_proc*) &real_glTexImage3DMultisample, (gl_stats_proc) stats_glTexImage3DMultisample },
+  { "glGetMultisamplefv", (gl_stats_proc*) &glad_glGetMultisamplefv, (gl_stats_proc*) &real_glGetMultisamplefv, (gl_stats_proc) stats_glGetMultisamplefv },
+  { "glSampleMaski", (gl_stats_proc*) &glad_glSampleMaski, (gl_stats_proc*) &real_glSampleMaski, (gl_stats_proc) stats_glSampleMaski },
+  { "glBindFragDataLocationIndexed", (gl_stats_proc*) &glad_glBindFragDataLocationIndexed, (gl_stats_proc*) &real_glBindFragDataLocationIndexed, (gl_stats_proc) stats_glBindFragDataLocationIndexed },
+  { "glGetFragDataIndex", (gl_stats_proc*) &glad_glGetFragDataIndex, (gl_stats_proc*) &real_glGetFragDataIndex, (gl_stats_proc) stats_glGetFragDataIndex },
+  { "glGenSamplers", (gl_stats_proc*) &glad_glGenSamplers, (gl_stats_proc*) &real_glGenSamplers, (gl_stats_proc) stats_glGenSamplers },
+  { "glDeleteSamplers", (gl_stats_proc*) &glad_glDeleteSamplers, (gl_stats_proc*) &real_glDeleteSamplers, (gl_stats_proc) stats_glDeleteSamplers },
+  { "glIsSampler", (gl_stats_proc*) &glad_glIsSampler, (gl_stats_proc*) &real_glIsSampler, (gl_stats_proc) stats_glIsSampler },
+  { "glBindSampler", (gl_stats_proc*) &glad_glBindSampler, (gl_stats_proc*) &real_glBindSampler, (gl_stats_proc) stats_glBindSampler },
+  { "glSamplerParameteri", (gl_stats_proc*) &glad_glSamplerParameteri, (gl_stats_proc*) &real_glSamplerParameteri, (gl_stats_proc) stats_glSamplerParameteri },
+  { "glSamplerParameteriv", (gl_stats_proc*) &glad_glSamplerParameteriv, (gl_stats_proc*) &real_glSamplerParameteriv, (gl_stats_proc) stats_glSamplerParameteriv },
+  { "glSamplerParameterf", (gl_stats_proc*) &glad_glSamplerParameterf, (gl_stats_proc*) &real_glSamplerParameterf, (gl_stats_proc) stats_glSamplerParameterf },
+  { "glSamplerParameterfv", (gl_stats_proc*) &glad_glSamplerParameterfv, (gl_stats_proc*) &real_glSamplerParameterfv, (gl_stats_proc) stats_glSamplerParameterfv },
+  { "glSamplerParameterIiv", (gl_stats_proc*) &glad_glSamplerParameterIiv, (gl_stats_proc*) &real_glSamplerParameterIiv, (gl_stats_proc) stats_glSamplerParameterIiv },
+  { "glSamplerParameterIuiv", (gl_stats_proc*) &glad_glSamplerParameterIuiv, (gl_stats_proc*) &real_glSamplerParameterIuiv, (gl_stats_proc) stats_glSamplerParameterIuiv },
+  { "glGetSamplerParameteriv", (gl_stats_proc*) &glad_glGetSamplerParameteriv, (gl_stats_proc*) &real_glGetSamplerParameteriv, (gl_stats_proc) stats_glGetSamplerParameteriv },
+  { "glGetSamplerParameterIiv", (gl_stats_proc*) &glad_glGetSamplerParameterIiv, (gl_stats_proc*) &real_glGetSamplerParameterIiv, (gl_stats_proc) stats_glGetSamplerParameterIiv },
+  { "glGetSamplerParameterfv", (gl_stats_proc*) &glad_glGetSamplerParameterfv, (gl_stats_proc*) &real_glGetSamplerParameterfv, (gl_stats_proc) stats_glGetSamplerParameterfv },
+  { "glGetSamplerParameterIuiv", (gl_stats_proc*) &glad_glGetSamplerParameterIuiv, (gl_stats_proc*) &real_glGetSamplerParameterIuiv, (gl_stats_proc) stats_glGetSamplerParameterIuiv },
+  { "glQueryCounter", (gl_stats_proc*) &glad_glQueryCounter, (gl_stats_proc*) &real_glQueryCounter, (gl_stats_proc) stats_glQueryCounter },
+  { "glGetQueryObjecti64v", (gl_stats_proc*) &glad_glGetQueryObjecti64v, (gl_stats_proc*) &real_glGetQueryObjecti64v, (gl_stats_proc) stats_glGetQueryObjecti64v },
+  { "glGetQueryObjectui64v", (gl_stats_proc*) &glad_glGetQueryObjectui64v, (gl_stats_proc*) &real_glGetQueryObjectui64v, (gl_stats_proc) stats_glGetQueryObjectui64v },
+  { "glVertexAttribDivisor", (gl_stats_proc*) &glad_glVertexAttribDivisor, (gl_stats_proc*) &real_glVertexAttribDivisor, (gl_stats_proc) stats_glVertexAttribDivisor },
+  { "glVertexAttribP1ui", (gl_stats_proc*) &glad_glVertexAttribP1ui, (gl_stats_proc*) &real_glVertexAttribP1ui, (gl_stats_proc) stats_glVertexAttribP1ui },
+  { "glVertexAttribP1uiv", (gl_stats_proc*) &glad_glVertexAttribP1uiv, (gl_stats_proc*) &real_glVertexAttribP1uiv, (gl_stats_proc) stats_glVertexAttribP1uiv },
+  { "glVertexAttribP2ui", (gl_stats_proc*) &glad_glVertexAttribP2ui, (gl_stats_proc*) &real_glVertexAttribP2ui, (gl_stats_proc) stats_glVertexAttribP2ui },
+  { "glVertexAttribP2uiv", (gl_stats_proc*) &glad_glVertexAttribP2uiv, (gl_stats_proc*) &real_glVertexAttribP2uiv, (gl_stats_proc) stats_glVertexAttribP2uiv },
+  { "glVertexAttribP3ui", (gl_stats_proc*) &glad_glVertexAttribP3ui, (gl_stats_proc*) &real_glVertexAttribP3ui, (gl_stats_proc) stats_glVertexAttribP3ui },
+  { "glVertexAttribP3uiv", (gl_stats_proc*) &glad_glVertexAttribP3uiv, (gl_stats_proc*) &real_glVertexAttribP3uiv, (gl_stats_proc) stats_glVertexAttribP3uiv },
+  { "glVertexAttribP4ui", (gl_stats_proc*) &glad_glVertexAttribP4ui, (gl_stats_proc*) &real_glVertexAttribP4ui, (gl_stats_proc) stats_glVertexAttribP4ui },
+  { "glVertexAttribP4uiv", (gl_stats_proc*) &glad_glVertexAttribP4uiv, (gl_stats_proc*) &real_glVertexAttribP4uiv, (gl_stats_proc) stats_glVertexAttribP4uiv },
+  { "glVertexP2ui", (gl_stats_proc*) &glad_glVertexP2ui, (gl_stats_proc*) &real_glVertexP2ui, (gl_stats_proc) stats_glVertexP2ui },
+  { "glVertexP2uiv", (gl_stats_proc*) &glad_glVertexP2uiv, (gl_stats_proc*) &real_glVertexP2uiv, (gl_stats_proc) stats_glVertexP2uiv },
+  { "glVertexP3ui", (gl_stats_proc*) &glad_glVertexP3ui, (gl_stats_proc*) &real_glVertexP3ui, (gl_stats_proc) stats_glVertexP3ui },
+  { "glVertexP3uiv", (gl_stats_proc*) &glad_glVertexP3uiv, (gl_stats_proc*) &real_glVertexP3uiv, (gl_stats_proc) stats_glVertexP3uiv },
+  { "glVertexP4ui", (gl_stats_proc*) &glad_glVertexP4ui, (gl_stats_proc*) &real_glVertexP4ui, (gl_stats_proc) stats_glVertexP4ui },
+  { "glVertexP4uiv", (gl_stats_proc*) &glad_glVertexP4uiv, (gl_stats_proc*) &real_glVertexP4uiv, (gl_stats_proc) stats_glVertexP4uiv },
+  { "glTexCoordP1ui", (gl_stats_proc*) &glad_glTexCoordP1ui, (gl_stats_proc*) &real_glTexCoordP1ui, (gl_stats_proc) stats_glTexCoordP1ui },
+  { "glTexCoordP1uiv", (gl_stats_proc*) &glad_glTexCoordP1uiv, (gl_stats_proc*) &real_glTexCoordP1uiv, (gl_stats_proc) stats_glTexCoordP1uiv },
+  { "glTexCoordP2ui", (gl_stats_proc*) &glad_glTexCoordP2ui, (gl_stats_proc*) &real_glTexCoordP2ui, (gl_stats_proc) stats_glTexCoordP2ui },
+  { "glTexCoordP2uiv", (gl_stats_proc*) &glad_glTexCoordP2uiv, (gl_stats_proc*) &real_glTexCoordP2uiv, (gl_stats_proc) stats_glTexCoordP2uiv },
+  { "glTexCoordP3ui", (gl_stats_proc*) &glad_glTexCoordP3ui, (gl_stats_proc*) &real_glTexCoordP3ui, (gl_stats_proc) stats_glTexCoordP3ui },
+  { "glTexCoordP3uiv", (gl_stats_proc*) &glad_glTexCoordP3uiv, (gl_stats_proc*) &real_glTexCoordP3uiv, (gl_stats_proc) stats_glTexCoordP3uiv },
+  { "glTexCoordP4ui", (gl_stats_proc*) &glad_glTexCoordP4ui, (gl_stats_proc*) &real_glTexCoordP4ui, (gl_stats_proc) stats_glTexCoordP4ui },
+  { "glTexCoordP4uiv", (gl_stats_proc*) &glad_glTexCoordP4uiv, (gl_stats_proc*) &real_glTexCoordP4uiv, (gl_stats_proc) stats_glTexCoordP4uiv },
+  { "glMultiTexCoordP1ui", (gl_stats_proc*) &glad_glMultiTexCoordP1ui, (gl_stats_proc*) &real_glMultiTexCoordP1ui, (gl_stats_proc) stats_glMultiTexCoordP1ui },
+  { "glMultiTexCoordP1uiv", (gl_stats_proc*) &glad_glMultiTexCoordP1uiv, (gl_stats_proc*) &real_glMultiTexCoordP1uiv, (gl_stats_proc) stats_glMultiTexCoordP1uiv },
+  { "glMultiTexCoordP2ui", (gl_stats_proc*) &glad_glMultiTexCoordP2ui, (gl_stats_proc*) &real_glMultiTexCoordP2ui, (gl_stats_proc) stats_glMultiTexCoordP2ui },
+  { "glMultiTexCoordP2uiv", (gl_stats_proc*) &glad_glMultiTexCoordP2uiv, (gl_stats_proc*) &real_glMultiTexCoordP2uiv, (gl_stats_proc) stats_glMultiTexCoordP2uiv },
+  { "glMultiTexCoordP3ui", (gl_stats_proc*) &glad_glMultiTexCoordP3ui, (gl_stats_proc*) &real_glMultiTexCoordP3ui, (gl_stats_proc) stats_glMultiTexCoordP3ui },
+  { "glMultiTexCoordP3uiv", (gl_stats_proc*) &glad_glMultiTexCoordP3uiv, (gl_stats_proc*) &real_glMultiTexCoordP3uiv, (gl_stats_proc) stats_glMultiTexCoordP3uiv },
+  { "glMultiTexCoordP4ui", (gl_stats_proc*) &glad_glMultiTexCoordP4ui, (gl_stats_proc*) &real_glMultiTexCoordP4ui, (gl_stats_proc) stats_glMultiTexCoordP4ui },
+  { "glMultiTexCoordP4uiv", (gl_stats_proc*) &glad_glMultiTexCoordP4uiv, (gl_stats_proc*) &real_glMultiTexCoordP4uiv, (gl_stats_proc) stats_glMultiTexCoordP4uiv },
+  { "glNormalP3ui", (gl_stats_proc*) &glad_glNormalP3ui, (gl_stats_proc*) &real_glNormalP3ui, (gl_stats_proc) stats_glNormalP3ui },
+  { "glNormalP3uiv", (gl_stats_proc*) &glad_glNormalP3uiv, (gl_stats_proc*) &real_glNormalP3uiv, (gl_stats_proc) stats_glNormalP3uiv },
+  { "glColorP3ui", (gl_stats_proc*) &glad_glColorP3ui, (gl_stats_proc*) &real_glColorP3ui, (gl_stats_proc) stats_glColorP3ui },
+  { "glColorP3uiv", (gl_stats_proc*) &glad_glColorP3uiv, (gl_stats_proc*) &real_glColorP3uiv, (gl_stats_proc) stats_glColorP3uiv },
+  { "glColorP4ui", (gl_stats_proc*) &glad_glColorP4ui, (gl_stats_proc*) &real_glColorP4ui, (gl_stats_proc) stats_glColorP4ui },
+  { "glColorP4uiv", (gl_stats_proc*) &glad_glColorP4uiv, (gl_stats_proc*) &real_glColorP4uiv, (gl_stats_proc) stats_glColorP4uiv },
+  { "glSecondaryColorP3ui", (gl_stats_proc*) &glad_glSecondaryColorP3ui, (gl_stats_proc*) &real_glSecondaryColorP3ui, (gl_stats_proc) stats_glSecondaryColorP3ui },
+  { "glSecondaryColorP3uiv", (gl_stats_proc*) &glad_glSecondaryColorP3uiv, (gl_stats_proc*) &real_glSecondaryColorP3uiv, (gl_stats_proc) stats_glSecondaryColorP3uiv },
+};
+
+void gl_stats_install( void ) {
+
+  for ( unsigned i = 0; i < GL_STATS_FUNCTIONS; ++i ) {
+    if ( *functions[ i ].pointer ) {
+      *functions[ i ].real = *functions[ i ].pointer;
+      *functions[ i ].pointer = functions[ i ].wrapper;
+    }
+  }
+}
+
+void gl_stats_end_frame( void ) {
+
+  lastFrame = current;
+  total.calls += current.calls;
+  total.draws += current.draws;
+  total.binds += current.binds;
+  total.uniforms += current.uniforms;
+  total.stateChanges += current.stateChanges;
+  total.bytesUploaded += current.bytesUploaded;
+  current = (gl_stats_frame_t) { 0 };
+}
+
+const gl_stats_frame_t* gl_stats_last_frame( void ) {
+
+  return &lastFrame;
+}
+
+const gl_stats_frame_t* gl_stats_total( void ) {
+
+  return &total;
+}
+
+static int compare_counts( const void *a, const void *b ) {
+
+  unsigned long long x = counts[ *(const unsigned*) a ];
+  unsigned long long y = counts[ *(const unsigned*) b ];
+
+  return ( x < y ) - ( x > y );
+}
+
+void gl_stats_print( FILE *out, unsigned maxFunctions ) {
+
+  static unsigned order[ GL_STATS_FUNCTIONS ];
+
+  for ( unsigned i = 0; i < GL_STATS_FUNCTIONS; ++i )
+    order[ i ] = i;
+
+  qsort( order, GL_STATS_FUNCTIONS, sizeof( unsigned ), compare_counts );
+
+  fprintf( out, "GL calls: %llu, draws: %llu, binds: %llu, uniforms: %llu, state changes: %llu, uploaded: %llu bytes\n",
+    total.calls, total.draws, total.binds, total.uniforms, total.stateChanges, total.bytesUploaded );
+
+  for ( unsigned i = 0; i < maxFunctions && i < GL_STATS_FUNCTIONS && counts[ order[ i ] ]; ++i )
+    fprintf( out, "  %-32s %llu\n", functions[ order[ i ] ].name, counts[ order[ i ] ] );
+}
+
+#endif
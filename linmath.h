@@ -0,0 +1,154 @@
+#ifndef LINMATH_H
+#define LINMATH_H
+
+#include <math.h>
+
+// Strict C99 doesn't have it
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+typedef struct vec3 {
+  float x;
+  float y;
+  float z;
+} vec3_t;
+
+// Column-major like GLSL, m[ column * 4 + row ]
+typedef struct mat4 {
+  float m[ 16 ];
+} mat4_t;
+
+// Axis-aligned bounding box
+typedef struct aabb {
+  vec3_t min;
+  vec3_t max;
+} aabb_t;
+
+static inline vec3_t vec3_add( vec3_t a, vec3_t b ) {
+  return (vec3_t) { a.x + b.x, a.y + b.y, a.z + b.z };
+}
+
+static inline vec3_t vec3_sub( vec3_t a, vec3_t b ) {
+  return (vec3_t) { a.x - b.x, a.y - b.y, a.z - b.z };
+}
+
+static inline vec3_t vec3_scale( vec3_t a, float s ) {
+  return (vec3_t) { a.x * s, a.y * s, a.z * s };
+}
+
+static inline float vec3_dot( vec3_t a, vec3_t b ) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+static inline vec3_t vec3_cross( vec3_t a, vec3_t b ) {
+  return (vec3_t) { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+static inline vec3_t vec3_normalize( vec3_t a ) {
+  return vec3_scale( a, 1.0f / sqrtf( vec3_dot( a, a ) ) );
+}
+
+static inline vec3_t vec3_min( vec3_t a, vec3_t b ) {
+  return (vec3_t) { a.x < b.x ? a.x : b.x, a.y < b.y ? a.y : b.y, a.z < b.z ? a.z : b.z };
+}
+
+static inline vec3_t vec3_max( vec3_t a, vec3_t b ) {
+  return (vec3_t) { a.x > b.x ? a.x : b.x, a.y > b.y ? a.y : b.y, a.z > b.z ? a.z : b.z };
+}
+
+static inline aabb_t aabb_union( aabb_t a, aabb_t b ) {
+  return (aabb_t) { vec3_min( a.min, b.min ), vec3_max( a.max, b.max ) };
+}
+
+static inline aabb_t aabb_translate( aabb_t box, vec3_t offset ) {
+  return (aabb_t) { vec3_add( box.min, offset ), vec3_add( box.max, offset ) };
+}
+
+static inline int aabb_contains( aabb_t outer, aabb_t inner ) {
+  return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+    outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+}
+
+// Half the surface area, which is all the BVH cost heuristic needs
+static inline float aabb_area( aabb_t box ) {
+
+  float x = box.max.x - box.min.x;
+  float y = box.max.y - box.min.y;
+  float z = box.max.z - box.min.z;
+
+  return x * y + y * z + z * x;
+}
+
+static inline mat4_t mat4_identity() {
+  return (mat4_t) { { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 } };
+}
+
+static inline mat4_t mat4_mul( const mat4_t *a, const mat4_t *b ) {
+
+  mat4_t r;
+
+  for ( int c = 0; c < 4; ++c ) {
+    for ( int row = 0; row < 4; ++row ) {
+      r.m[ c * 4 + row ] = a->m[ row ] * b->m[ c * 4 ] + a->m[ 4 + row ] * b->m[ c * 4 + 1 ] +
+        a->m[ 8 + row ] * b->m[ c * 4 + 2 ] + a->m[ 12 + row ] * b->m[ c * 4 + 3 ];
+    }
+  }
+
+  return r;
+}
+
+static inline mat4_t mat4_translate( vec3_t t ) {
+
+  mat4_t r = mat4_identity();
+  r.m[ 12 ] = t.x;
+  r.m[ 13 ] = t.y;
+  r.m[ 14 ] = t.z;
+
+  return r;
+}
+
+// Same as glOrtho
+static inline mat4_t mat4_ortho( float left, float right, float bottom, float top, float near, float far ) {
+
+  mat4_t r = mat4_identity();
+  r.m[ 0 ] = 2.0f / ( right - left );
+  r.m[ 5 ] = 2.0f / ( top - bottom );
+  r.m[ 10 ] = -2.0f / ( far - near );
+  r.m[ 12 ] = -( right + left ) / ( right - left );
+  r.m[ 13 ] = -( top + bottom ) / ( top - bottom );
+  r.m[ 14 ] = -( far + near ) / ( far - near );
+
+  return r;
+}
+
+// Same as gluPerspective, fovY in radians
+static inline mat4_t mat4_perspective( float fovY, float aspect, float near, float far ) {
+
+  float f = 1.0f / tanf( fovY * 0.5f );
+  mat4_t r = { { 0 } };
+  r.m[ 0 ] = f / aspect;
+  r.m[ 5 ] = f;
+  r.m[ 10 ] = ( far + near ) / ( near - far );
+  r.m[ 11 ] = -1.0f;
+  r.m[ 14 ] = 2.0f * far * near / ( near - far );
+
+  return r;
+}
+
+// Same as gluLookAt
+static inline mat4_t mat4_look_at( vec3_t eye, vec3_t target, vec3_t up ) {
+
+  vec3_t f = vec3_normalize( vec3_sub( target, eye ) );
+  vec3_t s = vec3_normalize( vec3_cross( f, up ) );
+  vec3_t u = vec3_cross( s, f );
+
+  return (mat4_t) { {
+    s.x, u.x, -f.x, 0.0f,
+    s.y, u.y, -f.y, 0.0f,
+    s.z, u.z, -f.z, 0.0f,
+    -vec3_dot( s, eye ), -vec3_dot( u, eye ), vec3_dot( f, eye ), 1.0f
+  } };
+}
+
+#endif
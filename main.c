@@ -1,7 +1,31 @@
 #include <stdio.h>
 #include <math.h>
 #include <glad/glad.h>
+#include <glad/gl_stats.h>
+#include <string.h>
+#include <stdlib.h>
 #include <SDL2/SDL.h>
+#include "backend.h"
+#include "timing.h"
+#include "frame_stats.h"
+#include "gpu_timer.h"
+#include "profiler.h"
+#include "renderer.h"
+#include "gpu_mem.h"
+#include "mem.h"
+#include "capture.h"
+#include "video.h"
+#include "jobs.h"
+#include "camera.h"
+#include "ubo.h"
+#include "sprite_batch.h"
+#include "tilemap.h"
+#include "gpu_particles.h"
+#include "particles.h"
+#include "ui.h"
+#include "perf_hud.h"
+#include "dynres.h"
+#include "mesh.h"
 
 // Physics and other game-related stuff is running at a different rate than
 // screen updates
@@ -9,282 +33,259 @@
 #define MS_PER_TICK ( 1000.0 / (double) TICKS_PER_SEC )
 #define INITIAL_WIN_W 640
 #define INITIAL_WIN_H 480
-#define MAX_GL_INFO_LOG 512
 #define TOOLBAR_H 100
-
-typedef struct vec3 {
-  float x;
-  float y;
-  float z;
-} vec3_t;
-
-typedef struct shader {
-  unsigned programId;
-} shader_t;
-
-typedef struct game_object {
-  unsigned vao;
-  unsigned vertex_count;
-} game_object_t;
-
-SDL_Window *window;
-SDL_GLContext *glContext;
-
-int r_init() {
-
-  if ( SDL_Init( SDL_INIT_VIDEO ) < 0 ) {
-    fprintf( stderr, "Could not init SDL: %s\n", SDL_GetError() );
-    return 0;
-  }
-
-  SDL_GL_SetAttribute( SDL_GL_CONTEXT_MAJOR_VERSION, 3 );
-  SDL_GL_SetAttribute( SDL_GL_CONTEXT_MINOR_VERSION, 3 );
-  SDL_GL_SetAttribute( SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE );
-
-  window = SDL_CreateWindow(
-    "OpenGL test",
-    SDL_WINDOWPOS_CENTERED,
-    SDL_WINDOWPOS_CENTERED,
-    INITIAL_WIN_W,
-    INITIAL_WIN_H,
-    SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE
-  );
-
-  if ( window == NULL ) {
-    fprintf( stderr, "Could not create window: %s\n", SDL_GetError() );
-    return 0;
-  }
-
-  glContext = SDL_GL_CreateContext( window );
-
-  if ( !gladLoadGLLoader( (GLADloadproc) SDL_GL_GetProcAddress ) ) {
-    fprintf( stderr, "Could not init GLAD\n" );
-    return 0;
-  }
-
-  // Vsync
-  SDL_GL_SetSwapInterval( 1 );
-  glClearColor( 0.0f, 0.5f, 0.0f, 1.0f );
-  /*
-   * "Behind the scenes OpenGL uses the data specified via glViewport to
-   * transform the 2D coordinates it processed to coordinates on your screen.
-   * For example, a processed point of location (-0.5,0.5) would (as its final
-   * transformation) be mapped to (200,450) in screen coordinates. Note that
-   * processed coordinates in OpenGL are between -1 and 1 so we effectively map
-   * from the range (-1 to 1) to (0, 800) and (0, 600)."
-   */
-  glViewport( 0, TOOLBAR_H, INITIAL_WIN_W, INITIAL_WIN_H - TOOLBAR_H );
-
-  return 1;
-}
-
-void r_destroy() {
-
-  SDL_GL_DeleteContext( glContext );
-  SDL_DestroyWindow( window );
-  SDL_Quit();
+// Vsync at 60 Hz
+#define FRAME_BUDGET_MS ( 1000.0 / 60.0 )
+#define FRAME_STATS_JSON "frame_stats.json"
+#define FRAME_STATS_CSV "frame_stats.csv"
+#define PROFILE_TRACE "trace.json"
+// Frames rendered by --headless when no count is given
+#define HEADLESS_FRAMES 600
+// Where screenshots (F12) and --capture frames go
+#define CAPTURE_DIR "."
+// What 'v' records to when no --record path is given
+#define RECORD_PATH "recording.y4m"
+// Frame rate written to the Y4M header, recordings play back at vsync rate
+#define RECORD_FPS 60
+// Imported meshes, named after a hash of their source
+#define MESH_CACHE_DIR "mesh_cache"
+#define MESH_LODS 4
+// Per-object uniforms streamed per frame, 256 bytes per object at most
+#define UNIFORM_RING_BYTES ( 64 << 10 )
+#define SPRITE_CAPACITY 4096
+#define TANKS 16
+#define ATLAS_CACHE "atlas.cache"
+// Tiles, and the world size of one, so that 32 tiles span the view
+#define TILEMAP_SIZE 4096
+#define TILE_SIZE ( 1.0f / 16.0f )
+#define PARTICLE_CAPACITY ( 1 << 18 )
+// A tank blows up this often, with this many particles
+#define EXPLOSION_MS 500
+#define EXPLOSION_PARTICLES 20000
+#if EXPLOSION_PARTICLES > GPU_PARTICLES_SPAWN_MAX
+#error "Explosions don't fit in the GPU particles' spawn buffer"
+#endif
+// Exhaust smoke simulated on the CPU, so that it can bounce off the tanks
+#define EXHAUST_CAPACITY ( 1 << 17 )
+#define EXHAUST_PER_TICK 20
+#define TANK_RADIUS 0.08f
+// How far the arrow keys scroll the camera
+#define PAN_STEP 0.25f
+
+static particles_t exhaust;
+// Advanced by game_tick(), in milliseconds like the render loop's clock
+static double simMs;
+
+// Tanks drive in a circle, angle is the direction they're facing
+static vec3_t tank_position( int i, double ms, float *angle ) {
+
+  float a = (float) ( ms / 2000.0 ) + i * 2.0f * (float) M_PI / TANKS;
+  *angle = a + (float) M_PI / 2.0f;
+
+  return (vec3_t) { cosf( a ) * 0.6f, sinf( a ) * 0.6f, 0.0f };
 }
 
 void game_tick( double dt ) {
 
-  for ( int i = 0; i < dt * 100000; i++ ) ;
-}
-
-const char* get_file_contents( const char *path ) {
-
-  FILE *file = fopen( path, "r" );
-  if ( !file )
-    return NULL;
+  PROFILE_BEGIN( "game_tick" );
 
-  fseek( file, 0L, SEEK_END );
-  long filesize = ftell( file );
-  rewind( file );
+  particle_circle_t tanks[ TANKS ];
 
-  char *ret = (char*) malloc( filesize );
-  char *i = ret;
-  char c;
-
-  while ( ( c = fgetc( file ) ) != EOF ) {
-    *i = c;
-    ++i;
+  for ( int i = 0; i < TANKS; ++i ) {
+    float angle;
+    vec3_t position = tank_position( i, simMs, &angle );
+    vec3_t back = { -cosf( angle ), -sinf( angle ), 0.0f };
+    tanks[ i ] = (particle_circle_t) { position.x, position.y, TANK_RADIUS };
+    particles_emit( &exhaust, vec3_add( position, vec3_scale( back, TANK_RADIUS ) ), vec3_scale( back, 0.3f ), 0.15f, EXHAUST_PER_TICK, 1.5f );
   }
 
-  fclose( file );
-
-  *i = '\0';
+  particles_tick( &exhaust, (float) ( dt / 1000.0 ), tanks, TANKS );
+  simMs += dt;
 
-  return ret;
+  PROFILE_END();
 }
 
-unsigned compile_shader( const char *filePath, GLenum shaderType ) {
+// .y4m files get YUV 4:2:0, anything else raw RGBA frames
+static int start_recording( capture_t *capture, video_t *video, const char *path ) {
 
-  unsigned shader = glCreateShader( shaderType );
-  const char * const shaderStr = get_file_contents( filePath );
+  const char *ext = strrchr( path, '.' );
+  video_format_t format = ext && !strcmp( ext, ".y4m" ) ? VIDEO_Y4M : VIDEO_RAW;
 
-  if ( !shaderStr ) {
-    fprintf( stderr, "File not found: %s\n", filePath );
+  if ( !video_open( video, path, format, RECORD_FPS ) )
     return 0;
-  }
-
-  glShaderSource( shader, 1, &shaderStr, NULL );
-
-  int success = 0;
-  char infoLog[ MAX_GL_INFO_LOG ] = { 0 };
-
-  glCompileShader( shader );
-  glGetShaderiv( shader, GL_COMPILE_STATUS, &success );
 
-  if ( !success ) {
-    glGetShaderInfoLog( shader, MAX_GL_INFO_LOG, NULL, infoLog );
-    fprintf( stderr, "Shader %s compilation failed: %s\n", filePath, infoLog );
+  if ( !capture_init( capture, video_sink, video ) ) {
+    video_close( video );
     return 0;
   }
+  printf( "Recording to %s\n", path );
 
-  return shader;
+  return 1;
 }
 
-shader_t* create_shader( const char *vertexShaderPath, const char *fragShaderPath ) {
-
-  unsigned shaderProgram = glCreateProgram();
-
-  unsigned vertexShader = compile_shader( vertexShaderPath, GL_VERTEX_SHADER );
-  glAttachShader( shaderProgram, vertexShader );
-
-  unsigned fragShader = compile_shader( fragShaderPath, GL_FRAGMENT_SHADER );
-  glAttachShader( shaderProgram, fragShader );
-
-  int success = 0;
-  char infoLog[ MAX_GL_INFO_LOG ] = { 0 };
-
-  glLinkProgram( shaderProgram );
-  glGetProgramiv( shaderProgram, GL_LINK_STATUS, &success );
+static void stop_recording( capture_t *capture, video_t *video ) {
 
-  glDeleteShader( vertexShader );
-  glDeleteShader( fragShader );
-
-  if ( !success ) {
-    glGetProgramInfoLog( shaderProgram, MAX_GL_INFO_LOG, NULL, infoLog );
-    fprintf( stderr, "Shader program linking failed: %s\n", infoLog );
-    return 0;
-  }
-
-  shader_t *ret = malloc( sizeof( shader_t ) );
-  ret->programId = shaderProgram;
-
-  return ret;
+  // Drains the capture ring into the video before it's closed
+  capture_destroy( capture );
+  video_close( video );
+  printf( "Recorded %llu frames (%llu dropped), %.1f MB\n",
+    (unsigned long long) video->frames, (unsigned long long) ( video->dropped + capture->dropped ),
+    video->bytesWritten / ( 1024.0 * 1024.0 ) );
 }
 
-void activate_shader( const shader_t *shader ) {
-  glUseProgram( shader->programId );
-}
+int main( int argc, char **argv ) {
 
-game_object_t* create_object( const vec3_t *locations, const vec3_t *colors, unsigned nVertices ) {
+  PROFILE_INIT();
+  PROFILE_THREAD_NAME( "main" );
 
-  unsigned vao;
-  glGenVertexArrays( 1, &vao );
-  glBindVertexArray( vao );
+  // --headless [frames] renders offscreen, without a window or display server
+  // --capture saves every frame as a PNG
+  // --record path records every frame to a video file
+  int headless = 0;
+  unsigned headlessFrames = HEADLESS_FRAMES;
+  int captureAll = 0;
+  const char *recordPath = NULL;
 
-  unsigned vbo;
-  vec3_t vertices[ nVertices * 2 ]; // VLA
-
-  for ( unsigned i = 0; i < nVertices; ++i ) {
-    vertices[ i ] = locations[ i ];
-    vertices[ nVertices + i ] = colors[ i ];
+  for ( int i = 1; i < argc; ++i ) {
+    if ( !strcmp( argv[ i ], "--headless" ) ) {
+      headless = 1;
+      if ( i + 1 < argc && argv[ i + 1 ][ 0 ] != '-' )
+        headlessFrames = (unsigned) atoi( argv[ ++i ] );
+    }
+    else if ( !strcmp( argv[ i ], "--capture" ) ) {
+      captureAll = 1;
+    }
+    else if ( !strcmp( argv[ i ], "--record" ) && i + 1 < argc ) {
+      recordPath = argv[ ++i ];
+    }
   }
 
-  glGenBuffers( 1, &vbo );
-  // "OpenGL has many types of buffer objects and the buffer type of a vertex
-  // buffer object is GL_ARRAY_BUFFER. OpenGL allows us to bind to several
-  // buffers at once as long as they have a different buffer type."
-  glBindBuffer( GL_ARRAY_BUFFER, vbo );
-  // This apparently transfers data to GPU memory.
-  // https://cognitivewaves.wordpress.com/opengl-terminology-demystified/
-  glBufferData( GL_ARRAY_BUFFER, nVertices * 2 * sizeof( vec3_t ), vertices, GL_STATIC_DRAW );
-
-  // "...the position vertex attribute in the vertex shader with layout (location = 0). This sets the location of the vertex attribute to 0..."
-  // "The vertex attribute is a vec3 so it is composed of 3 values."
-  // "The third argument specifies the type of the data which is GL_FLOAT (a vec* in GLSL consists of floating point values)."
-  // "The next argument specifies if we want the data to be normalized."
-  // "The fifth argument is known as the stride and tells us the space between consecutive vertex attribute sets."
-  // "The last parameter is of type void* and thus requires that weird cast. This is the offset of where the position data begins in the buffer."
-  glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof( float ), (void*) 0 );
-  glEnableVertexAttribArray( 0 );
-
-  glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof( float ), (void*) ( nVertices * sizeof( vec3_t ) ) );
-  glEnableVertexAttribArray( 1 );
-
-  glBindVertexArray( 0 );
-  glBindBuffer( GL_ARRAY_BUFFER, 0 );
-
-  game_object_t *obj = malloc( sizeof( game_object_t ) );
-  if ( !obj )
-    return NULL;
-
-  obj->vao = vao;
-  obj->vertex_count = nVertices;
-
-  return obj;
-}
-
-void render_object( const game_object_t *obj ) {
+  jobs_init( 0 );
 
-  glBindVertexArray( obj->vao );
-  glDrawArrays( GL_TRIANGLES, 0, obj->vertex_count );
-  glBindVertexArray( 0 );
-}
+  if ( !r_init( headless ? &backend_egl : &backend_sdl, INITIAL_WIN_W, INITIAL_WIN_H ) )
+    return 1;
 
-int main() {
+  /*
+   * "Behind the scenes OpenGL uses the data specified via glViewport to
+   * transform the 2D coordinates it processed to coordinates on your screen.
+   * For example, a processed point of location (-0.5,0.5) would (as its final
+   * transformation) be mapped to (200,450) in screen coordinates. Note that
+   * processed coordinates in OpenGL are between -1 and 1 so we effectively map
+   * from the range (-1 to 1) to (0, 800) and (0, 600)."
+   */
+  glViewport( 0, TOOLBAR_H, INITIAL_WIN_W, INITIAL_WIN_H - TOOLBAR_H );
 
-  if ( !r_init() )
+  // The scene renders at a resolution that keeps the GPU within the frame
+  // budget, scaled up into the area above the toolbar. 'r' toggles it.
+  static dynres_t dynres;
+  if ( !dynres_init( &dynres, INITIAL_WIN_W, INITIAL_WIN_H - TOOLBAR_H, FRAME_BUDGET_MS ) )
     return 1;
 
   // ----------------------------------------------------
 
-  game_object_t *obj1 = create_object(
-    (vec3_t[]) { 
-      { -1.0f, -1.0f, 0.0f },
-      { -0.5f, 0.0f, 0.0f },
-      { 0.0f,  -1.0f, 0.0f }
-    },
-    (vec3_t[]) { 
-      { 1.0f, 0.0f, 0.0f },
-      { 0.0f, 1.0f, 0.0f },
-      { 0.0f, 0.0f, 1.0f }
-    },
-    3
-  );
-  game_object_t *obj2 = create_object(
-    (vec3_t[]) {
-      { 0.0f, 0.0f, 0.0f },
-      { 0.5f, 1.0f, 0.0f },
-      { 1.0f,  0.0f, 0.0f }
-    },
-    (vec3_t[]) { 
-      { 1.0f, 1.0f, 1.0f },
-      { 0.666f, 0.666f, 0.666f },
-      { 0.333f, 0.333f, 0.333f }
-    },
-    3
-  );
+  // Imported into MESH_CACHE_DIR on the first run, mapped from there after
+  game_object_t *obj1 = load_mesh( "triangle_rgb.obj", MESH_LODS, MESH_CACHE_DIR );
+  game_object_t *obj2 = load_mesh( "triangle_grey.obj", MESH_LODS, MESH_CACHE_DIR );
+  if ( !obj1 || !obj2 )
+    return 1;
 
   shader_t *shader1 = create_shader( "shader.vert",  "shader.frag" );
   shader_t *shader2 = create_shader( "shader.vert",  "shader2.frag" );
 
+  static bvh_t bvh;
+  bvh_init( &bvh );
+  move_object( &bvh, obj1, (vec3_t) { 0.25f, 0.0f, 0.0f } );
+  move_object( &bvh, obj2, (vec3_t) { 0.0f, 0.0f, 0.0f } );
+  game_object_t *objects[] = { obj1, obj2 };
+  const unsigned nObjects = sizeof( objects ) / sizeof( objects[ 0 ] );
+
+  // Looking down -z at the -1..1 square the scene was made for. Aspect 1
+  // keeps it stretched over the viewport like before there was a camera.
+  camera_t camera;
+  camera_init_ortho( &camera, (vec3_t) { 0.0f, 0.0f, 1.0f }, (vec3_t) { 0.0f, 0.0f, 0.0f }, 2.0f, 0.1f, 10.0f );
+  camera_update( &camera, 1.0f );
+
+  static ubo_ring_t uniformRing;
+  if ( !ubo_ring_init( &uniformRing, UNIFORM_RING_BYTES ) )
+    return 1;
+
+  // Every sprite image goes through the atlas, so that they can share draws
+  static const char * const spriteImages[] = { "tank.png" };
+  enum { SPRITE_TANK };
+  static atlas_t atlas;
+  static sprite_batch_t sprites;
+  if ( !atlas_build( &atlas, spriteImages, sizeof( spriteImages ) / sizeof( spriteImages[ 0 ] ), ATLAS_CACHE ) ||
+    !sprite_batch_init( &sprites, SPRITE_CAPACITY ) )
+    return 1;
+
+  static tilemap_t tilemap;
+  if ( !tilemap_init( &tilemap, TILEMAP_SIZE, TILEMAP_SIZE, TILE_SIZE ) )
+    return 1;
+
+  static gpu_particles_t particles;
+  if ( !gpu_particles_init( &particles, PARTICLE_CAPACITY ) )
+    return 1;
+  if ( !particles_init( &exhaust, EXHAUST_CAPACITY, 1 ) )
+    return 1;
+  static ui_t ui;
+  if ( !ui_init( &ui ) )
+    return 1;
+  // Toolbar text, refreshed once a second so that the UI can stay cached
+  char hudLines[ 2 ][ 128 ] = { "", "" };
+  uint32_t lastExplosion = 0;
+  unsigned explosions = 0;
+
   // ----------------------------------------------------
 
-  Uint32 lastUpdate = SDL_GetTicks();
+  uint32_t lastUpdate = (uint32_t) ( timing_now_ns() / NS_PER_MS );
+  simMs = lastUpdate;
   double updateTimeLeft = 0;
-  Uint32 gameTicks = 0;
+  uint32_t gameTicks = 0;
   unsigned frames = 0;
-  Uint32 fpsStart = lastUpdate;
+  uint32_t fpsStart = lastUpdate;
   SDL_Event event;
   int quit = 0;
+  // The whole run, and the last second for the periodic printout
+  static frame_stats_t frameStats;
+  static frame_stats_t secondStats;
+  frame_stats_init( &frameStats, FRAME_BUDGET_MS );
+  frame_stats_init( &secondStats, FRAME_BUDGET_MS );
+
+  int winW = INITIAL_WIN_W;
+  int winH = INITIAL_WIN_H;
+  // The last size reported by this frame's resize events
+  int resizeW = winW;
+  int resizeH = winH;
+  unsigned resizeEvents = 0;
+  int screenshot = 0;
+  int toggleRecording = 0;
+  // F1 swaps the toolbar for the performance overlay
+  int perfHud = 0;
+  static capture_t capture;
+  // Screenshots and --capture do nothing without their ring
+  int screenshots = capture_init( &capture, capture_png_sink, CAPTURE_DIR );
+  // Recording has its own ring, so that screenshots can still be taken
+  static capture_t recordCapture;
+  static video_t video;
+  int recording = recordPath && start_recording( &recordCapture, &video, recordPath );
+
+  static gpu_timer_t gpuTimer;
+  int gpuTiming = gpu_timer_init( &gpuTimer );
+  uint64_t scaledGpuFrames = 0;
+#ifdef PROFILE
+  uint64_t profiledGpuFrames = 0;
+#endif
 
   printf( "MS_PER_TICK: %f\n", MS_PER_TICK );
 
   while ( !quit ) {
 
-    while ( SDL_PollEvent( &event ) != 0 ) {
+    uint64_t frameStart = timing_now_ns();
+    PROFILE_BEGIN( "frame" );
+    mem_frame_begin();
+
+    PROFILE_BEGIN( "events" );
+    while ( !headless && SDL_PollEvent( &event ) != 0 ) {
       if ( event.type == SDL_QUIT ) {
         quit = 1;
       }
@@ -292,53 +293,293 @@ int main() {
         SDL_Keycode key = event.key.keysym.sym;
         if ( key == SDLK_q )
           quit = 1;
+        else if ( key == SDLK_F12 )
+          screenshot = 1;
+        else if ( key == SDLK_c )
+          captureAll = !captureAll;
+        else if ( key == SDLK_v )
+          toggleRecording = 1;
+        else if ( key == SDLK_F1 )
+          perfHud = !perfHud;
+        else if ( key == SDLK_r )
+          dynres_set_enabled( &dynres, !dynres.enabled );
+        else if ( key == SDLK_LEFT || key == SDLK_RIGHT || key == SDLK_UP || key == SDLK_DOWN ) {
+          vec3_t pan = {
+            key == SDLK_LEFT ? -PAN_STEP : key == SDLK_RIGHT ? PAN_STEP : 0.0f,
+            key == SDLK_DOWN ? -PAN_STEP : key == SDLK_UP ? PAN_STEP : 0.0f,
+            0.0f
+          };
+          camera.position = vec3_add( camera.position, pan );
+          camera.target = vec3_add( camera.target, pan );
+          camera_update( &camera, 1.0f );
+        }
+      }
+      else if ( event.type == SDL_MOUSEMOTION ) {
+        ui_mouse_move( &ui, event.motion.x, event.motion.y );
+      }
+      else if ( ( event.type == SDL_MOUSEBUTTONDOWN || event.type == SDL_MOUSEBUTTONUP ) && event.button.button == SDL_BUTTON_LEFT ) {
+        ui_mouse_move( &ui, event.button.x, event.button.y );
+        ui_mouse_button( &ui, event.type == SDL_MOUSEBUTTONDOWN );
       }
       else if ( event.type == SDL_WINDOWEVENT ) {
         switch ( event.window.event ) {
+          // Both come for a user resize, and a drag sends a stream of
+          // them, so only the last size is kept until after the events
           case SDL_WINDOWEVENT_RESIZED:
           case SDL_WINDOWEVENT_SIZE_CHANGED:
-            glViewport( 0, TOOLBAR_H, event.window.data1, event.window.data2 - TOOLBAR_H );
-            printf( "Window size: %d x %d\n", event.window.data1, event.window.data2 );
+            resizeW = event.window.data1;
+            resizeH = event.window.data2;
+            ++resizeEvents;
             break;
         }
       }
     }
+    PROFILE_END();
+
+    // Everything that depends on the window size, reallocated at most once
+    // a frame. The camera keeps aspect 1, so its projection doesn't change.
+    if ( resizeEvents ) {
+      uint64_t resizeStart = timing_now_ns();
+      int resized = resizeW != winW || resizeH != winH;
+      if ( resized ) {
+        PROFILE_BEGIN( "resize" );
+        winW = resizeW;
+        winH = resizeH;
+        r_resize( winW, winH );
+        glViewport( 0, TOOLBAR_H, winW, winH - TOOLBAR_H );
+        dynres_resize( &dynres, winW, winH - TOOLBAR_H );
+        PROFILE_END();
+      }
+      uint64_t resizeNs = timing_now_ns() - resizeStart;
+      frame_stats_record_resize( &frameStats, resizeEvents, resized, resizeNs );
+      frame_stats_record_resize( &secondStats, resizeEvents, resized, resizeNs );
+      if ( resized )
+        printf( "Window size: %d x %d from %u events, reallocated in %.3f ms\n",
+          winW, winH, resizeEvents, resizeNs / (double) NS_PER_MS );
+      resizeEvents = 0;
+    }
+
+    // From the key or the toolbar button
+    if ( toggleRecording ) {
+      if ( recording ) {
+        stop_recording( &recordCapture, &video );
+        recording = 0;
+      }
+      else {
+        recording = start_recording( &recordCapture, &video, recordPath ? recordPath : RECORD_PATH );
+      }
+      toggleRecording = 0;
+    }
 
-    Uint32 now = SDL_GetTicks();
+    uint32_t now = (uint32_t) ( timing_now_ns() / NS_PER_MS );
     updateTimeLeft += now - lastUpdate;
 
+    uint64_t tickStart = timing_now_ns();
     while ( updateTimeLeft >= MS_PER_TICK ) {
       game_tick( MS_PER_TICK );
       updateTimeLeft -= MS_PER_TICK;
       ++gameTicks;
     }
+    frame_stats_record_tick( &frameStats, timing_now_ns() - tickStart );
 
     // ----------------------------------------------------
 
+    // The resolution for this frame, from the latest GPU timings of the
+    // scaled scene. The UI isn't scaled, and the swap would take in the wait
+    // for vblank.
+    if ( gpuTiming && gpuTimer.completedFrames != scaledGpuFrames ) {
+      dynres_update( &dynres, gpu_timer_zones_ns( &gpuTimer, "clear", "upscale" ) / (float) NS_PER_MS );
+      scaledGpuFrames = gpuTimer.completedFrames;
+    }
+
+    gpu_timer_begin_frame( &gpuTimer );
+    dynres_begin( &dynres );
+
+    int gpuZone = gpu_timer_zone_begin( &gpuTimer, "clear" );
     glClear( GL_COLOR_BUFFER_BIT );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
 
     float lightness = sinf( now / 1000.0f ) / 2.0f + 0.5f;
-    int lightnessLocation = glGetUniformLocation( shader1->programId, "lightness" );
-
+    move_object( &bvh, obj1, (vec3_t) { lightness * 0.5f - 0.25f, 0.0f, 0.0f } );
+
+    PROFILE_BEGIN( "cull" );
+    unsigned visible = cull_objects( &bvh, &camera.frustum, objects, nObjects );
+    PROFILE_END();
+    frame_stats_record_culling( &frameStats, visible, nObjects - visible );
+    frame_stats_record_culling( &secondStats, visible, nObjects - visible );
+
+    // All uniforms for the frame go up in one upload each
+    PROFILE_BEGIN( "uniforms" );
+    frame_block_t frameBlock = { camera.view, camera.projection, camera.viewProjection,
+      { now / 1000.0f, ( now - lastUpdate ) / 1000.0f, dynres.renderHeight / (float) dynres.height, 0.0f } };
+    ubo_frame_update( &frameBlock );
+    ubo_ring_begin( &uniformRing );
+    long obj1Block = push_object_block( &uniformRing, obj1, lightness );
+    long obj2Block = push_object_block( &uniformRing, obj2, 0.5f );
+    tilemap_prepare( &tilemap, &camera.frustum, &uniformRing );
+    ubo_ring_flush( &uniformRing );
+    PROFILE_END();
+
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "tilemap" );
+    tilemap_draw( &tilemap, &uniformRing );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "obj1" );
     activate_shader( shader1 );
-    glUniform1f( lightnessLocation, lightness );
+    bind_object_block( &uniformRing, obj1Block );
     render_object( obj1 );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
 
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "obj2" );
     activate_shader( shader2 );
-    lightnessLocation = glGetUniformLocation( shader2->programId, "lightness" );
-    glUniform1f( lightnessLocation, 0.5 );
+    bind_object_block( &uniformRing, obj2Block );
     render_object( obj2 );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+    ubo_ring_end( &uniformRing );
+
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "exhaust" );
+    particles_draw( &exhaust );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+
+    // Tanks driving in a circle, facing where they're going
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "sprites" );
+    sprite_batch_begin( &sprites );
+    sprite_batch_set_layer( &sprites, 1 );
+    for ( int i = 0; i < TANKS; ++i ) {
+      float angle;
+      vec3_t position = tank_position( i, simMs, &angle );
+      sprite_rect_t rect = { position.x - 0.1f, position.y - 0.1f, 0.2f, 0.2f };
+      sprite_batch_draw_region( &sprites, &atlas.regions[ SPRITE_TANK ], rect, angle, COLOR_WHITE );
+
+      // Tracks, which dirty the chunks the tanks drive over
+      int tx, ty;
+      vec3_t center = { rect.x + rect.w * 0.5f, rect.y + rect.h * 0.5f, 0.0f };
+      if ( tilemap_tile_at( &tilemap, center, &tx, &ty ) && tilemap_get( &tilemap, tx, ty ) == TILE_GRASS )
+        tilemap_set( &tilemap, tx, ty, TILE_DIRT );
+    }
+    sprite_batch_end( &sprites );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+
+    // Explosions over the tanks, taking turns
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "particles" );
+    if ( now - lastExplosion >= EXPLOSION_MS ) {
+      float angle;
+      vec3_t position = tank_position( explosions++ % TANKS, simMs, &angle );
+      gpu_particles_emit( &particles, position, EXPLOSION_PARTICLES, 0.8f, 2.0f );
+      lastExplosion = now;
+    }
+    gpu_particles_update( &particles );
+    gpu_particles_draw( &particles );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "upscale" );
+    dynres_end( &dynres, r_framebuffer(), 0, TOOLBAR_H );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+
+    // The toolbar under the scene, all in one draw
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "ui" );
+    ui_begin( &ui, winW, winH );
+    int toolbarY = winH - TOOLBAR_H;
+    if ( perfHud ) {
+      perf_hud_draw( &ui, 0, toolbarY, winW, TOOLBAR_H, &frameStats, &gpuTimer );
+    }
+    else {
+      ui_rect( &ui, 0, toolbarY, winW, TOOLBAR_H, (color_t) { 30, 30, 30, 255 } );
+      if ( ui_button( &ui, 8, toolbarY + 8, 120, 28, recording ? "Stop" : "Record" ) )
+        toggleRecording = 1;
+      if ( ui_button( &ui, 136, toolbarY + 8, 120, 28, captureAll ? "Capturing" : "Capture" ) )
+        captureAll = !captureAll;
+      if ( ui_button( &ui, 264, toolbarY + 8, 120, 28, "Screenshot" ) )
+        screenshot = 1;
+      ui_text( &ui, 8, toolbarY + 48, 2, COLOR_WHITE, "%s", hudLines[ 0 ] );
+      ui_text( &ui, 8, toolbarY + 70, 2, (color_t) { 180, 180, 180, 255 }, "%s", hudLines[ 1 ] );
+    }
+    ui_end( &ui );
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+
+    if ( captureAll || screenshot || recording )
+      glBindFramebuffer( GL_READ_FRAMEBUFFER, r_framebuffer() );
+    if ( screenshots && ( captureAll || screenshot ) )
+      capture_read( &capture, 0, 0, winW, winH, frameStats.frames );
+    screenshot = 0;
+    if ( screenshots )
+      capture_update( &capture );
+    if ( recording ) {
+      capture_read( &recordCapture, 0, 0, winW, winH, frameStats.frames );
+      capture_update( &recordCapture );
+    }
 
-    // FIXME: "On Mac OS X make sure you bind 0 to the draw framebuffer before
-    // swapping the window, otherwise nothing will happen"
-    SDL_GL_SwapWindow( window );
+    uint64_t cpuEnd = timing_now_ns();
+    gpuZone = gpu_timer_zone_begin( &gpuTimer, "swap" );
+    PROFILE_BEGIN( "swap" );
+    r_present();
+    PROFILE_END();
+    gpu_timer_zone_end( &gpuTimer, gpuZone );
+    gpu_timer_end_frame( &gpuTimer );
+    gl_stats_end_frame();
+    uint64_t presentTime = timing_now_ns();
+    mem_frame_end();
+    PROFILE_END();
+
+#ifdef PROFILE
+    if ( gpuTimer.completedFrames != profiledGpuFrames ) {
+      for ( unsigned i = 0; i < gpuTimer.resultCount; ++i ) {
+        const gpu_zone_result_t *zone = &gpuTimer.results[ i ];
+        PROFILE_GPU_ZONE( zone->name, zone->start_ns, zone->duration_ns );
+      }
+      profiledGpuFrames = gpuTimer.completedFrames;
+    }
+#endif
+    frame_stats_record( &frameStats, cpuEnd - frameStart, presentTime );
+    frame_stats_record( &secondStats, cpuEnd - frameStart, presentTime );
     ++frames;
 
+    if ( headless && frameStats.frames >= headlessFrames )
+      quit = 1;
+
     // ----------------------------------------------------
 
     if ( now - fpsStart >= 1000 ) {
       double dt = ( (double) now - (double) fpsStart ) / 1000.0;
-      printf( "Ticks/sec: %d, FPS: %d\n", (int) ( gameTicks / dt ), (int) ( frames / dt ) );
+      const histogram_t *interval = &secondStats.interval;
+      printf( "Ticks/sec: %d, FPS: %d, frame p50 %.2f p99 %.2f max %.2f ms, over budget: %llu\n",
+        (int) ( gameTicks / dt ), (int) ( frames / dt ),
+        histogram_percentile( interval, 50.0 ) / (double) NS_PER_MS,
+        histogram_percentile( interval, 99.0 ) / (double) NS_PER_MS,
+        interval->max / (double) NS_PER_MS,
+        (unsigned long long) secondStats.interval_over_budget );
+      if ( gpuTiming )
+        gpu_timer_print( &gpuTimer, stdout );
+      printf( "Objects per frame: %.1f visible, %.1f culled\n",
+        secondStats.visible / (double) secondStats.frames, secondStats.culled / (double) secondStats.frames );
+      printf( "Sprites per frame: %u in %u draws\n", sprites.lastSprites, sprites.lastDraws );
+      printf( "Exhaust: %u particles, %llu dropped\n", exhaust.count, exhaust.dropped );
+      printf( "GPU particles: %llu spawned, %llu dropped\n", particles.spawned, particles.dropped );
+      printf( "Tilemap: %u chunk draws, %u baked, %u rebuilt, %u skipped last frame\n",
+        tilemap.lastDraws, tilemap.lastBakes, tilemap.lastRebuilds, tilemap.lastSkipped );
+#ifdef GL_STATS
+      const gl_stats_frame_t *gl = gl_stats_last_frame();
+      printf( "GL per frame: %llu calls, %llu draws, %llu binds, %llu uniforms, %llu state changes, %llu bytes uploaded\n",
+        gl->calls, gl->draws, gl->binds, gl->uniforms, gl->stateChanges, gl->bytesUploaded );
+#endif
+      if ( capture.captured || capture.dropped )
+        printf( "Capture: %llu frames, %llu dropped, %.3f ms on the render thread\n",
+          (unsigned long long) capture.captured, (unsigned long long) capture.dropped,
+          capture.renderThreadNs / (double) NS_PER_MS );
+      if ( recording )
+        printf( "Recording: %llu frames, %llu dropped, %.3f ms on the render thread\n",
+          (unsigned long long) video.frames, (unsigned long long) recordCapture.dropped,
+          recordCapture.renderThreadNs / (double) NS_PER_MS );
+      printf( "Resolution: %d%% (%dx%d of %dx%d), GPU %.2f ms for a %.2f ms budget, %llu changes\n",
+        (int) ( dynres.scale * 100.0f + 0.5f ), dynres.renderWidth, dynres.renderHeight, dynres.width, dynres.height,
+        dynres.gpuMs, dynres.budgetMs, dynres.scaleChanges );
+      printf( "UI: %u quads in %u draws, %llu uploads skipped\n", ui.lastQuads, ui.lastDraws, ui.skippedUploads );
+      snprintf( hudLines[ 0 ], sizeof( hudLines[ 0 ] ), "FPS %d  frame p50 %.2f p99 %.2f ms",
+        (int) ( frames / dt ), histogram_percentile( interval, 50.0 ) / (double) NS_PER_MS,
+        histogram_percentile( interval, 99.0 ) / (double) NS_PER_MS );
+      snprintf( hudLines[ 1 ], sizeof( hudLines[ 1 ] ), "Chunks %u  sprites %u  exhaust %u  res %d%%",
+        tilemap.lastDraws, sprites.lastSprites, exhaust.count, (int) ( dynres.scale * 100.0f + 0.5f ) );
+      frame_stats_reset( &secondStats );
       fpsStart = now;
       gameTicks = 0;
       frames = 0;
@@ -347,7 +588,38 @@ int main() {
     lastUpdate = now;
   }
 
+  frame_stats_print( &frameStats, stdout );
+  frame_stats_write_json( &frameStats, FRAME_STATS_JSON );
+  frame_stats_write_csv( &frameStats, FRAME_STATS_CSV );
+
+  PROFILE_WRITE( PROFILE_TRACE );
+  gl_stats_print( stdout, 20 );
+  gpu_mem_print( stdout );
+  mem_print( stdout );
+
+  if ( screenshots )
+    capture_destroy( &capture );
+  if ( recording )
+    stop_recording( &recordCapture, &video );
+  remove_object( &bvh, obj1 );
+  remove_object( &bvh, obj2 );
+  bvh_destroy( &bvh );
+  ubo_ring_destroy( &uniformRing );
+  sprite_batch_destroy( &sprites );
+  atlas_destroy( &atlas );
+  tilemap_destroy( &tilemap );
+  gpu_particles_destroy( &particles );
+  particles_destroy( &exhaust );
+  ui_destroy( &ui );
+  destroy_object( obj1 );
+  destroy_object( obj2 );
+  destroy_shader( shader1 );
+  destroy_shader( shader2 );
+  gpu_timer_destroy( &gpuTimer );
+  dynres_destroy( &dynres );
   r_destroy();
+  jobs_shutdown();
+  gpu_mem_report_leaks( stderr );
 
   return 0;
 }
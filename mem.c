@@ -0,0 +1,185 @@
+// pthreads are POSIX, which -std=c99 hides by default
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "mem.h"
+
+#define MEM_MAGIC 0x6d656d21u
+// Call sites we've already warned about
+#define MEM_MAX_REPORTED_SITES 64
+
+// Sits in front of every allocation. 16 bytes keeps malloc's alignment.
+typedef struct mem_header {
+  size_t size;
+  uint32_t tag;
+  uint32_t magic;
+} mem_header_t;
+
+static const char * const tagNames[ MEM_TAGS ] = { "renderer", "assets", "sim", "scratch" };
+
+// Updated atomically, worker threads allocate too
+static mem_stats_t stats[ MEM_TAGS ];
+static unsigned frameAllocs[ MEM_TAGS ];
+static size_t frameBytes[ MEM_TAGS ];
+static int inFrame;
+
+static struct {
+  const char *file;
+  int line;
+} reportedSites[ MEM_MAX_REPORTED_SITES ];
+static unsigned nReportedSites;
+// The capture, video and job threads allocate during frames too
+static pthread_mutex_t reportedLock = PTHREAD_MUTEX_INITIALIZER;
+
+static void report_frame_alloc( mem_tag_t tag, size_t size, const char *file, int line ) {
+
+  __atomic_fetch_add( &stats[ tag ].frameAllocs, 1, __ATOMIC_RELAXED );
+  __atomic_fetch_add( &frameAllocs[ tag ], 1, __ATOMIC_RELAXED );
+  __atomic_fetch_add( &frameBytes[ tag ], size, __ATOMIC_RELAXED );
+
+  // Only reached by allocations that are a bug anyway, so the lock is cheap
+  pthread_mutex_lock( &reportedLock );
+
+  for ( unsigned i = 0; i < nReportedSites; ++i ) {
+    if ( reportedSites[ i ].line == line && !strcmp( reportedSites[ i ].file, file ) ) {
+      pthread_mutex_unlock( &reportedLock );
+      return;
+    }
+  }
+
+  if ( nReportedSites < MEM_MAX_REPORTED_SITES ) {
+    reportedSites[ nReportedSites ].file = file;
+    reportedSites[ nReportedSites ].line = line;
+    ++nReportedSites;
+  }
+
+  pthread_mutex_unlock( &reportedLock );
+
+  fprintf( stderr, "Allocation of %zu bytes (%s) inside the frame loop at %s:%d\n", size, tagNames[ tag ], file, line );
+}
+
+static void count_alloc( mem_tag_t tag, size_t size ) {
+
+  mem_stats_t *s = &stats[ tag ];
+  size_t live = __atomic_add_fetch( &s->liveBytes, size, __ATOMIC_RELAXED );
+  __atomic_fetch_add( &s->allocs, 1, __ATOMIC_RELAXED );
+
+  size_t peak = __atomic_load_n( &s->peakBytes, __ATOMIC_RELAXED );
+  while ( live > peak && !__atomic_compare_exchange_n( &s->peakBytes, &peak, live, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+    ;
+}
+
+static void count_free( mem_tag_t tag, size_t size ) {
+
+  __atomic_fetch_sub( &stats[ tag ].liveBytes, size, __ATOMIC_RELAXED );
+  __atomic_fetch_add( &stats[ tag ].frees, 1, __ATOMIC_RELAXED );
+}
+
+void* mem_alloc_at( mem_tag_t tag, size_t size, const char *file, int line ) {
+
+  mem_header_t *header = malloc( sizeof( mem_header_t ) + size );
+  if ( !header )
+    return NULL;
+
+  header->size = size;
+  header->tag = tag;
+  header->magic = MEM_MAGIC;
+
+  count_alloc( tag, size );
+  if ( __atomic_load_n( &inFrame, __ATOMIC_RELAXED ) )
+    report_frame_alloc( tag, size, file, line );
+
+  return header + 1;
+}
+
+void* mem_calloc_at( mem_tag_t tag, size_t count, size_t size, const char *file, int line ) {
+
+  if ( size && count > SIZE_MAX / size )
+    return NULL;
+
+  void *ret = mem_alloc_at( tag, count * size, file, line );
+  if ( ret )
+    memset( ret, 0, count * size );
+
+  return ret;
+}
+
+void* mem_realloc_at( mem_tag_t tag, void *ptr, size_t size, const char *file, int line ) {
+
+  if ( !ptr )
+    return mem_alloc_at( tag, size, file, line );
+
+  mem_header_t *header = (mem_header_t*) ptr - 1;
+  size_t oldSize = header->size;
+
+  header = realloc( header, sizeof( mem_header_t ) + size );
+  if ( !header )
+    return NULL;
+
+  header->size = size;
+  count_free( tag, oldSize );
+  count_alloc( tag, size );
+  if ( __atomic_load_n( &inFrame, __ATOMIC_RELAXED ) )
+    report_frame_alloc( tag, size, file, line );
+
+  return header + 1;
+}
+
+void mem_free( void *ptr ) {
+
+  if ( !ptr )
+    return;
+
+  mem_header_t *header = (mem_header_t*) ptr - 1;
+
+  if ( header->magic != MEM_MAGIC ) {
+    fprintf( stderr, "mem_free() of a pointer not from mem_alloc(): %p\n", ptr );
+    abort();
+  }
+
+  header->magic = 0;
+  count_free( header->tag, header->size );
+  free( header );
+}
+
+void mem_frame_begin() {
+
+  for ( unsigned t = 0; t < MEM_TAGS; ++t ) {
+    __atomic_store_n( &frameAllocs[ t ], 0, __ATOMIC_RELAXED );
+    __atomic_store_n( &frameBytes[ t ], 0, __ATOMIC_RELAXED );
+  }
+
+  __atomic_store_n( &inFrame, 1, __ATOMIC_RELAXED );
+}
+
+void mem_frame_end() {
+
+  __atomic_store_n( &inFrame, 0, __ATOMIC_RELAXED );
+
+  for ( unsigned t = 0; t < MEM_TAGS; ++t ) {
+    stats[ t ].lastFrameAllocs = __atomic_load_n( &frameAllocs[ t ], __ATOMIC_RELAXED );
+    stats[ t ].lastFrameBytes = __atomic_load_n( &frameBytes[ t ], __ATOMIC_RELAXED );
+  }
+}
+
+const mem_stats_t* mem_get_stats( mem_tag_t tag ) {
+  return &stats[ tag ];
+}
+
+const char* mem_tag_name( mem_tag_t tag ) {
+  return tagNames[ tag ];
+}
+
+void mem_print( FILE *out ) {
+
+  fprintf( out, "Heap:\n" );
+
+  for ( unsigned t = 0; t < MEM_TAGS; ++t ) {
+    const mem_stats_t *s = &stats[ t ];
+    fprintf( out, "  %-9s %8zu bytes live, %8zu peak, %llu allocs, %llu frees, %llu in frame loop\n",
+      tagNames[ t ], s->liveBytes, s->peakBytes, s->allocs, s->frees, s->frameAllocs );
+  }
+}
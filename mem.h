@@ -0,0 +1,50 @@
+#ifndef MEM_H
+#define MEM_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/*
+ * Heap allocations tagged with the subsystem they belong to. Keeps live
+ * bytes and allocation counts per tag, and between mem_frame_begin() and
+ * mem_frame_end() counts (and warns about, once per call site) every
+ * allocation, since a steady-state frame shouldn't need any.
+ */
+typedef enum mem_tag {
+  MEM_RENDERER,
+  MEM_ASSETS,
+  MEM_SIM,
+  MEM_SCRATCH,
+  MEM_TAGS
+} mem_tag_t;
+
+typedef struct mem_stats {
+  size_t liveBytes;
+  size_t peakBytes;
+  unsigned long long allocs;
+  unsigned long long frees;
+  // Allocations made inside the frame loop, over the whole run
+  unsigned long long frameAllocs;
+  // Allocations and bytes during the last completed frame
+  unsigned lastFrameAllocs;
+  size_t lastFrameBytes;
+} mem_stats_t;
+
+#define mem_alloc( tag, size ) mem_alloc_at( tag, size, __FILE__, __LINE__ )
+#define mem_calloc( tag, count, size ) mem_calloc_at( tag, count, size, __FILE__, __LINE__ )
+#define mem_realloc( tag, ptr, size ) mem_realloc_at( tag, ptr, size, __FILE__, __LINE__ )
+
+void* mem_alloc_at( mem_tag_t tag, size_t size, const char *file, int line );
+void* mem_calloc_at( mem_tag_t tag, size_t count, size_t size, const char *file, int line );
+// The tag must match the one ptr was allocated with
+void* mem_realloc_at( mem_tag_t tag, void *ptr, size_t size, const char *file, int line );
+void mem_free( void *ptr );
+
+void mem_frame_begin();
+void mem_frame_end();
+
+const mem_stats_t* mem_get_stats( mem_tag_t tag );
+const char* mem_tag_name( mem_tag_t tag );
+void mem_print( FILE *out );
+
+#endif
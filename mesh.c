@@ -0,0 +1,264 @@
+// mmap() and mkdir() are POSIX, which -std=c99 hides by default
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <glad/glad.h>
+#include "mesh.h"
+#include "mesh_import.h"
+#include "gpu_mem.h"
+#include "timing.h"
+#include "mem.h"
+
+#define MESH_PATH_MAX 512
+
+// Position, then an RGBA8 color
+#define MESH_STRIDE 16
+
+// FNV-1a
+static uint64_t hash_bytes( uint64_t hash, const void *data, size_t size ) {
+
+  const unsigned char *bytes = data;
+
+  for ( size_t i = 0; i < size; ++i )
+    hash = ( hash ^ bytes[ i ] ) * 0x100000001b3ull;
+
+  return hash;
+}
+
+static uint64_t align( uint64_t offset ) {
+  return ( offset + MESH_ALIGN - 1 ) / MESH_ALIGN * MESH_ALIGN;
+}
+
+// Read only, unmap with munmap()
+static const unsigned char* map_file( const char *path, size_t *size ) {
+
+  int fd = open( path, O_RDONLY );
+  if ( fd < 0 )
+    return NULL;
+
+  struct stat info;
+  void *data = MAP_FAILED;
+  if ( fstat( fd, &info ) == 0 && info.st_size > 0 )
+    data = mmap( NULL, (size_t) info.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+  // The mapping stays valid without the descriptor
+  close( fd );
+
+  if ( data == MAP_FAILED )
+    return NULL;
+
+  *size = (size_t) info.st_size;
+
+  return data;
+}
+
+static unsigned char color_byte( float c ) {
+  return c <= 0.0f ? 0 : c >= 1.0f ? 255 : (unsigned char) ( c * 255.0f + 0.5f );
+}
+
+// The whole file, in memory
+static unsigned char* pack_mesh( const mesh_data_t *mesh, unsigned nLods, uint64_t key, size_t *size ) {
+
+  mesh_header_t header = { .magic = MESH_CACHE_MAGIC, .version = MESH_CACHE_VERSION, .key = key };
+
+  unsigned *levels = build_lods( mesh->positions, mesh->nVertices, mesh->indices, mesh->nIndices,
+    nLods, header.lods, &header.lodCount );
+  if ( !levels )
+    return NULL;
+
+  const object_lod_t *last = &header.lods[ header.lodCount - 1 ];
+  unsigned nIndices = last->first + last->count;
+  size_t indexSize = mesh->nVertices <= 65536 ? 2 : 4;
+
+  header.vertexCount = mesh->nVertices;
+  header.stride = MESH_STRIDE;
+  header.attributeCount = 2;
+  header.attributes[ 0 ] = (mesh_attribute_t) { 0, 3, GL_FLOAT, 0, 0 };
+  header.attributes[ 1 ] = (mesh_attribute_t) { 1, 4, GL_UNSIGNED_BYTE, 1, 12 };
+  header.indexType = indexSize == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+  header.vertexOffset = align( sizeof( mesh_header_t ) );
+  header.vertexBytes = (uint64_t) mesh->nVertices * MESH_STRIDE;
+  header.indexOffset = align( header.vertexOffset + header.vertexBytes );
+  header.indexBytes = nIndices * indexSize;
+
+  vec3_t min = mesh->positions[ 0 ], max = mesh->positions[ 0 ];
+  for ( unsigned i = 1; i < mesh->nVertices; ++i ) {
+    min = vec3_min( min, mesh->positions[ i ] );
+    max = vec3_max( max, mesh->positions[ i ] );
+  }
+  memcpy( header.boundsMin, &min, sizeof( header.boundsMin ) );
+  memcpy( header.boundsMax, &max, sizeof( header.boundsMax ) );
+
+  *size = header.indexOffset + header.indexBytes;
+  unsigned char *blob = mem_calloc( MEM_SCRATCH, 1, *size );
+  if ( !blob ) {
+    mem_free( levels );
+    return NULL;
+  }
+
+  memcpy( blob, &header, sizeof( header ) );
+
+  unsigned char *vertex = blob + header.vertexOffset;
+  for ( unsigned i = 0; i < mesh->nVertices; ++i, vertex += MESH_STRIDE ) {
+    memcpy( vertex, &mesh->positions[ i ], 12 );
+    vertex[ 12 ] = color_byte( mesh->colors[ i ].x );
+    vertex[ 13 ] = color_byte( mesh->colors[ i ].y );
+    vertex[ 14 ] = color_byte( mesh->colors[ i ].z );
+    vertex[ 15 ] = 255;
+  }
+
+  unsigned char *index = blob + header.indexOffset;
+  for ( unsigned i = 0; i < nIndices; ++i ) {
+    if ( indexSize == 2 ) {
+      uint16_t value = (uint16_t) levels[ i ];
+      memcpy( index + i * 2, &value, 2 );
+    }
+    else {
+      memcpy( index + i * 4, &levels[ i ], 4 );
+    }
+  }
+
+  mem_free( levels );
+
+  return blob;
+}
+
+static void write_cache( const char *cacheDir, const char *path, const unsigned char *blob, size_t size ) {
+
+  if ( mkdir( cacheDir, 0755 ) != 0 && errno != EEXIST ) {
+    fprintf( stderr, "Could not create the mesh cache %s\n", cacheDir );
+    return;
+  }
+
+  FILE *file = fopen( path, "wb" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write the mesh cache %s\n", path );
+    return;
+  }
+
+  fwrite( blob, 1, size, file );
+
+  if ( fclose( file ) != 0 )
+    fprintf( stderr, "Could not write the mesh cache %s\n", path );
+}
+
+// Straight from the file's layout, NULL if it's stale or damaged
+static game_object_t* upload_mesh( const unsigned char *data, size_t size, uint64_t key ) {
+
+  if ( size < sizeof( mesh_header_t ) )
+    return NULL;
+
+  mesh_header_t header;
+  memcpy( &header, data, sizeof( header ) );
+
+  size_t indexSize = header.indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+  int ok = header.magic == MESH_CACHE_MAGIC && header.version == MESH_CACHE_VERSION && header.key == key &&
+    ( header.indexType == GL_UNSIGNED_SHORT || header.indexType == GL_UNSIGNED_INT ) &&
+    header.attributeCount <= MESH_MAX_ATTRIBUTES && header.lodCount >= 1 && header.lodCount <= OBJECT_MAX_LODS &&
+    header.vertexBytes == (uint64_t) header.vertexCount * header.stride &&
+    header.vertexOffset <= size && header.vertexBytes <= size - header.vertexOffset &&
+    header.indexOffset <= size && header.indexBytes <= size - header.indexOffset;
+
+  for ( unsigned i = 0; ok && i < header.lodCount; ++i )
+    ok = ( (uint64_t) header.lods[ i ].first + header.lods[ i ].count ) * indexSize <= header.indexBytes;
+  for ( unsigned i = 0; ok && i < header.attributeCount; ++i )
+    ok = header.attributes[ i ].offset < header.stride;
+
+  if ( !ok )
+    return NULL;
+
+  unsigned vao, vbo, ibo;
+  glGenVertexArrays( 1, &vao );
+  glBindVertexArray( vao );
+
+  glGenBuffers( 1, &vbo );
+  glBindBuffer( GL_ARRAY_BUFFER, vbo );
+  glBufferData( GL_ARRAY_BUFFER, header.vertexBytes, data + header.vertexOffset, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, vbo, header.vertexBytes, GL_STATIC_DRAW, "meshes" );
+
+  for ( unsigned i = 0; i < header.attributeCount; ++i ) {
+    const mesh_attribute_t *a = &header.attributes[ i ];
+    glVertexAttribPointer( a->location, a->components, a->type, a->normalized ? GL_TRUE : GL_FALSE, header.stride,
+      (void*) (uintptr_t) a->offset );
+    glEnableVertexAttribArray( a->location );
+  }
+
+  glGenBuffers( 1, &ibo );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ibo );
+  glBufferData( GL_ELEMENT_ARRAY_BUFFER, header.indexBytes, data + header.indexOffset, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, ibo, header.indexBytes, GL_STATIC_DRAW, "meshes" );
+
+  glBindVertexArray( 0 );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+  aabb_t bounds = {
+    { header.boundsMin[ 0 ], header.boundsMin[ 1 ], header.boundsMin[ 2 ] },
+    { header.boundsMax[ 0 ], header.boundsMax[ 1 ], header.boundsMax[ 2 ] }
+  };
+
+  return create_indexed_object( vao, vbo, ibo, header.indexType, header.vertexCount, header.lods, header.lodCount, bounds );
+}
+
+game_object_t* load_mesh( const char *path, unsigned nLods, const char *cacheDir ) {
+
+  uint64_t start = timing_now_ns();
+
+  size_t sourceSize;
+  const unsigned char *source = map_file( path, &sourceSize );
+  if ( !source ) {
+    fprintf( stderr, "File not found: %s\n", path );
+    return NULL;
+  }
+
+  // Whatever changes the output is part of the key
+  uint32_t params[] = { MESH_CACHE_VERSION, nLods, MESH_ALIGN, (uint32_t) sizeof( mesh_header_t ) };
+  uint64_t key = hash_bytes( 0xcbf29ce484222325ull, params, sizeof( params ) );
+  key = hash_bytes( key, source, sourceSize );
+
+  char cachePath[ MESH_PATH_MAX ] = "";
+  if ( cacheDir )
+    snprintf( cachePath, sizeof( cachePath ), "%s/%016llx.mesh", cacheDir, (unsigned long long) key );
+
+  game_object_t *obj = NULL;
+  size_t cachedSize;
+  const unsigned char *cached = cacheDir ? map_file( cachePath, &cachedSize ) : NULL;
+  if ( cached ) {
+    obj = upload_mesh( cached, cachedSize, key );
+    munmap( (void*) cached, cachedSize );
+  }
+
+  int fromCache = obj != NULL;
+  if ( !obj ) {
+    mesh_data_t mesh;
+    if ( mesh_import( &mesh, path, source, sourceSize ) ) {
+      size_t size;
+      unsigned char *blob = pack_mesh( &mesh, nLods, key, &size );
+      if ( blob ) {
+        if ( cacheDir )
+          write_cache( cacheDir, cachePath, blob, size );
+        obj = upload_mesh( blob, size, key );
+        mem_free( blob );
+      }
+      mesh_data_free( &mesh );
+    }
+  }
+
+  munmap( (void*) source, sourceSize );
+
+  if ( !obj ) {
+    fprintf( stderr, "Could not load the mesh %s\n", path );
+    return NULL;
+  }
+
+  printf( "Mesh %s: %u vertices, %u triangles in %u levels, %s in %.2f ms\n", path, obj->vertex_count,
+    obj->lods[ 0 ].count / 3, obj->lodCount, fromCache ? "from cache" : "imported",
+    ( timing_now_ns() - start ) / (double) NS_PER_MS );
+
+  return obj;
+}
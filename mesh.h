@@ -0,0 +1,61 @@
+#ifndef MESH_H
+#define MESH_H
+
+#include <stdint.h>
+#include "renderer.h"
+
+/*
+ * Meshes are converted once from OBJ or glTF (see mesh_import.h) into a
+ * binary file laid out the way the GPU takes it: a header with the vertex
+ * format, then the interleaved vertices and the indices of every level of
+ * detail, each blob starting on a MESH_ALIGN boundary. Files are named after
+ * a hash of the source's contents, so an edited source gets imported again
+ * and an unchanged one never does. Loading maps the file and hands the blobs
+ * straight to glBufferData(), without parsing or copying them.
+ *
+ * A glTF file becomes a single object: the primitives of its first mesh are
+ * merged, and any other meshes are left out with a warning.
+ */
+#define MESH_CACHE_MAGIC 0x4853454du // "MESH"
+// Bump when the importers or the layout change
+#define MESH_CACHE_VERSION 2u
+#define MESH_ALIGN 64
+#define MESH_MAX_ATTRIBUTES 4
+
+// Arguments to glVertexAttribPointer()
+typedef struct mesh_attribute {
+  uint32_t location;
+  uint32_t components;
+  uint32_t type;
+  uint32_t normalized;
+  uint32_t offset;
+} mesh_attribute_t;
+
+// Native endianness, the cache never leaves the machine that wrote it
+typedef struct mesh_header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t key;
+  // Byte ranges of the file
+  uint64_t vertexOffset;
+  uint64_t vertexBytes;
+  uint64_t indexOffset;
+  uint64_t indexBytes;
+  uint32_t vertexCount;
+  uint32_t stride;
+  uint32_t attributeCount;
+  // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+  uint32_t indexType;
+  mesh_attribute_t attributes[ MESH_MAX_ATTRIBUTES ];
+  // Index ranges, from full detail down
+  uint32_t lodCount;
+  object_lod_t lods[ OBJECT_MAX_LODS ];
+  float boundsMin[ 3 ];
+  float boundsMax[ 3 ];
+} mesh_header_t;
+
+// Imports path with up to nLods levels of detail into cacheDir, unless it's
+// already there, and uploads it. A NULL cacheDir imports every time.
+game_object_t* load_mesh( const char *path, unsigned nLods, const char *cacheDir );
+
+#endif
@@ -0,0 +1,642 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "mesh_import.h"
+#include "mem.h"
+
+#define GLB_MAGIC 0x46546c67u // "glTF"
+#define GLB_CHUNK_JSON 0x4e4f534au
+#define GLB_CHUNK_BIN 0x004e4942u
+
+#define GLTF_UNSIGNED_BYTE 5121
+#define GLTF_UNSIGNED_SHORT 5123
+#define GLTF_UNSIGNED_INT 5125
+#define GLTF_FLOAT 5126
+#define GLTF_TRIANGLES 4
+
+// Arrays that grow by doubling
+static int reserve( void **data, unsigned *capacity, unsigned count, size_t elementSize ) {
+
+  if ( count <= *capacity )
+    return 1;
+
+  unsigned grown = *capacity ? *capacity * 2 : 256;
+  while ( grown < count )
+    grown *= 2;
+
+  void *p = mem_realloc( MEM_ASSETS, *data, grown * elementSize );
+  if ( !p )
+    return 0;
+
+  *data = p;
+  *capacity = grown;
+
+  return 1;
+}
+
+static int allocate( mesh_data_t *mesh, unsigned nVertices, unsigned nIndices ) {
+
+  mesh->positions = mem_alloc( MEM_ASSETS, nVertices * sizeof( vec3_t ) );
+  mesh->colors = mem_alloc( MEM_ASSETS, nVertices * sizeof( vec3_t ) );
+  mesh->indices = mem_alloc( MEM_ASSETS, nIndices * sizeof( unsigned ) );
+  mesh->nVertices = nVertices;
+  mesh->nIndices = nIndices;
+
+  return mesh->positions && mesh->colors && mesh->indices;
+}
+
+void mesh_data_free( mesh_data_t *mesh ) {
+
+  mem_free( mesh->positions );
+  mem_free( mesh->colors );
+  mem_free( mesh->indices );
+  memset( mesh, 0, sizeof( mesh_data_t ) );
+}
+
+// ----------------------------------------------------------------------------
+// OBJ
+
+static const char* skip_spaces( const char *p, const char *end ) {
+
+  while ( p < end && ( *p == ' ' || *p == '\t' || *p == '\r' ) )
+    ++p;
+
+  return p;
+}
+
+static int import_obj( mesh_data_t *mesh, const char *path, const char *text, size_t size ) {
+
+  unsigned vertexCapacity = 0, colorCapacity = 0, indexCapacity = 0;
+  const char *end = text + size;
+  int ok = 1;
+  unsigned line = 0;
+
+  for ( const char *p = text; ok && p < end; ) {
+    const char *eol = memchr( p, '\n', end - p );
+    if ( !eol )
+      eol = end;
+    ++line;
+
+    // strtof() and strtol() need a terminated string
+    char buffer[ 512 ];
+    size_t length = eol - p < (ptrdiff_t) sizeof( buffer ) - 1 ? (size_t) ( eol - p ) : sizeof( buffer ) - 1;
+    memcpy( buffer, p, length );
+    buffer[ length ] = '\0';
+    p = eol + 1;
+
+    const char *s = skip_spaces( buffer, buffer + length );
+    if ( s[ 0 ] == 'v' && ( s[ 1 ] == ' ' || s[ 1 ] == '\t' ) ) {
+      char *next = (char*) s + 1;
+      float values[ 6 ] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+      unsigned n = 0;
+      for ( ; n < 6; ++n ) {
+        char *after;
+        float value = strtof( next, &after );
+        if ( after == next )
+          break;
+        values[ n ] = value;
+        next = after;
+      }
+      if ( n < 3 ) {
+        fprintf( stderr, "%s:%u: vertex with fewer than 3 coordinates\n", path, line );
+        ok = 0;
+        break;
+      }
+
+      ok = reserve( (void**) &mesh->positions, &vertexCapacity, mesh->nVertices + 1, sizeof( vec3_t ) ) &&
+        reserve( (void**) &mesh->colors, &colorCapacity, mesh->nVertices + 1, sizeof( vec3_t ) );
+      if ( ok ) {
+        mesh->positions[ mesh->nVertices ] = (vec3_t) { values[ 0 ], values[ 1 ], values[ 2 ] };
+        // A fourth value alone is a w coordinate, not a color
+        mesh->colors[ mesh->nVertices ] = n >= 6 ? (vec3_t) { values[ 3 ], values[ 4 ], values[ 5 ] } : (vec3_t) { 1.0f, 1.0f, 1.0f };
+        ++mesh->nVertices;
+      }
+    }
+    else if ( s[ 0 ] == 'f' && ( s[ 1 ] == ' ' || s[ 1 ] == '\t' ) ) {
+      // Fanned from the first corner. Only the position index of v/vt/vn
+      // matters, texture coordinates and normals aren't drawn.
+      char *next = (char*) s + 1;
+      unsigned first = 0, previous = 0, corners = 0;
+      for ( ;; ) {
+        char *after;
+        long index = strtol( next, &after, 10 );
+        if ( after == next )
+          break;
+        while ( *after && *after != ' ' && *after != '\t' && *after != '\r' )
+          ++after;
+        next = after;
+
+        // Negative indices count back from the latest vertex
+        long resolved = index < 0 ? (long) mesh->nVertices + index : index - 1;
+        if ( index == 0 || resolved < 0 || resolved >= (long) mesh->nVertices ) {
+          fprintf( stderr, "%s:%u: face index %ld out of range\n", path, line, index );
+          ok = 0;
+          break;
+        }
+
+        unsigned vertex = (unsigned) resolved;
+        if ( corners >= 2 ) {
+          ok = reserve( (void**) &mesh->indices, &indexCapacity, mesh->nIndices + 3, sizeof( unsigned ) );
+          if ( !ok )
+            break;
+          mesh->indices[ mesh->nIndices++ ] = first;
+          mesh->indices[ mesh->nIndices++ ] = previous;
+          mesh->indices[ mesh->nIndices++ ] = vertex;
+        }
+        if ( corners == 0 )
+          first = vertex;
+        previous = vertex;
+        ++corners;
+      }
+    }
+  }
+
+  if ( ok && ( !mesh->nVertices || !mesh->nIndices ) ) {
+    fprintf( stderr, "%s: no triangles\n", path );
+    ok = 0;
+  }
+
+  return ok;
+}
+
+// ----------------------------------------------------------------------------
+// glTF
+
+typedef enum json_type {
+  JSON_OBJECT,
+  JSON_ARRAY,
+  JSON_STRING,
+  JSON_PRIMITIVE
+} json_type_t;
+
+// A flat token list in document order. Containers are followed by their
+// children, size counts direct children (an object's keys and values).
+typedef struct json_token {
+  json_type_t type;
+  unsigned start;
+  unsigned end;
+  unsigned size;
+} json_token_t;
+
+typedef struct json {
+  const char *text;
+  json_token_t *tokens;
+  unsigned count;
+  unsigned capacity;
+} json_t;
+
+static int json_push( json_t *json, json_type_t type, unsigned start, unsigned end ) {
+
+  if ( !reserve( (void**) &json->tokens, &json->capacity, json->count + 1, sizeof( json_token_t ) ) )
+    return -1;
+
+  json->tokens[ json->count ] = (json_token_t) { type, start, end, 0 };
+
+  return (int) json->count++;
+}
+
+// Tokenizes without validating much, glTF files are machine written
+static int json_parse( json_t *json, const char *text, size_t length ) {
+
+  unsigned stack[ 64 ];
+  int depth = 0;
+  json->text = text;
+
+  for ( size_t i = 0; i < length; ++i ) {
+    char c = text[ i ];
+    int token = -2;
+
+    if ( c == '{' || c == '[' ) {
+      token = json_push( json, c == '{' ? JSON_OBJECT : JSON_ARRAY, (unsigned) i, 0 );
+    }
+    else if ( c == '}' || c == ']' ) {
+      if ( depth == 0 )
+        return 0;
+      json->tokens[ stack[ --depth ] ].end = (unsigned) i + 1;
+      continue;
+    }
+    else if ( c == '"' ) {
+      size_t j = i + 1;
+      while ( j < length && text[ j ] != '"' )
+        j += text[ j ] == '\\' ? 2 : 1;
+      if ( j >= length )
+        return 0;
+      token = json_push( json, JSON_STRING, (unsigned) i + 1, (unsigned) j );
+      i = j;
+    }
+    else if ( c == '-' || ( c >= '0' && c <= '9' ) || c == 't' || c == 'f' || c == 'n' ) {
+      size_t j = i;
+      while ( j < length && !strchr( ",]} \t\r\n", text[ j ] ) )
+        ++j;
+      token = json_push( json, JSON_PRIMITIVE, (unsigned) i, (unsigned) j );
+      i = j - 1;
+    }
+    else {
+      // Whitespace, ':' and ','
+      continue;
+    }
+
+    if ( token < 0 )
+      return 0;
+    if ( depth > 0 )
+      ++json->tokens[ stack[ depth - 1 ] ].size;
+    if ( json->tokens[ token ].type <= JSON_ARRAY ) {
+      if ( depth == (int) ( sizeof( stack ) / sizeof( stack[ 0 ] ) ) )
+        return 0;
+      stack[ depth++ ] = (unsigned) token;
+    }
+  }
+
+  return depth == 0 && json->count > 0;
+}
+
+// The token after t and all of its children
+static unsigned json_skip( const json_t *json, unsigned t ) {
+
+  unsigned pending = 1;
+  while ( pending-- && t < json->count )
+    pending += json->tokens[ t++ ].size;
+
+  return t;
+}
+
+// The value of key in the object at t, or -1
+static int json_get( const json_t *json, int t, const char *key ) {
+
+  if ( t < 0 || json->tokens[ t ].type != JSON_OBJECT )
+    return -1;
+
+  size_t length = strlen( key );
+  unsigned child = (unsigned) t + 1;
+  for ( unsigned i = 0; i < json->tokens[ t ].size; i += 2 ) {
+    const json_token_t *k = &json->tokens[ child ];
+    unsigned value = child + 1;
+    if ( k->end - k->start == length && !memcmp( json->text + k->start, key, length ) )
+      return (int) value;
+    child = json_skip( json, value );
+  }
+
+  return -1;
+}
+
+// The element at index in the array at t, or -1
+static int json_at( const json_t *json, int t, long index ) {
+
+  if ( t < 0 || json->tokens[ t ].type != JSON_ARRAY || index < 0 || index >= (long) json->tokens[ t ].size )
+    return -1;
+
+  unsigned child = (unsigned) t + 1;
+  for ( long i = 0; i < index; ++i )
+    child = json_skip( json, child );
+
+  return (int) child;
+}
+
+static long json_long( const json_t *json, int t, long fallback ) {
+
+  if ( t < 0 || json->tokens[ t ].type != JSON_PRIMITIVE )
+    return fallback;
+
+  return strtol( json->text + json->tokens[ t ].start, NULL, 10 );
+}
+
+static int json_equals( const json_t *json, int t, const char *s ) {
+
+  size_t length = strlen( s );
+
+  return t >= 0 && json->tokens[ t ].end - json->tokens[ t ].start == length &&
+    !memcmp( json->text + json->tokens[ t ].start, s, length );
+}
+
+typedef struct gltf_buffer {
+  const unsigned char *data;
+  size_t size;
+} gltf_buffer_t;
+
+static int base64_value( char c ) {
+
+  if ( c >= 'A' && c <= 'Z' )
+    return c - 'A';
+  if ( c >= 'a' && c <= 'z' )
+    return c - 'a' + 26;
+  if ( c >= '0' && c <= '9' )
+    return c - '0' + 52;
+
+  return c == '+' ? 62 : c == '/' ? 63 : -1;
+}
+
+// Decodes into out, which needs length * 3 / 4 bytes, stopping at padding
+static size_t base64_decode( unsigned char *out, const char *in, size_t length ) {
+
+  size_t n = 0;
+  unsigned bits = 0, count = 0;
+
+  for ( size_t i = 0; i < length; ++i ) {
+    int value = base64_value( in[ i ] );
+    if ( value < 0 )
+      break;
+    bits = bits << 6 | (unsigned) value;
+    count += 6;
+    if ( count >= 8 ) {
+      count -= 8;
+      out[ n++ ] = (unsigned char) ( bits >> count );
+    }
+  }
+
+  return n;
+}
+
+// An accessor's elements as floats, or as indices
+typedef struct gltf_accessor {
+  const unsigned char *data;
+  size_t stride;
+  unsigned count;
+  unsigned components;
+  long componentType;
+  int normalized;
+} gltf_accessor_t;
+
+static int gltf_accessor( const json_t *json, const gltf_buffer_t *buffers, unsigned nBuffers, long index,
+  gltf_accessor_t *out ) {
+
+  int accessor = json_at( json, json_get( json, 0, "accessors" ), index );
+  int view = json_at( json, json_get( json, 0, "bufferViews" ), json_long( json, json_get( json, accessor, "bufferView" ), -1 ) );
+  if ( accessor < 0 || view < 0 )
+    return 0;
+
+  long buffer = json_long( json, json_get( json, view, "buffer" ), -1 );
+  if ( buffer < 0 || buffer >= (long) nBuffers || !buffers[ buffer ].data )
+    return 0;
+
+  int type = json_get( json, accessor, "type" );
+  out->components = json_equals( json, type, "SCALAR" ) ? 1 : json_equals( json, type, "VEC2" ) ? 2 :
+    json_equals( json, type, "VEC3" ) ? 3 : json_equals( json, type, "VEC4" ) ? 4 : 0;
+  out->componentType = json_long( json, json_get( json, accessor, "componentType" ), 0 );
+  out->count = (unsigned) json_long( json, json_get( json, accessor, "count" ), 0 );
+  out->normalized = json_equals( json, json_get( json, accessor, "normalized" ), "true" );
+
+  size_t componentSize = out->componentType == GLTF_FLOAT || out->componentType == GLTF_UNSIGNED_INT ? 4 :
+    out->componentType == GLTF_UNSIGNED_SHORT ? 2 : 1;
+  size_t elementSize = componentSize * out->components;
+  long stride = json_long( json, json_get( json, view, "byteStride" ), 0 );
+  out->stride = stride > 0 ? (size_t) stride : elementSize;
+
+  size_t offset = (size_t) json_long( json, json_get( json, view, "byteOffset" ), 0 ) +
+    (size_t) json_long( json, json_get( json, accessor, "byteOffset" ), 0 );
+  size_t length = (size_t) json_long( json, json_get( json, view, "byteLength" ), 0 );
+  size_t needed = out->count ? out->stride * ( out->count - 1 ) + elementSize : 0;
+  if ( !out->components || !out->count || needed > length || offset + needed > buffers[ buffer ].size )
+    return 0;
+
+  out->data = buffers[ buffer ].data + offset;
+
+  return 1;
+}
+
+static float gltf_component( const gltf_accessor_t *a, unsigned element, unsigned component ) {
+
+  const unsigned char *p = a->data + a->stride * element;
+  switch ( a->componentType ) {
+    case GLTF_FLOAT: {
+      float value;
+      memcpy( &value, p + component * 4, 4 );
+      return value;
+    }
+    case GLTF_UNSIGNED_SHORT: {
+      uint16_t value;
+      memcpy( &value, p + component * 2, 2 );
+      return a->normalized ? value / 65535.0f : value;
+    }
+    case GLTF_UNSIGNED_BYTE:
+      return a->normalized ? p[ component ] / 255.0f : p[ component ];
+  }
+
+  return 0.0f;
+}
+
+static unsigned gltf_index( const gltf_accessor_t *a, unsigned element ) {
+
+  const unsigned char *p = a->data + a->stride * element;
+  if ( a->componentType == GLTF_UNSIGNED_INT ) {
+    uint32_t value;
+    memcpy( &value, p, 4 );
+    return value;
+  }
+  if ( a->componentType == GLTF_UNSIGNED_SHORT ) {
+    uint16_t value;
+    memcpy( &value, p, 2 );
+    return value;
+  }
+
+  return p[ 0 ];
+}
+
+// A triangle primitive's accessors
+typedef struct gltf_primitive {
+  gltf_accessor_t positions;
+  gltf_accessor_t colors;
+  gltf_accessor_t indices;
+  int hasColors;
+  int hasIndices;
+  // Whole triangles only
+  unsigned nIndices;
+} gltf_primitive_t;
+
+static int gltf_primitive( const json_t *json, const gltf_buffer_t *buffers, unsigned nBuffers, int primitive,
+  gltf_primitive_t *out ) {
+
+  int attributes = json_get( json, primitive, "attributes" );
+  if ( primitive < 0 || json_long( json, json_get( json, primitive, "mode" ), GLTF_TRIANGLES ) != GLTF_TRIANGLES ||
+    !gltf_accessor( json, buffers, nBuffers, json_long( json, json_get( json, attributes, "POSITION" ), -1 ), &out->positions ) ||
+    out->positions.componentType != GLTF_FLOAT || out->positions.components != 3 )
+    return 0;
+
+  out->hasColors = gltf_accessor( json, buffers, nBuffers, json_long( json, json_get( json, attributes, "COLOR_0" ), -1 ), &out->colors ) &&
+    out->colors.count == out->positions.count && out->colors.components >= 3;
+  out->hasIndices = gltf_accessor( json, buffers, nBuffers, json_long( json, json_get( json, primitive, "indices" ), -1 ), &out->indices ) &&
+    out->indices.components == 1;
+  out->nIndices = ( out->hasIndices ? out->indices.count : out->positions.count ) / 3 * 3;
+
+  return 1;
+}
+
+static int import_gltf_json( mesh_data_t *mesh, const char *path, const char *text, size_t length,
+  const unsigned char *bin, size_t binSize ) {
+
+  json_t json = { 0 };
+  gltf_buffer_t buffers[ 16 ] = { { 0 } };
+  unsigned char *decoded[ 16 ] = { 0 };
+  unsigned nBuffers = 0;
+  int ok = json_parse( &json, text, length );
+  if ( !ok )
+    fprintf( stderr, "%s: malformed JSON\n", path );
+
+  // The GLB chunk, or base64 data URIs. Files next to the .gltf would have
+  // to be part of the cache key, so they aren't supported.
+  int buffersArray = ok ? json_get( &json, 0, "buffers" ) : -1;
+  for ( ; ok && buffersArray >= 0 && nBuffers < json.tokens[ buffersArray ].size && nBuffers < 16; ++nBuffers ) {
+    int buffer = json_at( &json, buffersArray, nBuffers );
+    int uri = json_get( &json, buffer, "uri" );
+    if ( uri < 0 ) {
+      buffers[ nBuffers ] = (gltf_buffer_t) { bin, binSize };
+      continue;
+    }
+
+    const char *s = text + json.tokens[ uri ].start;
+    size_t uriLength = json.tokens[ uri ].end - json.tokens[ uri ].start;
+    const char *comma = memchr( s, ',', uriLength );
+    if ( strncmp( s, "data:", 5 ) || !comma || comma - s < 7 || strncmp( comma - 7, ";base64", 7 ) ) {
+      fprintf( stderr, "%s: only embedded or GLB buffers are supported\n", path );
+      ok = 0;
+      break;
+    }
+
+    size_t dataLength = uriLength - ( comma + 1 - s );
+    decoded[ nBuffers ] = mem_alloc( MEM_SCRATCH, dataLength / 4 * 3 + 3 );
+    ok = decoded[ nBuffers ] != NULL;
+    if ( ok )
+      buffers[ nBuffers ] = (gltf_buffer_t) { decoded[ nBuffers ], base64_decode( decoded[ nBuffers ], comma + 1, dataLength ) };
+  }
+
+  // Every primitive of the first mesh, merged. Meshes are usually split into
+  // primitives by material, which the renderer has no use for. Other meshes
+  // would need their nodes' transforms to be placed.
+  int meshes = ok ? json_get( &json, 0, "meshes" ) : -1;
+  int primitives = json_get( &json, json_at( &json, meshes, 0 ), "primitives" );
+  unsigned nPrimitives = primitives >= 0 && json.tokens[ primitives ].type == JSON_ARRAY ? json.tokens[ primitives ].size : 0;
+  if ( meshes >= 0 && json.tokens[ meshes ].type == JSON_ARRAY && json.tokens[ meshes ].size > 1 )
+    fprintf( stderr, "%s: only the first of %u meshes is imported\n", path, json.tokens[ meshes ].size );
+
+  unsigned nVertices = 0, nIndices = 0;
+  for ( unsigned p = 0; ok && p < nPrimitives; ++p ) {
+    gltf_primitive_t primitive;
+    ok = gltf_primitive( &json, buffers, nBuffers, json_at( &json, primitives, p ), &primitive ) &&
+      primitive.positions.count <= UINT32_MAX - nVertices && primitive.nIndices <= UINT32_MAX - nIndices;
+    if ( !ok ) {
+      fprintf( stderr, "%s: primitive %u isn't triangles with float positions\n", path, p );
+      break;
+    }
+    nVertices += primitive.positions.count;
+    nIndices += primitive.nIndices;
+  }
+
+  if ( ok && ( nIndices < 3 || !allocate( mesh, nVertices, nIndices ) ) ) {
+    fprintf( stderr, "%s: no triangles\n", path );
+    ok = 0;
+  }
+
+  // Indices are offset past the vertices of the primitives before
+  unsigned baseVertex = 0, baseIndex = 0;
+  for ( unsigned p = 0; ok && p < nPrimitives; ++p ) {
+    gltf_primitive_t primitive;
+    gltf_primitive( &json, buffers, nBuffers, json_at( &json, primitives, p ), &primitive );
+
+    const gltf_accessor_t *positions = &primitive.positions, *colors = &primitive.colors;
+    for ( unsigned i = 0; i < positions->count; ++i ) {
+      mesh->positions[ baseVertex + i ] =
+        (vec3_t) { gltf_component( positions, i, 0 ), gltf_component( positions, i, 1 ), gltf_component( positions, i, 2 ) };
+      mesh->colors[ baseVertex + i ] = primitive.hasColors ?
+        (vec3_t) { gltf_component( colors, i, 0 ), gltf_component( colors, i, 1 ), gltf_component( colors, i, 2 ) } :
+        (vec3_t) { 1.0f, 1.0f, 1.0f };
+    }
+    for ( unsigned i = 0; ok && i < primitive.nIndices; ++i ) {
+      unsigned index = primitive.hasIndices ? gltf_index( &primitive.indices, i ) : i;
+      if ( index >= positions->count ) {
+        fprintf( stderr, "%s: index %u out of range in primitive %u\n", path, index, p );
+        ok = 0;
+      }
+      mesh->indices[ baseIndex + i ] = baseVertex + index;
+    }
+
+    baseVertex += positions->count;
+    baseIndex += primitive.nIndices;
+  }
+
+  for ( unsigned i = 0; i < 16; ++i )
+    mem_free( decoded[ i ] );
+  mem_free( json.tokens );
+
+  return ok;
+}
+
+static int import_glb( mesh_data_t *mesh, const char *path, const unsigned char *data, size_t size ) {
+
+  // Magic, version and total length
+  uint32_t header[ 3 ] = { 0 };
+  if ( size >= 20 )
+    memcpy( header, data, 12 );
+  if ( header[ 0 ] != GLB_MAGIC || header[ 1 ] != 2 || header[ 2 ] > size ) {
+    fprintf( stderr, "%s: not a glTF 2.0 binary\n", path );
+    return 0;
+  }
+
+  const char *text = NULL;
+  size_t textSize = 0;
+  const unsigned char *bin = NULL;
+  size_t binSize = 0;
+
+  for ( size_t offset = 12; offset + 8 <= header[ 2 ]; ) {
+    uint32_t chunk[ 2 ];
+    memcpy( chunk, data + offset, 8 );
+    if ( chunk[ 0 ] > header[ 2 ] - offset - 8 )
+      break;
+    if ( chunk[ 1 ] == GLB_CHUNK_JSON && !text ) {
+      text = (const char*) data + offset + 8;
+      textSize = chunk[ 0 ];
+    }
+    else if ( chunk[ 1 ] == GLB_CHUNK_BIN && !bin ) {
+      bin = data + offset + 8;
+      binSize = chunk[ 0 ];
+    }
+    offset += 8 + chunk[ 0 ];
+  }
+
+  if ( !text ) {
+    fprintf( stderr, "%s: no JSON chunk\n", path );
+    return 0;
+  }
+
+  return import_gltf_json( mesh, path, text, textSize, bin, binSize );
+}
+
+// ----------------------------------------------------------------------------
+
+static int has_extension( const char *path, const char *extension ) {
+
+  const char *dot = strrchr( path, '.' );
+  if ( !dot )
+    return 0;
+
+  for ( ++dot; *dot && *extension; ++dot, ++extension ) {
+    if ( ( *dot | 0x20 ) != *extension )
+      return 0;
+  }
+
+  return !*dot && !*extension;
+}
+
+int mesh_import( mesh_data_t *mesh, const char *path, const unsigned char *contents, size_t size ) {
+
+  memset( mesh, 0, sizeof( mesh_data_t ) );
+  int ok;
+
+  if ( has_extension( path, "obj" ) ) {
+    ok = import_obj( mesh, path, (const char*) contents, size );
+  }
+  else if ( has_extension( path, "gltf" ) ) {
+    ok = import_gltf_json( mesh, path, (const char*) contents, size, NULL, 0 );
+  }
+  else if ( has_extension( path, "glb" ) ) {
+    ok = import_glb( mesh, path, contents, size );
+  }
+  else {
+    fprintf( stderr, "%s: unknown mesh format\n", path );
+    ok = 0;
+  }
+
+  if ( !ok )
+    mesh_data_free( mesh );
+
+  return ok;
+}
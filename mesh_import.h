@@ -0,0 +1,35 @@
+#ifndef MESH_IMPORT_H
+#define MESH_IMPORT_H
+
+#include <stddef.h>
+#include "linmath.h"
+
+/*
+ * Parsers for the mesh formats the game can import, into plain arrays for
+ * the mesh cache (see mesh.h) to convert. Only what the renderer draws is
+ * kept: positions, vertex colors and triangles.
+ *
+ * OBJ: v lines, optionally with an r g b color after the position, and f
+ * lines, which are fanned into triangles.
+ * glTF 2.0 (.gltf with embedded buffers, or .glb): all primitives of the
+ * first mesh, merged into one, in the mesh's own space. Other meshes are
+ * skipped with a warning, and any primitive that isn't triangles fails the
+ * import. POSITION, COLOR_0 and the indices are read, everything else
+ * (materials, normals, nodes) is ignored.
+ */
+
+typedef struct mesh_data {
+  vec3_t *positions;
+  // White when the file has no colors
+  vec3_t *colors;
+  unsigned nVertices;
+  unsigned *indices;
+  unsigned nIndices;
+} mesh_data_t;
+
+// Picks the parser by the path's extension. contents doesn't have to be
+// NUL-terminated.
+int mesh_import( mesh_data_t *mesh, const char *path, const unsigned char *contents, size_t size );
+void mesh_data_free( mesh_data_t *mesh );
+
+#endif
@@ -0,0 +1,381 @@
+/*
+ * Micro-benchmarks for CPU-side hot paths. Each case is warmed up, then timed
+ * over a number of repetitions of a fixed batch of iterations. Results are
+ * per-operation times, printed and optionally written as JSON so that runs on
+ * different commits can be diffed.
+ *
+ * ./microbench -r 30 -o microbench.json
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "renderer.h"
+#include "timing.h"
+#include "mem.h"
+#include "camera.h"
+#include "particles.h"
+
+#define MICROBENCH_WARMUP_NS ( 100 * NS_PER_MS )
+// Each repetition should take about this long, to drown out timer overhead
+#define MICROBENCH_REP_NS ( 10 * NS_PER_MS )
+#define MICROBENCH_MAX_REPS 1000
+
+typedef struct microbench {
+  const char *name;
+  void (*run)( void *ctx );
+  void *ctx;
+} microbench_t;
+
+typedef struct microbench_result {
+  const char *name;
+  unsigned long long iterations;
+  double min;
+  double median;
+  double mean;
+  double stddev;
+  double max;
+} microbench_result_t;
+
+// Keeps the compiler from optimizing the work away
+static volatile uintptr_t sink;
+
+// ----------------------------------------------------
+
+typedef struct file_case {
+  const char *path;
+  size_t size;
+} file_case_t;
+
+static void run_get_file_contents( void *ctx ) {
+
+  const file_case_t *c = ctx;
+  const char *contents = get_file_contents( c->path );
+  sink = (uintptr_t) contents[ c->size / 2 ];
+  mem_free( (void*) contents );
+}
+
+static int write_test_file( const file_case_t *c ) {
+
+  FILE *file = fopen( c->path, "w" );
+  if ( !file )
+    return 0;
+
+  // Something that looks vaguely like source code
+  for ( size_t i = 0; i < c->size; ++i )
+    fputc( i % 64 == 63 ? '\n' : 'a' + i % 26, file );
+
+  return fclose( file ) == 0;
+}
+
+typedef struct pack_case {
+  vec3_t *locations;
+  vec3_t *colors;
+  vec3_t *out;
+  unsigned nVertices;
+} pack_case_t;
+
+static void run_pack_vertices( void *ctx ) {
+
+  pack_case_t *c = ctx;
+  pack_vertices( c->locations, c->colors, c->nVertices, c->out );
+  sink = (uintptr_t) c->out[ c->nVertices ].x;
+}
+
+static int init_pack_case( pack_case_t *c, unsigned nVertices ) {
+
+  c->nVertices = nVertices;
+  c->locations = malloc( nVertices * sizeof( vec3_t ) );
+  c->colors = malloc( nVertices * sizeof( vec3_t ) );
+  c->out = malloc( nVertices * 2 * sizeof( vec3_t ) );
+
+  if ( !c->locations || !c->colors || !c->out )
+    return 0;
+
+  for ( unsigned i = 0; i < nVertices; ++i ) {
+    c->locations[ i ] = (vec3_t) { (float) i, (float) -i, 0.0f };
+    c->colors[ i ] = (vec3_t) { 1.0f, 0.5f, 0.25f };
+  }
+
+  return 1;
+}
+
+typedef struct mat4_case {
+  mat4_t matrices[ 64 ];
+  camera_t camera;
+} mat4_case_t;
+
+// A chain of products, like composing a transform hierarchy
+static void run_mat4_mul( void *ctx ) {
+
+  mat4_case_t *c = ctx;
+  mat4_t m = c->matrices[ 0 ];
+
+  for ( unsigned i = 1; i < 64; ++i )
+    m = mat4_mul( &m, &c->matrices[ i ] );
+  sink = (uintptr_t) m.m[ 0 ];
+}
+
+static void run_camera_update( void *ctx ) {
+
+  mat4_case_t *c = ctx;
+  c->camera.position.x += 0.001f;
+  camera_update( &c->camera, 16.0f / 9.0f );
+  sink = (uintptr_t) c->camera.viewProjection.m[ 0 ];
+}
+
+static void init_mat4_case( mat4_case_t *c ) {
+
+  for ( unsigned i = 0; i < 64; ++i )
+    c->matrices[ i ] = mat4_translate( (vec3_t) { 0.001f * i, 0.0f, -0.001f * i } );
+
+  camera_init_perspective( &c->camera, (vec3_t) { 0.0f, 2.0f, 5.0f }, (vec3_t) { 0.0f, 0.0f, 0.0f }, 1.0f, 0.1f, 100.0f );
+}
+
+typedef struct cull_case {
+  frustum_t frustum;
+  aabb_t *boxes;
+  unsigned nBoxes;
+  bvh_t bvh;
+} cull_case_t;
+
+static void run_frustum_test_aabb( void *ctx ) {
+
+  const cull_case_t *c = ctx;
+  unsigned inside = 0;
+
+  for ( unsigned i = 0; i < c->nBoxes; ++i )
+    inside += frustum_test_aabb( &c->frustum, &c->boxes[ i ] ) != FRUSTUM_OUTSIDE;
+  sink = inside;
+}
+
+static void count_visible( void *ctx, void *userData ) {
+  ++*(unsigned*) ctx;
+}
+
+static void run_bvh_cull( void *ctx ) {
+
+  cull_case_t *c = ctx;
+  unsigned visible = 0;
+  bvh_cull( &c->bvh, &c->frustum, count_visible, &visible );
+  sink = visible;
+}
+
+// Small boxes over a world four times the size of the clip cube, so that
+// about one in 16 is visible
+static int init_cull_case( cull_case_t *c, unsigned nBoxes ) {
+
+  static const float identity[ 16 ] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+  unsigned seed = 1;
+
+  frustum_from_matrix( &c->frustum, identity );
+  c->nBoxes = nBoxes;
+  c->boxes = malloc( nBoxes * sizeof( aabb_t ) );
+  if ( !c->boxes )
+    return 0;
+
+  bvh_init( &c->bvh );
+
+  for ( unsigned i = 0; i < nBoxes; ++i ) {
+    seed = seed * 1664525u + 1013904223u;
+    float x = ( ( seed >> 8 ) / (float) ( 1 << 24 ) * 2.0f - 1.0f ) * 4.0f;
+    seed = seed * 1664525u + 1013904223u;
+    float y = ( ( seed >> 8 ) / (float) ( 1 << 24 ) * 2.0f - 1.0f ) * 4.0f;
+    c->boxes[ i ] = (aabb_t) { { x, y, 0.0f }, { x + 0.1f, y + 0.1f, 0.0f } };
+    if ( bvh_insert( &c->bvh, c->boxes[ i ], &c->boxes[ i ] ) == BVH_NULL )
+      return 0;
+  }
+
+  return 1;
+}
+
+typedef struct particles_case {
+  particles_t particles;
+  particle_circle_t circles[ 16 ];
+  unsigned refills;
+} particles_case_t;
+
+// One 125 Hz tick, with what died respawned to keep the pool full
+static void run_particles_tick( void *ctx ) {
+
+  particles_case_t *c = ctx;
+  particle_circle_t *circle = &c->circles[ c->refills++ % 16 ];
+  particles_emit( &c->particles, (vec3_t) { circle->x, circle->y, 0.0f }, (vec3_t) { 0.0f, 0.0f, 0.0f }, 0.5f,
+    c->particles.capacity - c->particles.count, 1.5f );
+  particles_tick( &c->particles, 0.008f, c->circles, 16 );
+  sink = c->particles.count;
+}
+
+// Sixteen tanks in a ring, like in the game, with particles all around them
+static int init_particles_case( particles_case_t *c, unsigned count ) {
+
+  if ( !particles_init( &c->particles, count, 0 ) )
+    return 0;
+
+  for ( unsigned i = 0; i < 16; ++i ) {
+    float angle = i * 2.0f * (float) M_PI / 16;
+    c->circles[ i ] = (particle_circle_t) { cosf( angle ) * 0.6f, sinf( angle ) * 0.6f, 0.08f };
+    particles_emit( &c->particles, (vec3_t) { c->circles[ i ].x, c->circles[ i ].y, 0.0f }, (vec3_t) { 0.0f, 0.0f, 0.0f }, 0.5f,
+      c->particles.capacity / 16, 1.5f );
+  }
+
+  return 1;
+}
+
+// ----------------------------------------------------
+
+static int compare_doubles( const void *a, const void *b ) {
+
+  double x = *(const double*) a;
+  double y = *(const double*) b;
+
+  return ( x > y ) - ( x < y );
+}
+
+static microbench_result_t run_bench( const microbench_t *bench, unsigned reps ) {
+
+  // Warm up caches, the allocator and the CPU clock, and find out how many
+  // iterations fit in one repetition
+  unsigned long long iterations = 0;
+  uint64_t start = timing_now_ns();
+  uint64_t elapsed;
+
+  do {
+    bench->run( bench->ctx );
+    ++iterations;
+    elapsed = timing_now_ns() - start;
+  } while ( elapsed < MICROBENCH_WARMUP_NS );
+
+  unsigned long long batch = iterations * MICROBENCH_REP_NS / elapsed;
+  if ( batch < 1 )
+    batch = 1;
+
+  static double samples[ MICROBENCH_MAX_REPS ];
+
+  for ( unsigned r = 0; r < reps; ++r ) {
+    start = timing_now_ns();
+    for ( unsigned long long i = 0; i < batch; ++i )
+      bench->run( bench->ctx );
+    samples[ r ] = ( timing_now_ns() - start ) / (double) batch;
+  }
+
+  qsort( samples, reps, sizeof( double ), compare_doubles );
+
+  microbench_result_t result = { bench->name, batch * reps, samples[ 0 ], samples[ reps / 2 ], 0, 0, samples[ reps - 1 ] };
+
+  for ( unsigned r = 0; r < reps; ++r )
+    result.mean += samples[ r ];
+  result.mean /= reps;
+
+  for ( unsigned r = 0; r < reps; ++r )
+    result.stddev += ( samples[ r ] - result.mean ) * ( samples[ r ] - result.mean );
+  result.stddev = reps > 1 ? sqrt( result.stddev / ( reps - 1 ) ) : 0;
+
+  return result;
+}
+
+static int write_json( const char *path, const microbench_result_t *results, unsigned count ) {
+
+  FILE *file = fopen( path, "w" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write results to %s\n", path );
+    return 0;
+  }
+
+  fprintf( file, "{\n  \"unit\": \"ns/op\",\n  \"benchmarks\": [\n" );
+
+  for ( unsigned i = 0; i < count; ++i ) {
+    const microbench_result_t *r = &results[ i ];
+    fprintf( file, "    { \"name\": \"%s\", \"iterations\": %llu, \"min\": %.3f, \"median\": %.3f, \"mean\": %.3f, \"stddev\": %.3f, \"max\": %.3f }%s\n",
+      r->name, r->iterations, r->min, r->median, r->mean, r->stddev, r->max, i + 1 < count ? "," : "" );
+  }
+
+  fprintf( file, "  ]\n}\n" );
+
+  return fclose( file ) == 0;
+}
+
+int main( int argc, char **argv ) {
+
+  unsigned reps = 30;
+  const char *jsonPath = NULL;
+  const char *filter = NULL;
+
+  for ( int i = 1; i + 1 < argc; i += 2 ) {
+    if ( !strcmp( argv[ i ], "-r" ) )
+      reps = atoi( argv[ i + 1 ] );
+    else if ( !strcmp( argv[ i ], "-o" ) )
+      jsonPath = argv[ i + 1 ];
+    else if ( !strcmp( argv[ i ], "-b" ) )
+      filter = argv[ i + 1 ];
+  }
+
+  if ( reps < 1 || reps > MICROBENCH_MAX_REPS || argc % 2 == 0 ) {
+    fprintf( stderr, "Usage: microbench [-r repetitions] [-b name filter] [-o results.json]\n" );
+    return 1;
+  }
+
+  static file_case_t fileCases[] = {
+    { "microbench_1k.tmp", 1 << 10 },
+    { "microbench_64k.tmp", 64 << 10 },
+    { "microbench_1m.tmp", 1 << 20 },
+  };
+  static file_case_t shaderCase = { "shader.vert", 0 };
+  static pack_case_t packCases[ 3 ];
+  static cull_case_t cullCase;
+  static particles_case_t particlesCase;
+  static mat4_case_t mat4Case;
+  init_mat4_case( &mat4Case );
+
+  for ( unsigned i = 0; i < 3; ++i ) {
+    if ( !write_test_file( &fileCases[ i ] ) ) {
+      fprintf( stderr, "Could not write %s\n", fileCases[ i ].path );
+      return 1;
+    }
+  }
+
+  if ( !init_pack_case( &packCases[ 0 ], 3 ) ||
+    !init_pack_case( &packCases[ 1 ], 300 ) ||
+    !init_pack_case( &packCases[ 2 ], 30000 ) ||
+    !init_cull_case( &cullCase, 10000 ) ||
+    !init_particles_case( &particlesCase, 1 << 20 ) ) {
+    fprintf( stderr, "Out of memory\n" );
+    return 1;
+  }
+
+  microbench_t benches[] = {
+    { "get_file_contents/1k", run_get_file_contents, &fileCases[ 0 ] },
+    { "get_file_contents/64k", run_get_file_contents, &fileCases[ 1 ] },
+    { "get_file_contents/1m", run_get_file_contents, &fileCases[ 2 ] },
+    { "get_file_contents/shader.vert", run_get_file_contents, &shaderCase },
+    { "pack_vertices/3", run_pack_vertices, &packCases[ 0 ] },
+    { "pack_vertices/300", run_pack_vertices, &packCases[ 1 ] },
+    { "pack_vertices/30000", run_pack_vertices, &packCases[ 2 ] },
+    { "mat4_mul/64", run_mat4_mul, &mat4Case },
+    { "camera_update", run_camera_update, &mat4Case },
+    { "frustum_test_aabb/10000", run_frustum_test_aabb, &cullCase },
+    { "bvh_cull/10000", run_bvh_cull, &cullCase },
+    { "particles_tick/1m", run_particles_tick, &particlesCase },
+  };
+  const unsigned nBenches = sizeof( benches ) / sizeof( benches[ 0 ] );
+  microbench_result_t results[ sizeof( benches ) / sizeof( benches[ 0 ] ) ];
+  unsigned nResults = 0;
+
+  printf( "%-32s %12s %12s %12s %12s\n", "benchmark", "min", "median", "mean", "stddev" );
+
+  for ( unsigned i = 0; i < nBenches; ++i ) {
+    if ( filter && !strstr( benches[ i ].name, filter ) )
+      continue;
+    microbench_result_t *r = &results[ nResults++ ];
+    *r = run_bench( &benches[ i ], reps );
+    printf( "%-32s %9.1f ns %9.1f ns %9.1f ns %9.1f ns\n", r->name, r->min, r->median, r->mean, r->stddev );
+  }
+
+  for ( unsigned i = 0; i < 3; ++i )
+    remove( fileCases[ i ].path );
+
+  if ( jsonPath && !write_json( jsonPath, results, nResults ) )
+    return 1;
+
+  return 0;
+}
@@ -0,0 +1,204 @@
+#include <stdio.h>
+#include <string.h>
+#include <glad/glad.h>
+#include "occlusion.h"
+#include "gpu_mem.h"
+#include "mem.h"
+
+static const float cubeVertices[ 8 * 3 ] = {
+  0, 0, 0,  1, 0, 0,  1, 1, 0,  0, 1, 0,
+  0, 0, 1,  1, 0, 1,  1, 1, 1,  0, 1, 1
+};
+
+static const unsigned char cubeIndices[ 36 ] = {
+  0, 2, 1,  0, 3, 2,
+  4, 5, 6,  4, 6, 7,
+  0, 1, 5,  0, 5, 4,
+  1, 2, 6,  1, 6, 5,
+  2, 3, 7,  2, 7, 6,
+  3, 0, 4,  3, 4, 7
+};
+
+int occlusion_init( occlusion_t *occlusion, unsigned capacity ) {
+
+  memset( occlusion, 0, sizeof( occlusion_t ) );
+
+  occlusion->shader = create_shader( "occlusion.vert", "occlusion.frag" );
+  occlusion->queries = mem_alloc( MEM_RENDERER, capacity * OCCLUSION_FRAMES * sizeof( unsigned ) );
+  occlusion->tested = mem_calloc( MEM_RENDERER, capacity, sizeof( unsigned ) );
+  occlusion->blocks = mem_alloc( MEM_RENDERER, capacity * sizeof( long ) );
+  occlusion->hidden = mem_calloc( MEM_RENDERER, capacity, 1 );
+  if ( !occlusion->shader || !occlusion->queries || !occlusion->tested || !occlusion->blocks || !occlusion->hidden ) {
+    fprintf( stderr, "Failed to set up occlusion culling for %u objects\n", capacity );
+    occlusion_destroy( occlusion );
+    return 0;
+  }
+
+  occlusion->capacity = capacity;
+  glGenQueries( capacity * OCCLUSION_FRAMES, occlusion->queries );
+  for ( unsigned i = 0; i < capacity; ++i )
+    occlusion->blocks[ i ] = -1;
+
+  glGenVertexArrays( 1, &occlusion->vao );
+  glBindVertexArray( occlusion->vao );
+
+  glGenBuffers( 1, &occlusion->vbo );
+  glBindBuffer( GL_ARRAY_BUFFER, occlusion->vbo );
+  glBufferData( GL_ARRAY_BUFFER, sizeof( cubeVertices ), cubeVertices, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, occlusion->vbo, sizeof( cubeVertices ), GL_STATIC_DRAW, "occlusion" );
+
+  glGenBuffers( 1, &occlusion->ibo );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, occlusion->ibo );
+  glBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof( cubeIndices ), cubeIndices, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, occlusion->ibo, sizeof( cubeIndices ), GL_STATIC_DRAW, "occlusion" );
+
+  glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof( float ), (void*) 0 );
+  glEnableVertexAttribArray( 0 );
+
+  glBindVertexArray( 0 );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+  return 1;
+}
+
+void occlusion_destroy( occlusion_t *occlusion ) {
+
+  if ( occlusion->capacity )
+    glDeleteQueries( occlusion->capacity * OCCLUSION_FRAMES, occlusion->queries );
+
+  if ( occlusion->vao ) {
+    glDeleteVertexArrays( 1, &occlusion->vao );
+    glDeleteBuffers( 1, &occlusion->vbo );
+    gpu_mem_release( GPU_MEM_BUFFER, occlusion->vbo );
+    glDeleteBuffers( 1, &occlusion->ibo );
+    gpu_mem_release( GPU_MEM_BUFFER, occlusion->ibo );
+  }
+
+  destroy_shader( occlusion->shader );
+  mem_free( occlusion->queries );
+  mem_free( occlusion->tested );
+  mem_free( occlusion->blocks );
+  mem_free( occlusion->hidden );
+  memset( occlusion, 0, sizeof( occlusion_t ) );
+}
+
+static unsigned query_of( const occlusion_t *occlusion, unsigned frame, unsigned slot ) {
+  return occlusion->queries[ ( frame % OCCLUSION_FRAMES ) * occlusion->capacity + slot ];
+}
+
+void occlusion_prepare( occlusion_t *occlusion, ubo_ring_t *ring, const camera_t *camera,
+  game_object_t * const *objects, unsigned nObjects ) {
+
+  unsigned previous = occlusion->frame++;
+  unsigned frame = occlusion->frame;
+  if ( nObjects > occlusion->capacity )
+    nObjects = occlusion->capacity;
+
+  occlusion->lastTested = 0;
+  occlusion->lastHidden = 0;
+  occlusion->lastPending = 0;
+  occlusion->lastSkipped = 0;
+
+  for ( unsigned i = 0; i < nObjects; ++i ) {
+    // Never wait for a result, an object is only known hidden once its
+    // query has landed
+    occlusion->hidden[ i ] = 0;
+    if ( previous && occlusion->tested[ i ] == previous ) {
+      unsigned query = query_of( occlusion, previous, i );
+      GLuint available = 0;
+      glGetQueryObjectuiv( query, GL_QUERY_RESULT_AVAILABLE, &available );
+      if ( available ) {
+        GLuint passed = 0;
+        glGetQueryObjectuiv( query, GL_QUERY_RESULT, &passed );
+        occlusion->hidden[ i ] = !passed;
+        occlusion->lastHidden += !passed;
+      }
+      else {
+        ++occlusion->lastPending;
+      }
+    }
+
+    occlusion->blocks[ i ] = -1;
+    if ( !objects[ i ]->visible )
+      continue;
+
+    // A box around the camera would be clipped by the near plane and could
+    // pass no samples even though the object fills the view
+    aabb_t box = object_world_bounds( objects[ i ] );
+    vec3_t eye = camera->position;
+    float margin = camera->near * 2.0f;
+    if ( eye.x > box.min.x - margin && eye.x < box.max.x + margin &&
+      eye.y > box.min.y - margin && eye.y < box.max.y + margin &&
+      eye.z > box.min.z - margin && eye.z < box.max.z + margin ) {
+      occlusion->hidden[ i ] = 0;
+      continue;
+    }
+
+    object_block_t block = { mat4_translate( box.min ), { 0.0f, 0.0f, 0.0f, 0.0f } };
+    vec3_t size = vec3_sub( box.max, box.min );
+    block.model.m[ 0 ] = size.x;
+    block.model.m[ 5 ] = size.y;
+    block.model.m[ 10 ] = size.z;
+
+    occlusion->blocks[ i ] = ubo_ring_push( ring, &block, sizeof( block ) );
+    occlusion->tested[ i ] = frame;
+    ++occlusion->lastTested;
+  }
+
+  for ( unsigned i = nObjects; i < occlusion->capacity; ++i ) {
+    occlusion->blocks[ i ] = -1;
+    occlusion->hidden[ i ] = 0;
+  }
+}
+
+void occlusion_test( occlusion_t *occlusion, const ubo_ring_t *ring ) {
+
+  if ( !occlusion->lastTested )
+    return;
+
+  glColorMask( GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE );
+  glDepthMask( GL_FALSE );
+
+  activate_shader( occlusion->shader );
+  glBindVertexArray( occlusion->vao );
+
+  for ( unsigned i = 0; i < occlusion->capacity; ++i ) {
+    if ( occlusion->blocks[ i ] < 0 )
+      continue;
+    bind_object_block( ring, occlusion->blocks[ i ] );
+    glBeginQuery( GL_ANY_SAMPLES_PASSED, query_of( occlusion, occlusion->frame, i ) );
+    glDrawElements( GL_TRIANGLES, 36, GL_UNSIGNED_BYTE, (void*) 0 );
+    glEndQuery( GL_ANY_SAMPLES_PASSED );
+  }
+
+  glBindVertexArray( 0 );
+  glDepthMask( GL_TRUE );
+  glColorMask( GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE );
+}
+
+int occlusion_begin_draw( occlusion_t *occlusion, unsigned slot ) {
+
+  if ( slot >= occlusion->capacity )
+    return 1;
+
+  if ( occlusion->hidden[ slot ] ) {
+    ++occlusion->lastSkipped;
+    return 0;
+  }
+
+  if ( occlusion->blocks[ slot ] >= 0 ) {
+    glBeginConditionalRender( query_of( occlusion, occlusion->frame, slot ), GL_QUERY_NO_WAIT );
+    occlusion->conditional = 1;
+  }
+
+  return 1;
+}
+
+void occlusion_end_draw( occlusion_t *occlusion ) {
+
+  if ( occlusion->conditional ) {
+    glEndConditionalRender();
+    occlusion->conditional = 0;
+  }
+}
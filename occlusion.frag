@@ -0,0 +1,7 @@
+#version 330 core
+out vec4 FragColor;
+
+// Color writes are off, only the samples that pass the depth test count
+void main() {
+  FragColor = vec4( 1.0 );
+}
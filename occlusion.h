@@ -0,0 +1,64 @@
+#ifndef OCCLUSION_H
+#define OCCLUSION_H
+
+#include "renderer.h"
+#include "camera.h"
+#include "ubo.h"
+
+/*
+ * Occlusion culling for large or expensive objects. Each frame the bounding
+ * boxes of the objects that survived frustum culling are drawn as proxies,
+ * with color and depth writes off, into GL_ANY_SAMPLES_PASSED queries after
+ * the occluders. The real draws are then conditional on this frame's query,
+ * so the GPU can drop them without the CPU waiting. The CPU reads the
+ * results one frame late and skips the draw calls of objects that were
+ * hidden last frame, which costs a frame of latency when one reappears.
+ *
+ * Needs a depth buffer with the occluders in it when occlusion_test() runs.
+ */
+#define OCCLUSION_FRAMES 2
+
+typedef struct occlusion {
+  shader_t *shader;
+  // A unit cube, scaled onto each box by its object block
+  unsigned vao;
+  unsigned vbo;
+  unsigned ibo;
+  unsigned capacity;
+  // OCCLUSION_FRAMES queries per slot, frame major
+  unsigned *queries;
+  // The frame each slot was last tested in, 0 for never
+  unsigned *tested;
+  // This frame's proxy blocks, -1 for slots that aren't tested
+  long *blocks;
+  // Whether the slot's query from the last frame saw no samples
+  unsigned char *hidden;
+  unsigned frame;
+  int conditional;
+
+  // Stats of the last frame
+  unsigned lastTested;
+  unsigned lastHidden;
+  // Last frame's results that weren't ready yet, treated as visible
+  unsigned lastPending;
+  unsigned lastSkipped;
+} occlusion_t;
+
+int occlusion_init( occlusion_t *occlusion, unsigned capacity );
+void occlusion_destroy( occlusion_t *occlusion );
+// Between ubo_ring_begin() and ubo_ring_flush(). Picks up the results of
+// the last frame and pushes proxy boxes for the visible objects, where slot
+// i belongs to objects[ i ]. Objects whose box contains the camera are
+// always drawn.
+void occlusion_prepare( occlusion_t *occlusion, ubo_ring_t *ring, const camera_t *camera,
+  game_object_t * const *objects, unsigned nObjects );
+// Draws the proxies into this frame's queries, after the occluders and
+// before the objects they test
+void occlusion_test( occlusion_t *occlusion, const ubo_ring_t *ring );
+// Zero when the slot was hidden last frame and its draw can be skipped.
+// Otherwise the draws up to occlusion_end_draw() are conditional on the
+// slot's query.
+int occlusion_begin_draw( occlusion_t *occlusion, unsigned slot );
+void occlusion_end_draw( occlusion_t *occlusion );
+
+#endif
@@ -0,0 +1,18 @@
+#version 330 core
+layout ( location = 0 ) in vec3 aPos;
+
+// std140 layouts must match frame_block_t and object_block_t in ubo.h
+layout ( std140 ) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 viewProjection;
+  vec4 time;
+};
+layout ( std140 ) uniform Object {
+  mat4 model;
+  vec4 params;
+};
+
+void main() {
+  gl_Position = viewProjection * model * vec4( aPos, 1.0 );
+}
@@ -0,0 +1,10 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec4 color;
+
+void main() {
+  // Round, soft edged points
+  float d = length( gl_PointCoord - vec2( 0.5 ) ) * 2.0;
+  FragColor = vec4( color.rgb, color.a * clamp( 1.0 - d, 0.0, 1.0 ) );
+}
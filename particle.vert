@@ -0,0 +1,31 @@
+#version 330 core
+layout ( location = 0 ) in vec2 aPosition;
+layout ( location = 2 ) in vec2 aAgeLife;
+
+// std140 layout must match frame_block_t in ubo.h
+layout ( std140 ) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 viewProjection;
+  vec4 time;
+};
+
+out vec4 color;
+
+void main() {
+  float t = aAgeLife.x / aAgeLife.y;
+
+  // Dead and never used slots end up outside the clip volume
+  if ( !( t < 1.0 ) ) {
+    gl_Position = vec4( 2.0, 2.0, 2.0, 1.0 );
+    gl_PointSize = 1.0;
+    color = vec4( 0.0 );
+    return;
+  }
+
+  gl_Position = viewProjection * vec4( aPosition, 0.0, 1.0 );
+  // Fire cooling into smoke that grows and fades
+  // In output pixels, whatever the resolution is rendered at
+  gl_PointSize = mix( 3.0, 12.0, t ) * time.z;
+  color = mix( vec4( 1.0, 0.7, 0.2, 0.6 ), vec4( 0.25, 0.25, 0.25, 0.0 ), sqrt( t ) );
+}
@@ -0,0 +1,60 @@
+#version 330 core
+layout ( location = 0 ) in vec2 aPosition;
+layout ( location = 1 ) in vec2 aVelocity;
+layout ( location = 2 ) in vec2 aAgeLife;
+
+// std140 layout must match frame_block_t in ubo.h
+layout ( std140 ) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 viewProjection;
+  vec4 time;
+};
+
+// Captured by transform feedback, in the order of gpu_particle_t
+out vec2 outPosition;
+out vec2 outVelocity;
+out vec2 outAgeLife;
+
+const vec2 GRAVITY = vec2( 0.0, -0.4 );
+const float DRAG = 1.5;
+
+uint hash( uint x ) {
+  x ^= x >> 16;
+  x *= 0x7feb352du;
+  x ^= x >> 15;
+  x *= 0x846ca68bu;
+  x ^= x >> 16;
+  return x;
+}
+
+float random( uint x ) {
+  return float( hash( x ) & 0xffffu ) / 65535.0;
+}
+
+void main() {
+  float dt = time.y;
+  vec2 position = aPosition;
+  vec2 velocity = aVelocity;
+  float age = aAgeLife.x;
+  float life = aAgeLife.y;
+
+  if ( age < 0.0 ) {
+    // Freshly spawned: velocity holds the speed and a seed
+    uint seed = uint( velocity.y ) * 2u;
+    float angle = random( seed ) * 6.2831853;
+    float speed = velocity.x * sqrt( random( seed + 1u ) );
+    velocity = vec2( cos( angle ), sin( angle ) ) * speed;
+    life *= 0.5 + 0.5 * random( seed + 0x9e3779b9u );
+    age = 0.0;
+  }
+  else if ( age < life ) {
+    velocity += ( GRAVITY - velocity * DRAG ) * dt;
+    position += velocity * dt;
+    age += dt;
+  }
+
+  outPosition = position;
+  outVelocity = velocity;
+  outAgeLife = vec2( age, life );
+}
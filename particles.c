@@ -0,0 +1,409 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <glad/glad.h>
+#include "particles.h"
+#include "gpu_mem.h"
+#include "jobs.h"
+#include "mem.h"
+#include "profiler.h"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#include <immintrin.h>
+#define PARTICLES_AVX2
+#endif
+
+// Fraction of velocity lost per second, and of the normal velocity kept
+// when bouncing off a circle
+#define DRAG 1.0f
+#define RESTITUTION 0.5f
+
+// particle.vert's inputs
+typedef struct particle_vertex {
+  float x;
+  float y;
+  float age;
+  float life;
+} particle_vertex_t;
+
+typedef struct tick_job {
+  particles_t *particles;
+  float dt;
+  const particle_circle_t *circles;
+  unsigned nCircles;
+} tick_job_t;
+
+typedef struct vertex_job {
+  const particles_t *particles;
+  particle_vertex_t *vertices;
+} vertex_job_t;
+
+static unsigned tick_block_scalar( particles_t *p, unsigned base, unsigned n, float dt, const particle_circle_t *circles, unsigned nCircles ) {
+
+  float damp = 1.0f - DRAG * dt;
+  unsigned w = base;
+
+  for ( unsigned i = base; i < base + n; ++i ) {
+    float vx = p->vx[ i ] * damp;
+    float vy = p->vy[ i ] * damp;
+    float x = p->x[ i ] + vx * dt;
+    float y = p->y[ i ] + vy * dt;
+
+    for ( unsigned c = 0; c < nCircles; ++c ) {
+      float dx = x - circles[ c ].x;
+      float dy = y - circles[ c ].y;
+      float d2 = dx * dx + dy * dy;
+      int hit = d2 < circles[ c ].radius * circles[ c ].radius && d2 > 0.0f;
+      float inv = hit ? 1.0f / sqrtf( d2 ) : 0.0f;
+      float nx = dx * inv, ny = dy * inv;
+      float vn = vx * nx + vy * ny;
+      // Only reflect what moves into the circle, and push out to its edge
+      float k = vn < 0.0f ? -( 1.0f + RESTITUTION ) * vn : 0.0f;
+      vx += k * nx;
+      vy += k * ny;
+      x = hit ? circles[ c ].x + nx * circles[ c ].radius : x;
+      y = hit ? circles[ c ].y + ny * circles[ c ].radius : y;
+    }
+
+    float age = p->age[ i ] + dt;
+    float life = p->life[ i ];
+
+    // Written unconditionally, only kept if alive
+    p->x[ w ] = x;
+    p->y[ w ] = y;
+    p->vx[ w ] = vx;
+    p->vy[ w ] = vy;
+    p->age[ w ] = age;
+    p->life[ w ] = life;
+    w += age < life;
+  }
+
+  return w - base;
+}
+
+static void write_vertices_scalar( const particles_t *p, unsigned base, unsigned n, particle_vertex_t *out ) {
+
+  for ( unsigned i = 0; i < n; ++i )
+    out[ i ] = (particle_vertex_t) { p->x[ base + i ], p->y[ base + i ], p->age[ base + i ], p->life[ base + i ] };
+}
+
+#ifdef PARTICLES_AVX2
+
+// For each mask of live lanes, the permutation moving them to the front
+static int32_t compactLut[ 256 ][ 8 ] __attribute__(( aligned( 32 ) ));
+
+static void init_compact_lut() {
+
+  for ( int mask = 0; mask < 256; ++mask ) {
+    int n = 0;
+    for ( int lane = 0; lane < 8; ++lane ) {
+      if ( mask & ( 1 << lane ) )
+        compactLut[ mask ][ n++ ] = lane;
+    }
+    while ( n < 8 )
+      compactLut[ mask ][ n++ ] = 0;
+  }
+}
+
+__attribute__(( target( "avx2" ) ))
+static unsigned tick_block_avx2( particles_t *p, unsigned base, unsigned n, float dt, const particle_circle_t *circles, unsigned nCircles ) {
+
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 vdt = _mm256_set1_ps( dt );
+  const __m256 damp = _mm256_set1_ps( 1.0f - DRAG * dt );
+  const __m256 bounce = _mm256_set1_ps( -( 1.0f + RESTITUTION ) );
+  const __m256i lanes = _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 );
+  unsigned w = base;
+
+  // Blocks are padded to whole vectors, lanes past n are treated as dead
+  for ( unsigned i = 0; i < n; i += 8 ) {
+    unsigned j = base + i;
+    __m256 vx = _mm256_mul_ps( _mm256_load_ps( p->vx + j ), damp );
+    __m256 vy = _mm256_mul_ps( _mm256_load_ps( p->vy + j ), damp );
+    __m256 x = _mm256_add_ps( _mm256_load_ps( p->x + j ), _mm256_mul_ps( vx, vdt ) );
+    __m256 y = _mm256_add_ps( _mm256_load_ps( p->y + j ), _mm256_mul_ps( vy, vdt ) );
+
+    for ( unsigned c = 0; c < nCircles; ++c ) {
+      __m256 cx = _mm256_set1_ps( circles[ c ].x );
+      __m256 cy = _mm256_set1_ps( circles[ c ].y );
+      __m256 r = _mm256_set1_ps( circles[ c ].radius );
+      __m256 dx = _mm256_sub_ps( x, cx );
+      __m256 dy = _mm256_sub_ps( y, cy );
+      __m256 d2 = _mm256_add_ps( _mm256_mul_ps( dx, dx ), _mm256_mul_ps( dy, dy ) );
+      __m256 hit = _mm256_and_ps( _mm256_cmp_ps( d2, _mm256_mul_ps( r, r ), _CMP_LT_OQ ), _mm256_cmp_ps( d2, zero, _CMP_GT_OQ ) );
+      // Most vectors are nowhere near most circles
+      if ( !_mm256_movemask_ps( hit ) )
+        continue;
+      __m256 inv = _mm256_and_ps( _mm256_rsqrt_ps( d2 ), hit );
+      __m256 nx = _mm256_mul_ps( dx, inv );
+      __m256 ny = _mm256_mul_ps( dy, inv );
+      __m256 vn = _mm256_add_ps( _mm256_mul_ps( vx, nx ), _mm256_mul_ps( vy, ny ) );
+      __m256 k = _mm256_and_ps( _mm256_mul_ps( vn, bounce ), _mm256_cmp_ps( vn, zero, _CMP_LT_OQ ) );
+      vx = _mm256_add_ps( vx, _mm256_mul_ps( k, nx ) );
+      vy = _mm256_add_ps( vy, _mm256_mul_ps( k, ny ) );
+      x = _mm256_blendv_ps( x, _mm256_add_ps( cx, _mm256_mul_ps( nx, r ) ), hit );
+      y = _mm256_blendv_ps( y, _mm256_add_ps( cy, _mm256_mul_ps( ny, r ) ), hit );
+    }
+
+    __m256 age = _mm256_add_ps( _mm256_load_ps( p->age + j ), vdt );
+    __m256 life = _mm256_load_ps( p->life + j );
+    __m256 inRange = _mm256_castsi256_ps( _mm256_cmpgt_epi32( _mm256_set1_epi32( (int) ( n - i ) ), lanes ) );
+    int mask = _mm256_movemask_ps( _mm256_and_ps( _mm256_cmp_ps( age, life, _CMP_LT_OQ ), inRange ) );
+    __m256i perm = _mm256_load_si256( (const __m256i*) compactLut[ mask ] );
+
+    // Left-packed over what was already read, w never passes j
+    _mm256_storeu_ps( p->x + w, _mm256_permutevar8x32_ps( x, perm ) );
+    _mm256_storeu_ps( p->y + w, _mm256_permutevar8x32_ps( y, perm ) );
+    _mm256_storeu_ps( p->vx + w, _mm256_permutevar8x32_ps( vx, perm ) );
+    _mm256_storeu_ps( p->vy + w, _mm256_permutevar8x32_ps( vy, perm ) );
+    _mm256_storeu_ps( p->age + w, _mm256_permutevar8x32_ps( age, perm ) );
+    _mm256_storeu_ps( p->life + w, _mm256_permutevar8x32_ps( life, perm ) );
+    w += __builtin_popcount( mask );
+  }
+
+  return w - base;
+}
+
+// SoA to AoS, eight particles at a time
+__attribute__(( target( "avx2" ) ))
+static void write_vertices_avx2( const particles_t *p, unsigned base, unsigned n, particle_vertex_t *out ) {
+
+  unsigned i = 0;
+
+  for ( ; i + 8 <= n; i += 8 ) {
+    unsigned j = base + i;
+    __m256 x = _mm256_load_ps( p->x + j );
+    __m256 y = _mm256_load_ps( p->y + j );
+    __m256 a = _mm256_load_ps( p->age + j );
+    __m256 l = _mm256_load_ps( p->life + j );
+    // x0 y0 x1 y1 | x4 y4 x5 y5 and so on
+    __m256 xy0 = _mm256_unpacklo_ps( x, y );
+    __m256 xy1 = _mm256_unpackhi_ps( x, y );
+    __m256 al0 = _mm256_unpacklo_ps( a, l );
+    __m256 al1 = _mm256_unpackhi_ps( a, l );
+    __m256 v0 = _mm256_castpd_ps( _mm256_unpacklo_pd( _mm256_castps_pd( xy0 ), _mm256_castps_pd( al0 ) ) );
+    __m256 v1 = _mm256_castpd_ps( _mm256_unpackhi_pd( _mm256_castps_pd( xy0 ), _mm256_castps_pd( al0 ) ) );
+    __m256 v2 = _mm256_castpd_ps( _mm256_unpacklo_pd( _mm256_castps_pd( xy1 ), _mm256_castps_pd( al1 ) ) );
+    __m256 v3 = _mm256_castpd_ps( _mm256_unpackhi_pd( _mm256_castps_pd( xy1 ), _mm256_castps_pd( al1 ) ) );
+    float *o = (float*) ( out + i );
+    _mm256_storeu_ps( o, _mm256_permute2f128_ps( v0, v1, 0x20 ) );
+    _mm256_storeu_ps( o + 8, _mm256_permute2f128_ps( v2, v3, 0x20 ) );
+    _mm256_storeu_ps( o + 16, _mm256_permute2f128_ps( v0, v1, 0x31 ) );
+    _mm256_storeu_ps( o + 24, _mm256_permute2f128_ps( v2, v3, 0x31 ) );
+  }
+
+  write_vertices_scalar( p, base + i, n - i, out + i );
+}
+
+#endif
+
+static void tick_blocks( void *ctx, unsigned begin, unsigned end ) {
+
+  tick_job_t *job = ctx;
+  particles_t *p = job->particles;
+
+  for ( unsigned b = begin; b < end; ++b ) {
+    unsigned base = b * PARTICLES_BLOCK;
+#ifdef PARTICLES_AVX2
+    if ( p->avx2 ) {
+      p->counts[ b ] = tick_block_avx2( p, base, p->counts[ b ], job->dt, job->circles, job->nCircles );
+      continue;
+    }
+#endif
+    p->counts[ b ] = tick_block_scalar( p, base, p->counts[ b ], job->dt, job->circles, job->nCircles );
+  }
+}
+
+static void write_vertices( void *ctx, unsigned begin, unsigned end ) {
+
+  vertex_job_t *job = ctx;
+  const particles_t *p = job->particles;
+
+  for ( unsigned b = begin; b < end; ++b ) {
+#ifdef PARTICLES_AVX2
+    if ( p->avx2 ) {
+      write_vertices_avx2( p, b * PARTICLES_BLOCK, p->counts[ b ], job->vertices + p->offsets[ b ] );
+      continue;
+    }
+#endif
+    write_vertices_scalar( p, b * PARTICLES_BLOCK, p->counts[ b ], job->vertices + p->offsets[ b ] );
+  }
+}
+
+int particles_init( particles_t *particles, unsigned capacity, int draw ) {
+
+  memset( particles, 0, sizeof( particles_t ) );
+  particles->blockCount = ( capacity + PARTICLES_BLOCK - 1 ) / PARTICLES_BLOCK;
+  particles->capacity = particles->blockCount * PARTICLES_BLOCK;
+  particles->seed = 2463534242u;
+
+  size_t n = particles->capacity;
+  particles->storage = mem_alloc( MEM_SIM, 6 * n * sizeof( float ) + 32 );
+  particles->counts = mem_calloc( MEM_SIM, particles->blockCount, sizeof( unsigned ) );
+  particles->offsets = mem_alloc( MEM_SIM, particles->blockCount * sizeof( unsigned ) );
+
+  if ( !particles->storage || !particles->counts || !particles->offsets ) {
+    fprintf( stderr, "Out of memory for %u particles\n", capacity );
+    return 0;
+  }
+
+  // Blocks are multiples of 8 floats, so every block starts aligned too
+  float *arrays = (float*) ( ( (uintptr_t) particles->storage + 31 ) & ~(uintptr_t) 31 );
+  particles->x = arrays;
+  particles->y = arrays + n;
+  particles->vx = arrays + 2 * n;
+  particles->vy = arrays + 3 * n;
+  particles->age = arrays + 4 * n;
+  particles->life = arrays + 5 * n;
+
+#ifdef PARTICLES_AVX2
+  particles->avx2 = __builtin_cpu_supports( "avx2" );
+  if ( particles->avx2 )
+    init_compact_lut();
+#endif
+
+  if ( !draw )
+    return 1;
+
+  particles->shader = create_shader( "particle.vert", "particle.frag" );
+  if ( !particles->shader )
+    return 0;
+
+  size_t bytes = n * sizeof( particle_vertex_t );
+  glGenVertexArrays( 1, &particles->vao );
+  glBindVertexArray( particles->vao );
+  glGenBuffers( 1, &particles->vbo );
+  glBindBuffer( GL_ARRAY_BUFFER, particles->vbo );
+  glBufferData( GL_ARRAY_BUFFER, bytes, NULL, GL_STREAM_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, particles->vbo, bytes, GL_STREAM_DRAW, "particles" );
+  glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, sizeof( particle_vertex_t ), (void*) 0 );
+  glEnableVertexAttribArray( 0 );
+  glVertexAttribPointer( 2, 2, GL_FLOAT, GL_FALSE, sizeof( particle_vertex_t ), (void*) ( 2 * sizeof( float ) ) );
+  glEnableVertexAttribArray( 2 );
+  glBindVertexArray( 0 );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  return 1;
+}
+
+void particles_destroy( particles_t *particles ) {
+
+  if ( particles->vbo ) {
+    gpu_mem_release( GPU_MEM_BUFFER, particles->vbo );
+    glDeleteBuffers( 1, &particles->vbo );
+    glDeleteVertexArrays( 1, &particles->vao );
+    destroy_shader( particles->shader );
+  }
+
+  mem_free( particles->storage );
+  mem_free( particles->counts );
+  mem_free( particles->offsets );
+  memset( particles, 0, sizeof( particles_t ) );
+}
+
+static float random_unit( uint32_t *seed ) {
+
+  // xorshift32
+  *seed ^= *seed << 13;
+  *seed ^= *seed >> 17;
+  *seed ^= *seed << 5;
+
+  return ( *seed >> 8 ) / (float) ( 1 << 24 );
+}
+
+void particles_emit( particles_t *particles, vec3_t position, vec3_t velocity, float spread, unsigned count, float life ) {
+
+  while ( count && particles->spawnBlock < particles->blockCount ) {
+    unsigned b = particles->spawnBlock;
+    unsigned room = PARTICLES_BLOCK - particles->counts[ b ];
+
+    if ( !room ) {
+      ++particles->spawnBlock;
+      continue;
+    }
+
+    unsigned n = count < room ? count : room;
+    unsigned base = b * PARTICLES_BLOCK + particles->counts[ b ];
+    for ( unsigned i = base; i < base + n; ++i ) {
+      particles->x[ i ] = position.x;
+      particles->y[ i ] = position.y;
+      particles->vx[ i ] = velocity.x + spread * ( random_unit( &particles->seed ) * 2.0f - 1.0f );
+      particles->vy[ i ] = velocity.y + spread * ( random_unit( &particles->seed ) * 2.0f - 1.0f );
+      particles->age[ i ] = 0.0f;
+      particles->life[ i ] = life * ( 0.5f + 0.5f * random_unit( &particles->seed ) );
+    }
+
+    particles->counts[ b ] += n;
+    particles->count += n;
+    particles->spawned += n;
+    count -= n;
+  }
+
+  particles->dropped += count;
+}
+
+void particles_tick( particles_t *particles, float dt, const particle_circle_t *circles, unsigned nCircles ) {
+
+  PROFILE_BEGIN( "particles_tick" );
+
+  tick_job_t job = { particles, dt, circles, nCircles };
+  jobs_parallel_for( particles->blockCount, 1, tick_blocks, &job );
+
+  unsigned count = 0;
+  particles->spawnBlock = particles->blockCount;
+  for ( unsigned b = 0; b < particles->blockCount; ++b ) {
+    count += particles->counts[ b ];
+    if ( particles->counts[ b ] < PARTICLES_BLOCK && b < particles->spawnBlock )
+      particles->spawnBlock = b;
+  }
+
+  particles->lastDied = particles->count - count;
+  particles->count = count;
+
+  PROFILE_END();
+}
+
+void particles_draw( particles_t *particles ) {
+
+  if ( !particles->count )
+    return;
+
+  PROFILE_BEGIN( "particles_draw" );
+
+  // Blocks are packed one after another in the vertex buffer
+  unsigned offset = 0;
+  for ( unsigned b = 0; b < particles->blockCount; ++b ) {
+    particles->offsets[ b ] = offset;
+    offset += particles->counts[ b ];
+  }
+
+  glBindBuffer( GL_ARRAY_BUFFER, particles->vbo );
+  // Invalidated, so the driver can hand out fresh memory instead of waiting
+  // for last frame's draw
+  particle_vertex_t *vertices = glMapBufferRange( GL_ARRAY_BUFFER, 0, particles->count * sizeof( particle_vertex_t ),
+    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT );
+
+  if ( !vertices ) {
+    fprintf( stderr, "Failed to map the particle vertex buffer\n" );
+    glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    PROFILE_END();
+    return;
+  }
+
+  vertex_job_t job = { particles, vertices };
+  jobs_parallel_for( particles->blockCount, 1, write_vertices, &job );
+  glUnmapBuffer( GL_ARRAY_BUFFER );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  activate_shader( particles->shader );
+  glEnable( GL_PROGRAM_POINT_SIZE );
+  glEnable( GL_BLEND );
+  glBlendFuncSeparate( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
+  glBindVertexArray( particles->vao );
+  glDrawArrays( GL_POINTS, 0, particles->count );
+  glBindVertexArray( 0 );
+  glDisable( GL_BLEND );
+  glDisable( GL_PROGRAM_POINT_SIZE );
+
+  PROFILE_END();
+}
@@ -0,0 +1,68 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <stdint.h>
+#include "linmath.h"
+#include "renderer.h"
+
+/*
+ * Particles simulated on the CPU, for effects that gameplay has to see.
+ * Attributes are kept as separate arrays (SoA), in fixed-size blocks that
+ * the job pool ticks in parallel. Each block keeps its live particles packed
+ * at its front: the tick integrates, collides and compacts in one pass
+ * without branching per particle, with an AVX2 kernel where the CPU has it.
+ * Drawing writes positions straight into a mapped vertex buffer and uses
+ * particle.vert like the GPU particles.
+ */
+// Particles per block, a multiple of 8 so kernels never need a tail
+#define PARTICLES_BLOCK 4096
+
+// Particles bounce off these
+typedef struct particle_circle {
+  float x;
+  float y;
+  float radius;
+} particle_circle_t;
+
+typedef struct particles {
+  unsigned capacity;
+  unsigned blockCount;
+  // Attribute arrays, each capacity long and 32-byte aligned
+  float *x;
+  float *y;
+  float *vx;
+  float *vy;
+  float *age;
+  float *life;
+  void *storage;
+  // Live particles at the front of each block, and where each block's
+  // vertices start in the vertex buffer
+  unsigned *counts;
+  unsigned *offsets;
+  unsigned count;
+  // Blocks before this one are full
+  unsigned spawnBlock;
+  uint32_t seed;
+  int avx2;
+
+  unsigned vbo;
+  unsigned vao;
+  shader_t *shader;
+
+  // Over the whole run, spawns that didn't fit are dropped
+  unsigned long long spawned;
+  unsigned long long dropped;
+  // Of the last tick
+  unsigned lastDied;
+} particles_t;
+
+// With draw = 0 no GL resources are created, for simulation only
+int particles_init( particles_t *particles, unsigned capacity, int draw );
+void particles_destroy( particles_t *particles );
+// Spawns count particles at position, with velocity plus up to spread in
+// each direction, living up to life seconds
+void particles_emit( particles_t *particles, vec3_t position, vec3_t velocity, float spread, unsigned count, float life );
+void particles_tick( particles_t *particles, float dt, const particle_circle_t *circles, unsigned nCircles );
+void particles_draw( particles_t *particles );
+
+#endif
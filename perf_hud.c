@@ -0,0 +1,126 @@
+#include <glad/glad.h>
+#include <glad/gl_stats.h>
+#include "perf_hud.h"
+#include "timing.h"
+#include "mem.h"
+#include "gpu_mem.h"
+
+#define GRAPH_W FRAME_STATS_RECENT
+#define LINE_H UI_LINE_H
+#define MB( bytes ) ( ( bytes ) / ( 1024.0 * 1024.0 ) )
+
+static const color_t textColor = { 220, 220, 220, 255 };
+static const color_t headingColor = { 255, 210, 90, 255 };
+
+// One bar per frame, oldest on the left, scaled so that twice the budget or
+// the slowest frame fills the graph. The tick part of each frame is drawn
+// over its bar.
+static void draw_graph( ui_t *ui, int x, int y, int h, const frame_stats_t *stats ) {
+
+  float budget = (float) ( stats->budget_ns / (double) NS_PER_MS );
+  float top = 2.0f * budget;
+
+  for ( unsigned i = 0; i < FRAME_STATS_RECENT; ++i )
+    top = stats->recent_interval_ms[ i ] > top ? stats->recent_interval_ms[ i ] : top;
+
+  float scale = h / top;
+
+  ui_rect( ui, x, y, GRAPH_W, h, (color_t) { 0, 0, 0, 160 } );
+
+  for ( unsigned i = 0; i < FRAME_STATS_RECENT; ++i ) {
+    unsigned slot = ( stats->recent_next + i ) % FRAME_STATS_RECENT;
+    float interval = stats->recent_interval_ms[ slot ];
+    int barH = (int) ( interval * scale );
+    int tickH = (int) ( stats->recent_tick_ms[ slot ] * scale );
+    tickH = tickH > barH ? barH : tickH;
+
+    color_t color = interval > budget ? (color_t) { 230, 60, 50, 255 } : (color_t) { 80, 200, 90, 255 };
+    if ( barH )
+      ui_rect( ui, x + (int) i, y + h - barH, 1, barH, color );
+    if ( tickH )
+      ui_rect( ui, x + (int) i, y + h - tickH, 1, tickH, (color_t) { 90, 140, 255, 255 } );
+  }
+
+  ui_rect( ui, x, y + h - (int) ( budget * scale ), GRAPH_W, 1, (color_t) { 255, 255, 255, 128 } );
+  ui_text( ui, x + 2, y + 2, 1, textColor, "%.0f ms", top );
+}
+
+static int draw_frame_column( ui_t *ui, int x, int y, const frame_stats_t *stats ) {
+
+  float sum = 0.0f, max = 0.0f, cpu = 0.0f, tick = 0.0f;
+  unsigned last = ( stats->recent_next + FRAME_STATS_RECENT - 1 ) % FRAME_STATS_RECENT;
+
+  unsigned n = 0;
+
+  // Slots not written yet are still zero
+  for ( unsigned i = 0; i < FRAME_STATS_RECENT; ++i ) {
+    float interval = stats->recent_interval_ms[ i ];
+    if ( interval <= 0.0f )
+      continue;
+    sum += interval;
+    max = interval > max ? interval : max;
+    cpu += stats->recent_cpu_ms[ i ];
+    tick += stats->recent_tick_ms[ i ];
+    ++n;
+  }
+
+  int width = 0, w;
+  n = n ? n : 1;
+
+#define LINE( color, ... ) \
+  w = ui_text( ui, x, y, 1, color, __VA_ARGS__ ); \
+  width = w > width ? w : width; \
+  y += LINE_H
+
+  LINE( headingColor, "frame (last %u)", n );
+  LINE( textColor, "%.2f ms, avg %.2f max %.2f", stats->recent_interval_ms[ last ], sum / n, max );
+  LINE( textColor, "cpu %.2f tick %.2f ms avg", cpu / n, tick / n );
+
+  const gl_stats_frame_t *gl = gl_stats_last_frame();
+  if ( gl ) {
+    LINE( textColor, "draws %llu calls %llu", gl->draws, gl->calls );
+    LINE( textColor, "state %llu binds %llu", gl->stateChanges, gl->binds );
+    LINE( textColor, "upload %.1f KB", gl->bytesUploaded / 1024.0 );
+  }
+  else {
+    LINE( textColor, "GL counts need GL_STATS=1" );
+  }
+
+  size_t cpuBytes = 0;
+  for ( int tag = 0; tag < MEM_TAGS; ++tag )
+    cpuBytes += mem_get_stats( (mem_tag_t) tag )->liveBytes;
+  LINE( headingColor, "memory" );
+  LINE( textColor, "cpu %.1f MB gpu %.1f MB", MB( cpuBytes ), MB( gpu_mem_live_bytes() ) );
+
+#undef LINE
+
+  return width;
+}
+
+static void draw_gpu_column( ui_t *ui, int x, int y, int h, const gpu_timer_t *gpuTimer ) {
+
+  int rows = h / LINE_H - 1;
+
+  ui_text( ui, x, y, 1, headingColor, "gpu ms" );
+  if ( !gpuTimer->supported )
+    ui_text( ui, x, y + LINE_H, 1, textColor, "unsupported" );
+  for ( unsigned i = 0; i < gpuTimer->resultCount; ++i ) {
+    // Wraps into a second column when there are more zones than rows
+    int column = (int) i / rows, row = (int) i % rows;
+    const gpu_zone_result_t *zone = &gpuTimer->results[ i ];
+    ui_text( ui, x + column * 96, y + ( row + 1 ) * LINE_H, 1, textColor, "%-9.9s%6.3f",
+      zone->name, zone->duration_ns / (double) NS_PER_MS );
+  }
+}
+
+void perf_hud_draw( ui_t *ui, int x, int y, int w, int h, const frame_stats_t *stats, const gpu_timer_t *gpuTimer ) {
+
+  const int pad = 4;
+
+  ui_rect( ui, x, y, w, h, (color_t) { 20, 20, 28, 255 } );
+  draw_graph( ui, x + pad, y + pad, h - 2 * pad, stats );
+
+  int column = x + pad + GRAPH_W + 2 * pad;
+  column += draw_frame_column( ui, column, y + pad, stats ) + 3 * pad;
+  draw_gpu_column( ui, column, y + pad, h - 2 * pad, gpuTimer );
+}
@@ -0,0 +1,16 @@
+#ifndef PERF_HUD_H
+#define PERF_HUD_H
+
+#include "ui.h"
+#include "frame_stats.h"
+#include "gpu_timer.h"
+
+/*
+ * Live performance overlay built from the UI layer: a graph of the recent
+ * frames from the frame stats ring, next to the last frame's GL call
+ * counts, GPU zone times and memory use. Reads what the other subsystems
+ * already keep, so drawing it costs a few hundred quads and nothing else.
+ */
+void perf_hud_draw( ui_t *ui, int x, int y, int w, int h, const frame_stats_t *stats, const gpu_timer_t *gpuTimer );
+
+#endif
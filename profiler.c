@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "profiler.h"
+#include "timing.h"
+
+typedef struct profile_event {
+  const char *name;
+  uint64_t start;
+  uint64_t duration;
+} profile_event_t;
+
+typedef struct profile_thread {
+  profile_event_t *events;
+  unsigned count;
+  unsigned dropped;
+  unsigned tid;
+  const char *name;
+  // Open zones
+  uint64_t stack[ PROFILE_MAX_DEPTH ];
+  const char *stackNames[ PROFILE_MAX_DEPTH ];
+  unsigned depth;
+} profile_thread_t;
+
+static uint64_t baseTime;
+static profile_thread_t *threads[ PROFILE_MAX_THREADS ];
+static unsigned threadCount;
+static __thread profile_thread_t *currentThread;
+// GPU zones get a track of their own
+static profile_thread_t *gpuThread;
+
+static profile_thread_t* register_thread( const char *name ) {
+
+  unsigned slot = __atomic_fetch_add( &threadCount, 1, __ATOMIC_RELAXED );
+  if ( slot >= PROFILE_MAX_THREADS )
+    return NULL;
+
+  profile_thread_t *thread = calloc( 1, sizeof( profile_thread_t ) );
+  if ( !thread )
+    return NULL;
+
+  thread->events = malloc( PROFILE_MAX_EVENTS * sizeof( profile_event_t ) );
+  if ( !thread->events ) {
+    free( thread );
+    return NULL;
+  }
+
+  thread->tid = slot + 1;
+  thread->name = name;
+  __atomic_store_n( &threads[ slot ], thread, __ATOMIC_RELEASE );
+
+  return thread;
+}
+
+static profile_thread_t* get_thread() {
+
+  if ( !currentThread )
+    currentThread = register_thread( NULL );
+
+  return currentThread;
+}
+
+static void push_event( profile_thread_t *thread, const char *name, uint64_t start, uint64_t duration ) {
+
+  if ( thread->count >= PROFILE_MAX_EVENTS ) {
+    ++thread->dropped;
+    return;
+  }
+
+  profile_event_t *event = &thread->events[ thread->count ];
+  event->name = name;
+  event->start = start;
+  event->duration = duration;
+  __atomic_store_n( &thread->count, thread->count + 1, __ATOMIC_RELEASE );
+}
+
+void profiler_init() {
+
+  baseTime = timing_now_ns();
+}
+
+void profiler_thread_name( const char *name ) {
+
+  profile_thread_t *thread = get_thread();
+  if ( thread )
+    thread->name = name;
+}
+
+void profiler_begin( const char *name ) {
+
+  profile_thread_t *thread = get_thread();
+  if ( !thread )
+    return;
+
+  // Too deep zones are still counted so that the matching end pops correctly
+  if ( thread->depth < PROFILE_MAX_DEPTH ) {
+    thread->stackNames[ thread->depth ] = name;
+    thread->stack[ thread->depth ] = timing_now_ns();
+  }
+
+  ++thread->depth;
+}
+
+void profiler_end() {
+
+  uint64_t now = timing_now_ns();
+  profile_thread_t *thread = get_thread();
+
+  if ( !thread || thread->depth == 0 )
+    return;
+
+  --thread->depth;
+
+  if ( thread->depth < PROFILE_MAX_DEPTH ) {
+    uint64_t start = thread->stack[ thread->depth ];
+    push_event( thread, thread->stackNames[ thread->depth ], start, now - start );
+  }
+}
+
+void profiler_gpu_zone( const char *name, uint64_t start_ns, uint64_t duration_ns ) {
+
+  if ( !gpuThread )
+    gpuThread = register_thread( "GPU" );
+
+  if ( gpuThread )
+    push_event( gpuThread, name, start_ns, duration_ns );
+}
+
+int profiler_write( const char *path ) {
+
+  FILE *file = fopen( path, "w" );
+  if ( !file ) {
+    fprintf( stderr, "Could not write trace to %s\n", path );
+    return 0;
+  }
+
+  unsigned nThreads = __atomic_load_n( &threadCount, __ATOMIC_ACQUIRE );
+  if ( nThreads > PROFILE_MAX_THREADS )
+    nThreads = PROFILE_MAX_THREADS;
+
+  int first = 1;
+  fprintf( file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+
+  for ( unsigned t = 0; t < nThreads; ++t ) {
+    profile_thread_t *thread = __atomic_load_n( &threads[ t ], __ATOMIC_ACQUIRE );
+    if ( !thread )
+      continue;
+
+    if ( thread->name ) {
+      fprintf( file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+        first ? "" : ",\n", thread->tid, thread->name );
+      first = 0;
+    }
+
+    unsigned count = __atomic_load_n( &thread->count, __ATOMIC_ACQUIRE );
+
+    for ( unsigned i = 0; i < count; ++i ) {
+      const profile_event_t *event = &thread->events[ i ];
+      // Chrome wants microseconds. GPU zones can start before baseTime.
+      double ts = ( (double) event->start - (double) baseTime ) / 1000.0;
+      fprintf( file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+        first ? "" : ",\n", event->name, thread->tid, ts, event->duration / 1000.0 );
+      first = 0;
+    }
+
+    if ( thread->dropped )
+      fprintf( stderr, "Profiler: thread %u dropped %u events\n", thread->tid, thread->dropped );
+  }
+
+  fprintf( file, "\n]}\n" );
+
+  return fclose( file ) == 0;
+}
@@ -0,0 +1,48 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+/*
+ * Scoped CPU zones written out as Chrome trace events (load the file in
+ * chrome://tracing or https://ui.perfetto.dev). Every thread records into its
+ * own buffer, so recording takes no locks. Zones nest, but must be ended on
+ * the thread that began them.
+ *
+ * Everything compiles to nothing unless PROFILE is defined (PROFILE=1 ./build.sh).
+ */
+#ifdef PROFILE
+
+#define PROFILE_INIT() profiler_init()
+#define PROFILE_THREAD_NAME( name ) profiler_thread_name( name )
+// name must be a string literal or otherwise outlive the profiler
+#define PROFILE_BEGIN( name ) profiler_begin( name )
+#define PROFILE_END() profiler_end()
+#define PROFILE_GPU_ZONE( name, start_ns, duration_ns ) profiler_gpu_zone( name, start_ns, duration_ns )
+#define PROFILE_WRITE( path ) profiler_write( path )
+
+#else
+
+#define PROFILE_INIT() ( (void) 0 )
+#define PROFILE_THREAD_NAME( name ) ( (void) 0 )
+#define PROFILE_BEGIN( name ) ( (void) 0 )
+#define PROFILE_END() ( (void) 0 )
+#define PROFILE_GPU_ZONE( name, start_ns, duration_ns ) ( (void) 0 )
+#define PROFILE_WRITE( path ) ( (void) 0 )
+
+#endif
+
+#define PROFILE_MAX_THREADS 64
+#define PROFILE_MAX_EVENTS ( 1 << 20 )
+#define PROFILE_MAX_DEPTH 32
+
+void profiler_init();
+void profiler_thread_name( const char *name );
+void profiler_begin( const char *name );
+void profiler_end();
+// Zones measured elsewhere, e.g. by gpu_timer, on the timing_now_ns() timeline
+void profiler_gpu_zone( const char *name, uint64_t start_ns, uint64_t duration_ns );
+// Call once the other threads have stopped recording
+int profiler_write( const char *path );
+
+#endif
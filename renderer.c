@@ -0,0 +1,485 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <glad/glad.h>
+#include <glad/gl_stats.h>
+#include "renderer.h"
+#include "profiler.h"
+#include "gpu_mem.h"
+#include "mem.h"
+#include "ubo.h"
+#include "simplify.h"
+
+static const backend_t *backend;
+
+int r_init( const backend_t *b, int width, int height ) {
+
+  backend = b;
+
+  if ( !backend->init( width, height ) )
+    return 0;
+
+  if ( !gladLoadGLLoader( (GLADloadproc) backend->get_proc_address ) ) {
+    fprintf( stderr, "Could not init GLAD\n" );
+    return 0;
+  }
+
+  gl_stats_install();
+
+  backend->resize( width, height );
+  glBindFramebuffer( GL_FRAMEBUFFER, backend->framebuffer() );
+  glClearColor( 0.0f, 0.5f, 0.0f, 1.0f );
+
+  if ( !ubo_frame_init() )
+    return 0;
+
+  printf( "Renderer: %s (%s backend)\n", glGetString( GL_RENDERER ), backend->name );
+
+  return 1;
+}
+
+void r_resize( int width, int height ) {
+
+  backend->resize( width, height );
+  glBindFramebuffer( GL_FRAMEBUFFER, backend->framebuffer() );
+}
+
+unsigned r_framebuffer() {
+  return backend->framebuffer();
+}
+
+void r_present() {
+  backend->present();
+}
+
+void r_destroy() {
+
+  ubo_frame_destroy();
+  backend->destroy();
+}
+
+const char* get_file_contents( const char *path ) {
+
+  FILE *file = fopen( path, "r" );
+  if ( !file )
+    return NULL;
+
+  fseek( file, 0L, SEEK_END );
+  long filesize = ftell( file );
+  rewind( file );
+
+  char *ret = (char*) mem_alloc( MEM_ASSETS, filesize + 1 );
+  char *i = ret;
+  char c;
+
+  while ( ( c = fgetc( file ) ) != EOF ) {
+    *i = c;
+    ++i;
+  }
+
+  fclose( file );
+
+  *i = '\0';
+
+  return ret;
+}
+
+unsigned compile_shader( const char *filePath, GLenum shaderType ) {
+
+  unsigned shader = glCreateShader( shaderType );
+  const char * const shaderStr = get_file_contents( filePath );
+
+  if ( !shaderStr ) {
+    fprintf( stderr, "File not found: %s\n", filePath );
+    return 0;
+  }
+
+  glShaderSource( shader, 1, &shaderStr, NULL );
+  mem_free( (void*) shaderStr );
+
+  int success = 0;
+  char infoLog[ MAX_GL_INFO_LOG ] = { 0 };
+
+  glCompileShader( shader );
+  glGetShaderiv( shader, GL_COMPILE_STATUS, &success );
+
+  if ( !success ) {
+    glGetShaderInfoLog( shader, MAX_GL_INFO_LOG, NULL, infoLog );
+    fprintf( stderr, "Shader %s compilation failed: %s\n", filePath, infoLog );
+    return 0;
+  }
+
+  return shader;
+}
+
+// Links the program and points its uniform blocks at the shared bindings
+static shader_t* link_program( unsigned shaderProgram ) {
+
+  int success = 0;
+  char infoLog[ MAX_GL_INFO_LOG ] = { 0 };
+
+  glLinkProgram( shaderProgram );
+  glGetProgramiv( shaderProgram, GL_LINK_STATUS, &success );
+
+  if ( !success ) {
+    glGetProgramInfoLog( shaderProgram, MAX_GL_INFO_LOG, NULL, infoLog );
+    fprintf( stderr, "Shader program linking failed: %s\n", infoLog );
+    return 0;
+  }
+
+  // The same binding points for every program, see ubo.h
+  unsigned frameBlock = glGetUniformBlockIndex( shaderProgram, "Frame" );
+  if ( frameBlock != GL_INVALID_INDEX )
+    glUniformBlockBinding( shaderProgram, frameBlock, UBO_FRAME_BINDING );
+  unsigned objectBlock = glGetUniformBlockIndex( shaderProgram, "Object" );
+  if ( objectBlock != GL_INVALID_INDEX )
+    glUniformBlockBinding( shaderProgram, objectBlock, UBO_OBJECT_BINDING );
+
+  shader_t *ret = mem_alloc( MEM_RENDERER, sizeof( shader_t ) );
+  ret->programId = shaderProgram;
+
+  return ret;
+}
+
+shader_t* create_shader( const char *vertexShaderPath, const char *fragShaderPath ) {
+
+  unsigned shaderProgram = glCreateProgram();
+
+  unsigned vertexShader = compile_shader( vertexShaderPath, GL_VERTEX_SHADER );
+  glAttachShader( shaderProgram, vertexShader );
+
+  unsigned fragShader = compile_shader( fragShaderPath, GL_FRAGMENT_SHADER );
+  glAttachShader( shaderProgram, fragShader );
+
+  shader_t *ret = link_program( shaderProgram );
+
+  glDeleteShader( vertexShader );
+  glDeleteShader( fragShader );
+
+  return ret;
+}
+
+shader_t* create_feedback_shader( const char *vertexShaderPath, const char * const *varyings, unsigned nVaryings ) {
+
+  unsigned shaderProgram = glCreateProgram();
+
+  unsigned vertexShader = compile_shader( vertexShaderPath, GL_VERTEX_SHADER );
+  glAttachShader( shaderProgram, vertexShader );
+  glTransformFeedbackVaryings( shaderProgram, nVaryings, varyings, GL_INTERLEAVED_ATTRIBS );
+
+  shader_t *ret = link_program( shaderProgram );
+
+  glDeleteShader( vertexShader );
+
+  return ret;
+}
+
+void activate_shader( const shader_t *shader ) {
+  glUseProgram( shader->programId );
+}
+
+void pack_vertices( const vec3_t *locations, const vec3_t *colors, unsigned nVertices, vec3_t *out ) {
+
+  for ( unsigned i = 0; i < nVertices; ++i ) {
+    out[ i ] = locations[ i ];
+    out[ nVertices + i ] = colors[ i ];
+  }
+}
+
+// Projected heights in pixels below which each coarser level kicks in
+static const float lodThresholds[ OBJECT_MAX_LODS - 1 ] = { 160.0f, 80.0f, 40.0f };
+#define LOD_HYSTERESIS 0.15f
+
+static game_object_t* upload_object( const vec3_t *locations, const vec3_t *colors, unsigned nVertices ) {
+
+  // Bounds come from the vertices
+  if ( nVertices == 0 ) {
+    fprintf( stderr, "Can't create an object without vertices\n" );
+    return NULL;
+  }
+
+  vec3_t *vertices = mem_alloc( MEM_SCRATCH, nVertices * 2 * sizeof( vec3_t ) );
+  game_object_t *obj = mem_calloc( MEM_RENDERER, 1, sizeof( game_object_t ) );
+  if ( !vertices || !obj ) {
+    mem_free( vertices );
+    mem_free( obj );
+    return NULL;
+  }
+
+  unsigned vao;
+  glGenVertexArrays( 1, &vao );
+  glBindVertexArray( vao );
+
+  unsigned vbo;
+  pack_vertices( locations, colors, nVertices, vertices );
+
+  glGenBuffers( 1, &vbo );
+  // "OpenGL has many types of buffer objects and the buffer type of a vertex
+  // buffer object is GL_ARRAY_BUFFER. OpenGL allows us to bind to several
+  // buffers at once as long as they have a different buffer type."
+  glBindBuffer( GL_ARRAY_BUFFER, vbo );
+  // This apparently transfers data to GPU memory.
+  // https://cognitivewaves.wordpress.com/opengl-terminology-demystified/
+  glBufferData( GL_ARRAY_BUFFER, nVertices * 2 * sizeof( vec3_t ), vertices, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, vbo, nVertices * 2 * sizeof( vec3_t ), GL_STATIC_DRAW, "objects" );
+  mem_free( vertices );
+
+  // "...the position vertex attribute in the vertex shader with layout (location = 0). This sets the location of the vertex attribute to 0..."
+  // "The vertex attribute is a vec3 so it is composed of 3 values."
+  // "The third argument specifies the type of the data which is GL_FLOAT (a vec* in GLSL consists of floating point values)."
+  // "The next argument specifies if we want the data to be normalized."
+  // "The fifth argument is known as the stride and tells us the space between consecutive vertex attribute sets."
+  // "The last parameter is of type void* and thus requires that weird cast. This is the offset of where the position data begins in the buffer."
+  glVertexAttribPointer( 0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof( float ), (void*) 0 );
+  glEnableVertexAttribArray( 0 );
+
+  glVertexAttribPointer( 1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof( float ), (void*) ( nVertices * sizeof( vec3_t ) ) );
+  glEnableVertexAttribArray( 1 );
+
+  // The VAO stays bound for create_lod_object() to attach its indices
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  obj->vao = vao;
+  obj->vbo = vbo;
+  obj->vertex_count = nVertices;
+  obj->position = (vec3_t) { 0.0f, 0.0f, 0.0f };
+  obj->proxy = BVH_NULL;
+  obj->visible = 1;
+
+  obj->bounds = (aabb_t) { locations[ 0 ], locations[ 0 ] };
+  for ( unsigned i = 1; i < nVertices; ++i ) {
+    obj->bounds.min = vec3_min( obj->bounds.min, locations[ i ] );
+    obj->bounds.max = vec3_max( obj->bounds.max, locations[ i ] );
+  }
+
+  return obj;
+}
+
+game_object_t* create_object( const vec3_t *locations, const vec3_t *colors, unsigned nVertices ) {
+
+  game_object_t *obj = upload_object( locations, colors, nVertices );
+  glBindVertexArray( 0 );
+
+  return obj;
+}
+
+unsigned* build_lods( const vec3_t *locations, unsigned nVertices, const unsigned *indices, unsigned nIndices,
+  unsigned nLods, object_lod_t *lods, unsigned *lodCount ) {
+
+  nLods = nLods < 1 ? 1 : nLods > OBJECT_MAX_LODS ? OBJECT_MAX_LODS : nLods;
+
+  // Every level is at most as long as the full one
+  unsigned *levels = mem_alloc( MEM_SCRATCH, nIndices * nLods * sizeof( unsigned ) );
+  if ( !levels ) {
+    fprintf( stderr, "Failed to allocate %u levels of detail\n", nLods );
+    return NULL;
+  }
+
+  lods[ 0 ] = (object_lod_t) { 0, nIndices };
+  memcpy( levels, indices, nIndices * sizeof( unsigned ) );
+  unsigned total = nIndices;
+  *lodCount = 1;
+
+  // Each level simplifies the previous one, so the work shrinks as it goes
+  for ( ; *lodCount < nLods; ++*lodCount ) {
+    const object_lod_t *prev = &lods[ *lodCount - 1 ];
+    unsigned target = prev->count / 6 * 3;
+    unsigned count = simplify_mesh( levels + total, levels + prev->first, prev->count,
+      locations, nVertices, target, NULL );
+    // Not worth a level when the mesh won't get meaningfully simpler
+    if ( count == 0 || count > prev->count * 7 / 8 )
+      break;
+
+    lods[ *lodCount ] = (object_lod_t) { total, count };
+    total += count;
+  }
+
+  return levels;
+}
+
+game_object_t* create_lod_object( const vec3_t *locations, const vec3_t *colors, unsigned nVertices,
+  const unsigned *indices, unsigned nIndices, unsigned nLods ) {
+
+  object_lod_t lods[ OBJECT_MAX_LODS ];
+  unsigned lodCount;
+  unsigned *levels = build_lods( locations, nVertices, indices, nIndices, nLods, lods, &lodCount );
+  if ( !levels )
+    return NULL;
+  unsigned total = lods[ lodCount - 1 ].first + lods[ lodCount - 1 ].count;
+
+  game_object_t *obj = upload_object( locations, colors, nVertices );
+  if ( !obj ) {
+    mem_free( levels );
+    return NULL;
+  }
+
+  glGenBuffers( 1, &obj->ibo );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, obj->ibo );
+  glBufferData( GL_ELEMENT_ARRAY_BUFFER, total * sizeof( unsigned ), levels, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, obj->ibo, total * sizeof( unsigned ), GL_STATIC_DRAW, "objects" );
+  glBindVertexArray( 0 );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+  mem_free( levels );
+
+  memcpy( obj->lods, lods, sizeof( lods ) );
+  obj->lodCount = lodCount;
+  obj->indexType = GL_UNSIGNED_INT;
+
+  return obj;
+}
+
+game_object_t* create_indexed_object( unsigned vao, unsigned vbo, unsigned ibo, unsigned indexType, unsigned nVertices,
+  const object_lod_t *lods, unsigned lodCount, aabb_t bounds ) {
+
+  game_object_t *obj = mem_calloc( MEM_RENDERER, 1, sizeof( game_object_t ) );
+  if ( !obj )
+    return NULL;
+
+  obj->vao = vao;
+  obj->vbo = vbo;
+  obj->ibo = ibo;
+  obj->indexType = indexType;
+  obj->vertex_count = nVertices;
+  obj->lodCount = lodCount < OBJECT_MAX_LODS ? lodCount : OBJECT_MAX_LODS;
+  memcpy( obj->lods, lods, obj->lodCount * sizeof( object_lod_t ) );
+  obj->bounds = bounds;
+  obj->position = (vec3_t) { 0.0f, 0.0f, 0.0f };
+  obj->proxy = BVH_NULL;
+  obj->visible = 1;
+
+  return obj;
+}
+
+void destroy_shader( shader_t *shader ) {
+
+  if ( !shader )
+    return;
+
+  glDeleteProgram( shader->programId );
+  mem_free( shader );
+}
+
+void destroy_object( game_object_t *obj ) {
+
+  if ( !obj )
+    return;
+
+  glDeleteVertexArrays( 1, &obj->vao );
+  glDeleteBuffers( 1, &obj->vbo );
+  gpu_mem_release( GPU_MEM_BUFFER, obj->vbo );
+  if ( obj->ibo ) {
+    glDeleteBuffers( 1, &obj->ibo );
+    gpu_mem_release( GPU_MEM_BUFFER, obj->ibo );
+  }
+  mem_free( obj );
+}
+
+aabb_t object_world_bounds( const game_object_t *obj ) {
+  return aabb_translate( obj->bounds, obj->position );
+}
+
+void move_object( bvh_t *bvh, game_object_t *obj, vec3_t position ) {
+
+  obj->position = position;
+
+  if ( obj->proxy == BVH_NULL )
+    obj->proxy = bvh_insert( bvh, object_world_bounds( obj ), obj );
+  else
+    bvh_move( bvh, obj->proxy, object_world_bounds( obj ) );
+}
+
+void remove_object( bvh_t *bvh, game_object_t *obj ) {
+
+  if ( obj->proxy == BVH_NULL )
+    return;
+
+  bvh_remove( bvh, obj->proxy );
+  obj->proxy = BVH_NULL;
+}
+
+static void mark_visible( void *ctx, void *userData ) {
+  ( (game_object_t*) userData )->visible = 1;
+}
+
+unsigned cull_objects( const bvh_t *bvh, const frustum_t *frustum, game_object_t * const *objects, unsigned nObjects ) {
+
+  for ( unsigned i = 0; i < nObjects; ++i )
+    objects[ i ]->visible = objects[ i ]->proxy == BVH_NULL;
+
+  bvh_cull( bvh, frustum, mark_visible, NULL );
+
+  unsigned visible = 0;
+  for ( unsigned i = 0; i < nObjects; ++i )
+    visible += objects[ i ]->visible;
+
+  return visible;
+}
+
+long push_object_block( ubo_ring_t *ring, const game_object_t *obj, float lightness ) {
+
+  if ( !obj->visible )
+    return -1;
+
+  object_block_t block = { mat4_translate( obj->position ), { lightness, 0.0f, 0.0f, 0.0f } };
+
+  return ubo_ring_push( ring, &block, sizeof( block ) );
+}
+
+void bind_object_block( const ubo_ring_t *ring, long offset ) {
+
+  if ( offset >= 0 )
+    ubo_ring_bind( ring, UBO_OBJECT_BINDING, offset, sizeof( object_block_t ) );
+}
+
+unsigned select_object_lod( game_object_t *obj, const camera_t *camera, float viewportHeight ) {
+
+  if ( obj->lodCount < 2 )
+    return obj->lod = 0;
+
+  // The bounding sphere's diameter over the height of the view at its
+  // distance
+  vec3_t size = vec3_sub( obj->bounds.max, obj->bounds.min );
+  vec3_t center = vec3_add( obj->position, vec3_scale( vec3_add( obj->bounds.min, obj->bounds.max ), 0.5f ) );
+  float diameter = sqrtf( vec3_dot( size, size ) );
+  float viewHeight = camera->orthoHeight;
+  if ( camera->fovY > 0.0f ) {
+    vec3_t toCenter = vec3_sub( center, camera->position );
+    viewHeight = 2.0f * sqrtf( vec3_dot( toCenter, toCenter ) ) * tanf( camera->fovY * 0.5f );
+  }
+  float pixels = viewHeight > 0.0f ? diameter / viewHeight * viewportHeight : viewportHeight;
+
+  // Switching to a coarser level needs the object to shrink a bit past the
+  // threshold, and switching back to grow a bit past it
+  unsigned lod = 0;
+  for ( unsigned i = 0; i + 1 < obj->lodCount; ++i ) {
+    float bias = i < obj->lod ? 1.0f + LOD_HYSTERESIS : 1.0f - LOD_HYSTERESIS;
+    if ( pixels < lodThresholds[ i ] * bias )
+      lod = i + 1;
+  }
+
+  return obj->lod = lod;
+}
+
+unsigned object_triangle_count( const game_object_t *obj ) {
+  return obj->lodCount ? obj->lods[ obj->lod ].count / 3 : obj->vertex_count / 3;
+}
+
+void render_object( const game_object_t *obj ) {
+
+  if ( !obj->visible )
+    return;
+
+  PROFILE_BEGIN( "render_object" );
+  glBindVertexArray( obj->vao );
+  if ( obj->lodCount ) {
+    const object_lod_t *lod = &obj->lods[ obj->lod ];
+    size_t indexSize = obj->indexType == GL_UNSIGNED_SHORT ? 2 : 4;
+    glDrawElements( GL_TRIANGLES, lod->count, obj->indexType, (void*) ( lod->first * indexSize ) );
+  }
+  else {
+    glDrawArrays( GL_TRIANGLES, 0, obj->vertex_count );
+  }
+  glBindVertexArray( 0 );
+  PROFILE_END();
+}
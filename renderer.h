@@ -0,0 +1,100 @@
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include <glad/glad.h>
+#include "backend.h"
+#include "linmath.h"
+#include "bvh.h"
+#include "frustum.h"
+#include "ubo.h"
+#include "camera.h"
+
+#define MAX_GL_INFO_LOG 512
+#define OBJECT_MAX_LODS 4
+
+// A range of the object's index buffer
+typedef struct object_lod {
+  unsigned first;
+  unsigned count;
+} object_lod_t;
+
+typedef struct shader {
+  unsigned programId;
+} shader_t;
+
+typedef struct game_object {
+  unsigned vao;
+  unsigned vbo;
+  unsigned vertex_count;
+  // Indexed objects only, from full detail down. All levels index the same
+  // vertices.
+  unsigned ibo;
+  // GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+  unsigned indexType;
+  object_lod_t lods[ OBJECT_MAX_LODS ];
+  unsigned lodCount;
+  // Picked by select_object_lod(), render_object() draws this level
+  unsigned lod;
+  // Model space, computed by create_object()
+  aabb_t bounds;
+  // Translation into the world, kept in sync with the BVH by move_object()
+  vec3_t position;
+  // BVH leaf, or -1 when the object isn't in one
+  int proxy;
+  // Set by culling, render_object() skips invisible objects
+  int visible;
+} game_object_t;
+
+// Creates the context through the given backend and loads GL
+int r_init( const backend_t *backend, int width, int height );
+void r_resize( int width, int height );
+// The framebuffer that holds the finished frame for r_present()
+unsigned r_framebuffer();
+void r_present();
+void r_destroy();
+
+// NUL-terminated, free with mem_free()
+const char* get_file_contents( const char *path );
+unsigned compile_shader( const char *filePath, GLenum shaderType );
+shader_t* create_shader( const char *vertexShaderPath, const char *fragShaderPath );
+// Vertex shader only, its varyings captured interleaved by transform
+// feedback. Draw with GL_RASTERIZER_DISCARD enabled.
+shader_t* create_feedback_shader( const char *vertexShaderPath, const char * const *varyings, unsigned nVaryings );
+void activate_shader( const shader_t *shader );
+void destroy_shader( shader_t *shader );
+// All locations followed by all colors, which is the layout create_object()
+// uploads. out must have room for nVertices * 2 elements.
+void pack_vertices( const vec3_t *locations, const vec3_t *colors, unsigned nVertices, vec3_t *out );
+game_object_t* create_object( const vec3_t *locations, const vec3_t *colors, unsigned nVertices );
+// Simplifies the triangles into up to nLods levels, each with about half
+// the indices of the previous one. Returns all levels' indices back to back,
+// free with mem_free().
+unsigned* build_lods( const vec3_t *locations, unsigned nVertices, const unsigned *indices, unsigned nIndices,
+  unsigned nLods, object_lod_t *lods, unsigned *lodCount );
+// build_lods() and upload
+game_object_t* create_lod_object( const vec3_t *locations, const vec3_t *colors, unsigned nVertices,
+  const unsigned *indices, unsigned nIndices, unsigned nLods );
+// Takes over buffers that are already filled in, with the VAO set up to
+// draw from them
+game_object_t* create_indexed_object( unsigned vao, unsigned vbo, unsigned ibo, unsigned indexType, unsigned nVertices,
+  const object_lod_t *lods, unsigned lodCount, aabb_t bounds );
+void destroy_object( game_object_t *obj );
+aabb_t object_world_bounds( const game_object_t *obj );
+// Sets the object's position and inserts or updates its BVH leaf
+void move_object( bvh_t *bvh, game_object_t *obj, vec3_t position );
+void remove_object( bvh_t *bvh, game_object_t *obj );
+// Sets the visible flags of the objects, returns how many are visible.
+// Objects that aren't in the BVH are always visible.
+unsigned cull_objects( const bvh_t *bvh, const frustum_t *frustum, game_object_t * const *objects, unsigned nObjects );
+// Pushes the object's model matrix and parameters for this frame, returns
+// the block's offset for bind_object_block(), or -1 when it's culled
+long push_object_block( ubo_ring_t *ring, const game_object_t *obj, float lightness );
+void bind_object_block( const ubo_ring_t *ring, long offset );
+// Picks the level for the object's projected height in pixels, with some
+// hysteresis so that objects near a threshold don't flicker between levels
+unsigned select_object_lod( game_object_t *obj, const camera_t *camera, float viewportHeight );
+// Triangles render_object() draws at the current level
+unsigned object_triangle_count( const game_object_t *obj );
+void render_object( const game_object_t *obj );
+
+#endif
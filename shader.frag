@@ -2,8 +2,12 @@
 out vec4 FragColor;
 
 in vec3 color;
-uniform float lightness;
+// params.x is the lightness
+layout ( std140 ) uniform Object {
+  mat4 model;
+  vec4 params;
+};
 
 void main() {
-  FragColor = vec4( lightness * 0.5 + color * 0.5, 1.0 );
+  FragColor = vec4( params.x * 0.5 + color * 0.5, 1.0 );
 }
@@ -2,10 +2,21 @@
 layout ( location = 0 ) in vec3 aPos;
 layout ( location = 1 ) in vec3 aColor;
 
+// std140 layouts must match frame_block_t and object_block_t in ubo.h
+layout ( std140 ) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 viewProjection;
+  vec4 time;
+};
+layout ( std140 ) uniform Object {
+  mat4 model;
+  vec4 params;
+};
+
 out vec3 color;
-uniform float lightness;
 
 void main() {
-  gl_Position = vec4( aPos.x - 0.25 + lightness * 0.5, aPos.y, aPos.z, 1.0 );
+  gl_Position = viewProjection * model * vec4( aPos, 1.0 );
   color = aColor;
 }
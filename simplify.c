@@ -0,0 +1,313 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "simplify.h"
+#include "mem.h"
+
+// Keeps borders much stiffer than the surface
+#define BORDER_WEIGHT 10.0
+
+// Symmetric 4x4 matrix: xx xy xz xw yy yz yw zz zw ww
+typedef struct quadric {
+  double q[ 10 ];
+} quadric_t;
+
+typedef struct collapse {
+  unsigned from;
+  unsigned to;
+  double cost;
+} collapse_t;
+
+// Per vertex triangle lists of the current indices
+typedef struct adjacency {
+  unsigned *offsets;
+  unsigned *counts;
+  unsigned *triangles;
+} adjacency_t;
+
+static void quadric_add_plane( quadric_t *q, vec3_t n, double d, double w ) {
+
+  q->q[ 0 ] += w * n.x * n.x;
+  q->q[ 1 ] += w * n.x * n.y;
+  q->q[ 2 ] += w * n.x * n.z;
+  q->q[ 3 ] += w * n.x * d;
+  q->q[ 4 ] += w * n.y * n.y;
+  q->q[ 5 ] += w * n.y * n.z;
+  q->q[ 6 ] += w * n.y * d;
+  q->q[ 7 ] += w * n.z * n.z;
+  q->q[ 8 ] += w * n.z * d;
+  q->q[ 9 ] += w * d * d;
+}
+
+static double quadric_error( const quadric_t *a, const quadric_t *b, vec3_t p ) {
+
+  double q[ 10 ];
+  for ( int i = 0; i < 10; ++i )
+    q[ i ] = a->q[ i ] + b->q[ i ];
+
+  double x = p.x, y = p.y, z = p.z;
+  double e = q[ 0 ] * x * x + 2 * q[ 1 ] * x * y + 2 * q[ 2 ] * x * z + 2 * q[ 3 ] * x
+    + q[ 4 ] * y * y + 2 * q[ 5 ] * y * z + 2 * q[ 6 ] * y
+    + q[ 7 ] * z * z + 2 * q[ 8 ] * z + q[ 9 ];
+
+  return e > 0.0 ? e : 0.0;
+}
+
+static void build_adjacency( adjacency_t *adj, const unsigned *indices, unsigned nIndices, unsigned nVertices ) {
+
+  memset( adj->counts, 0, nVertices * sizeof( unsigned ) );
+  for ( unsigned i = 0; i < nIndices; ++i )
+    ++adj->counts[ indices[ i ] ];
+
+  unsigned offset = 0;
+  for ( unsigned v = 0; v < nVertices; ++v ) {
+    adj->offsets[ v ] = offset;
+    offset += adj->counts[ v ];
+    adj->counts[ v ] = 0;
+  }
+
+  for ( unsigned i = 0; i < nIndices; ++i ) {
+    unsigned v = indices[ i ];
+    adj->triangles[ adj->offsets[ v ] + adj->counts[ v ]++ ] = i / 3;
+  }
+}
+
+// Whether some triangle around a has the directed edge b -> a, i.e.
+// whether a -> b has a triangle on its other side
+static int has_opposite( const adjacency_t *adj, const unsigned *indices, unsigned a, unsigned b ) {
+
+  for ( unsigned i = 0; i < adj->counts[ a ]; ++i ) {
+    const unsigned *t = indices + adj->triangles[ adj->offsets[ a ] + i ] * 3;
+    for ( int e = 0; e < 3; ++e ) {
+      if ( t[ e ] == b && t[ ( e + 1 ) % 3 ] == a )
+        return 1;
+    }
+  }
+
+  return 0;
+}
+
+static vec3_t triangle_normal( vec3_t a, vec3_t b, vec3_t c ) {
+  return vec3_cross( vec3_sub( b, a ), vec3_sub( c, a ) );
+}
+
+// Moving from onto to must not flip or squash any triangle that survives
+static int collapse_keeps_orientation( const adjacency_t *adj, const unsigned *indices, const vec3_t *positions,
+  unsigned from, unsigned to ) {
+
+  for ( unsigned i = 0; i < adj->counts[ from ]; ++i ) {
+    const unsigned *t = indices + adj->triangles[ adj->offsets[ from ] + i ] * 3;
+    if ( t[ 0 ] == to || t[ 1 ] == to || t[ 2 ] == to )
+      continue;
+
+    vec3_t p[ 3 ], q[ 3 ];
+    for ( int k = 0; k < 3; ++k ) {
+      p[ k ] = positions[ t[ k ] ];
+      q[ k ] = positions[ t[ k ] == from ? to : t[ k ] ];
+    }
+
+    vec3_t before = triangle_normal( p[ 0 ], p[ 1 ], p[ 2 ] );
+    vec3_t after = triangle_normal( q[ 0 ], q[ 1 ], q[ 2 ] );
+    // Also rejects triangles that would end up (nearly) degenerate
+    if ( vec3_dot( before, after ) <= 0.25f * sqrtf( vec3_dot( before, before ) * vec3_dot( after, after ) ) )
+      return 0;
+  }
+
+  return 1;
+}
+
+static int compare_collapses( const void *a, const void *b ) {
+
+  double x = ( (const collapse_t*) a )->cost;
+  double y = ( (const collapse_t*) b )->cost;
+
+  return ( x > y ) - ( x < y );
+}
+
+// Partitions the collapses so that the k cheapest come first, in any order
+static void select_cheapest( collapse_t *collapses, unsigned n, unsigned k ) {
+
+  int lo = 0, hi = (int) n - 1;
+  while ( lo < hi ) {
+    double pivot = collapses[ lo + ( hi - lo ) / 2 ].cost;
+    int i = lo, j = hi;
+    while ( i <= j ) {
+      while ( collapses[ i ].cost < pivot )
+        ++i;
+      while ( collapses[ j ].cost > pivot )
+        --j;
+      if ( i <= j ) {
+        collapse_t t = collapses[ i ];
+        collapses[ i++ ] = collapses[ j ];
+        collapses[ j-- ] = t;
+      }
+    }
+    if ( (int) k <= j )
+      hi = j;
+    else if ( (int) k >= i )
+      lo = i;
+    else
+      return;
+  }
+}
+
+unsigned simplify_mesh( unsigned *out, const unsigned *indices, unsigned nIndices,
+  const vec3_t *positions, unsigned nVertices, unsigned targetIndices, float *error ) {
+
+  memcpy( out, indices, nIndices * sizeof( unsigned ) );
+  if ( error )
+    *error = 0.0f;
+
+  quadric_t *quadrics = mem_calloc( MEM_SCRATCH, nVertices, sizeof( quadric_t ) );
+  adjacency_t adj = {
+    mem_alloc( MEM_SCRATCH, nVertices * sizeof( unsigned ) ),
+    mem_alloc( MEM_SCRATCH, nVertices * sizeof( unsigned ) ),
+    mem_alloc( MEM_SCRATCH, nIndices * sizeof( unsigned ) )
+  };
+  unsigned char *border = mem_alloc( MEM_SCRATCH, nVertices );
+  unsigned char *locked = mem_alloc( MEM_SCRATCH, nVertices );
+  // Every edge both ways
+  collapse_t *collapses = mem_alloc( MEM_SCRATCH, nIndices * 2 * sizeof( collapse_t ) );
+
+  if ( !quadrics || !adj.offsets || !adj.counts || !adj.triangles || !border || !locked || !collapses ) {
+    mem_free( quadrics );
+    mem_free( adj.offsets );
+    mem_free( adj.counts );
+    mem_free( adj.triangles );
+    mem_free( border );
+    mem_free( locked );
+    mem_free( collapses );
+    return nIndices;
+  }
+
+  // Errors are relative to the mesh's extent, so that scale doesn't matter
+  aabb_t bounds = { positions[ 0 ], positions[ 0 ] };
+  for ( unsigned v = 1; v < nVertices; ++v ) {
+    bounds.min = vec3_min( bounds.min, positions[ v ] );
+    bounds.max = vec3_max( bounds.max, positions[ v ] );
+  }
+  vec3_t size = vec3_sub( bounds.max, bounds.min );
+  double extent = fmax( fmax( size.x, size.y ), fmax( size.z, 1e-6 ) );
+
+  // Each vertex starts with the planes of its triangles, area weighted
+  build_adjacency( &adj, out, nIndices, nVertices );
+  for ( unsigned i = 0; i < nIndices; i += 3 ) {
+    vec3_t p0 = positions[ out[ i ] ], p1 = positions[ out[ i + 1 ] ], p2 = positions[ out[ i + 2 ] ];
+    vec3_t n = triangle_normal( p0, p1, p2 );
+    float area = sqrtf( vec3_dot( n, n ) );
+    if ( area <= 0.0f )
+      continue;
+    n = vec3_scale( n, 1.0f / area );
+    double d = -vec3_dot( n, p0 );
+
+    for ( int e = 0; e < 3; ++e ) {
+      unsigned a = out[ i + e ], b = out[ i + ( e + 1 ) % 3 ];
+      quadric_add_plane( &quadrics[ a ], n, d, area * 0.5 );
+
+      // Open edges get a plane through them, perpendicular to the triangle
+      if ( !has_opposite( &adj, out, a, b ) ) {
+        vec3_t edge = vec3_sub( positions[ b ], positions[ a ] );
+        vec3_t m = vec3_cross( edge, n );
+        float length = sqrtf( vec3_dot( m, m ) );
+        if ( length <= 0.0f )
+          continue;
+        m = vec3_scale( m, 1.0f / length );
+        double md = -vec3_dot( m, positions[ a ] );
+        quadric_add_plane( &quadrics[ a ], m, md, BORDER_WEIGHT * length * length );
+        quadric_add_plane( &quadrics[ b ], m, md, BORDER_WEIGHT * length * length );
+      }
+    }
+  }
+
+  double maxCost = 0.0;
+
+  while ( nIndices > targetIndices ) {
+    build_adjacency( &adj, out, nIndices, nVertices );
+
+    memset( border, 0, nVertices );
+    for ( unsigned i = 0; i < nIndices; ++i ) {
+      unsigned a = out[ i ], b = out[ i - i % 3 + ( i + 1 ) % 3 ];
+      if ( !has_opposite( &adj, out, a, b ) )
+        border[ a ] = border[ b ] = 1;
+    }
+
+    // Both directions of every edge, interior edges only from the triangle
+    // where a < b. Border vertices may only slide along the border,
+    // interior ones may go anywhere.
+    unsigned nCollapses = 0;
+    for ( unsigned i = 0; i < nIndices; ++i ) {
+      unsigned a = out[ i ], b = out[ i - i % 3 + ( i + 1 ) % 3 ];
+      int interior = has_opposite( &adj, out, a, b );
+      if ( interior && a > b )
+        continue;
+      for ( int dir = 0; dir < 2; ++dir ) {
+        unsigned from = dir ? b : a, to = dir ? a : b;
+        if ( border[ from ] && ( !border[ to ] || interior ) )
+          continue;
+        collapses[ nCollapses++ ] = (collapse_t) { from, to, quadric_error( &quadrics[ from ], &quadrics[ to ], positions[ to ] ) };
+      }
+    }
+
+    // Locking leaves room for only a fraction of the candidates per pass,
+    // so only the cheapest ones are worth sorting
+    if ( nCollapses > 64 ) {
+      select_cheapest( collapses, nCollapses, nCollapses / 4 );
+      nCollapses /= 4;
+    }
+    qsort( collapses, nCollapses, sizeof( collapse_t ), compare_collapses );
+    memset( locked, 0, nVertices );
+
+    unsigned triangles = nIndices / 3, target = targetIndices / 3, done = 0;
+    for ( unsigned c = 0; c < nCollapses && triangles > target; ++c ) {
+      unsigned from = collapses[ c ].from, to = collapses[ c ].to;
+      if ( locked[ from ] || locked[ to ] || !collapse_keeps_orientation( &adj, out, positions, from, to ) )
+        continue;
+
+      // Lock the neighbourhood, the adjacency is stale for it until the
+      // next pass
+      for ( unsigned t = 0; t < adj.counts[ from ]; ++t ) {
+        const unsigned *tri = out + adj.triangles[ adj.offsets[ from ] + t ] * 3;
+        triangles -= tri[ 0 ] == to || tri[ 1 ] == to || tri[ 2 ] == to;
+        locked[ tri[ 0 ] ] = locked[ tri[ 1 ] ] = locked[ tri[ 2 ] ] = 1;
+      }
+      for ( int k = 0; k < 10; ++k )
+        quadrics[ to ].q[ k ] += quadrics[ from ].q[ k ];
+      collapses[ done++ ] = collapses[ c ];
+      maxCost = collapses[ c ].cost > maxCost ? collapses[ c ].cost : maxCost;
+    }
+
+    if ( !done )
+      break;
+
+    // Remap and drop the triangles that collapsed
+    unsigned *remap = adj.offsets;
+    for ( unsigned v = 0; v < nVertices; ++v )
+      remap[ v ] = v;
+    for ( unsigned c = 0; c < done; ++c )
+      remap[ collapses[ c ].from ] = collapses[ c ].to;
+
+    unsigned n = 0;
+    for ( unsigned i = 0; i < nIndices; i += 3 ) {
+      unsigned a = remap[ out[ i ] ], b = remap[ out[ i + 1 ] ], c = remap[ out[ i + 2 ] ];
+      if ( a == b || b == c || a == c )
+        continue;
+      out[ n++ ] = a;
+      out[ n++ ] = b;
+      out[ n++ ] = c;
+    }
+    nIndices = n;
+  }
+
+  if ( error )
+    *error = (float) ( sqrt( maxCost ) / extent );
+
+  mem_free( quadrics );
+  mem_free( adj.offsets );
+  mem_free( adj.counts );
+  mem_free( adj.triangles );
+  mem_free( border );
+  mem_free( locked );
+  mem_free( collapses );
+
+  return nIndices;
+}
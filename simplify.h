@@ -0,0 +1,22 @@
+#ifndef SIMPLIFY_H
+#define SIMPLIFY_H
+
+#include "linmath.h"
+
+/*
+ * Triangle mesh simplification for levels of detail. Edges are collapsed
+ * cheapest first by quadric error (Garland & Heckbert), but as half-edge
+ * collapses: a vertex merges into one of its neighbours and nothing moves.
+ * Every level therefore indexes the same vertex buffer and only needs its
+ * own indices. Open borders stay where they are, and collapses that would
+ * flip a triangle are skipped.
+ */
+
+// Writes at most nIndices indices to out (which may not alias indices) and
+// returns how many, stopping at targetIndices or when no collapse is left.
+// error, if given, receives the largest collapse error relative to the
+// mesh's size.
+unsigned simplify_mesh( unsigned *out, const unsigned *indices, unsigned nIndices,
+  const vec3_t *positions, unsigned nVertices, unsigned targetIndices, float *error );
+
+#endif
@@ -0,0 +1,10 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 uv;
+in vec4 color;
+uniform sampler2D sprite;
+
+void main() {
+  FragColor = texture( sprite, uv ) * color;
+}
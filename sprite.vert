@@ -0,0 +1,21 @@
+#version 330 core
+layout ( location = 0 ) in vec2 aPos;
+layout ( location = 1 ) in vec2 aUv;
+layout ( location = 2 ) in vec4 aColor;
+
+// std140 layout must match frame_block_t in ubo.h
+layout ( std140 ) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 viewProjection;
+  vec4 time;
+};
+
+out vec2 uv;
+out vec4 color;
+
+void main() {
+  gl_Position = viewProjection * vec4( aPos, 0.0, 1.0 );
+  uv = aUv;
+  color = aColor;
+}
@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "sprite_batch.h"
+#include "gpu_mem.h"
+#include "jobs.h"
+#include "mem.h"
+#include "profiler.h"
+
+// Quads expanded per job
+#define SPRITE_JOB_GRAIN 4096
+
+typedef struct sprite_vertex {
+  float x;
+  float y;
+  float u;
+  float v;
+  color_t color;
+} sprite_vertex_t;
+
+int sprite_batch_init( sprite_batch_t *batch, unsigned capacity ) {
+
+  memset( batch, 0, sizeof( sprite_batch_t ) );
+  batch->capacity = capacity;
+
+  batch->shader = create_shader( "sprite.vert", "sprite.frag" );
+  if ( !batch->shader )
+    return 0;
+
+  batch->sprites = mem_alloc( MEM_RENDERER, capacity * sizeof( sprite_t ) );
+  batch->keys = mem_alloc( MEM_RENDERER, capacity * sizeof( uint64_t ) );
+  batch->sortScratch = mem_alloc( MEM_RENDERER, capacity * sizeof( uint64_t ) );
+  unsigned *indices = mem_alloc( MEM_SCRATCH, capacity * 6 * sizeof( unsigned ) );
+
+  if ( !batch->sprites || !batch->keys || !batch->sortScratch || !indices ) {
+    fprintf( stderr, "Out of memory for %u sprites\n", capacity );
+    mem_free( indices );
+    return 0;
+  }
+
+  // Indices never change, only the vertices stream
+  for ( unsigned i = 0; i < capacity; ++i ) {
+    unsigned *quad = indices + i * 6;
+    quad[ 0 ] = i * 4;
+    quad[ 1 ] = i * 4 + 1;
+    quad[ 2 ] = i * 4 + 2;
+    quad[ 3 ] = i * 4 + 2;
+    quad[ 4 ] = i * 4 + 3;
+    quad[ 5 ] = i * 4;
+  }
+
+  glGenVertexArrays( 1, &batch->vao );
+  glBindVertexArray( batch->vao );
+
+  size_t vertexBytes = (size_t) capacity * 4 * sizeof( sprite_vertex_t ) * SPRITE_BATCH_FRAMES;
+  glGenBuffers( 1, &batch->vbo );
+  glBindBuffer( GL_ARRAY_BUFFER, batch->vbo );
+  glBufferData( GL_ARRAY_BUFFER, vertexBytes, NULL, GL_STREAM_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, batch->vbo, vertexBytes, GL_STREAM_DRAW, "sprites" );
+
+  size_t indexBytes = (size_t) capacity * 6 * sizeof( unsigned );
+  glGenBuffers( 1, &batch->ibo );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, batch->ibo );
+  glBufferData( GL_ELEMENT_ARRAY_BUFFER, indexBytes, indices, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, batch->ibo, indexBytes, GL_STATIC_DRAW, "sprites" );
+  mem_free( indices );
+
+  glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, sizeof( sprite_vertex_t ), (void*) offsetof( sprite_vertex_t, x ) );
+  glEnableVertexAttribArray( 0 );
+  glVertexAttribPointer( 1, 2, GL_FLOAT, GL_FALSE, sizeof( sprite_vertex_t ), (void*) offsetof( sprite_vertex_t, u ) );
+  glEnableVertexAttribArray( 1 );
+  glVertexAttribPointer( 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof( sprite_vertex_t ), (void*) offsetof( sprite_vertex_t, color ) );
+  glEnableVertexAttribArray( 2 );
+
+  // The element buffer binding is part of the VAO, so unbind that first
+  glBindVertexArray( 0 );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+  return 1;
+}
+
+void sprite_batch_destroy( sprite_batch_t *batch ) {
+
+  for ( unsigned i = 0; i < SPRITE_BATCH_FRAMES; ++i ) {
+    if ( batch->fences[ i ] )
+      glDeleteSync( batch->fences[ i ] );
+  }
+
+  glDeleteVertexArrays( 1, &batch->vao );
+  glDeleteBuffers( 1, &batch->vbo );
+  gpu_mem_release( GPU_MEM_BUFFER, batch->vbo );
+  glDeleteBuffers( 1, &batch->ibo );
+  gpu_mem_release( GPU_MEM_BUFFER, batch->ibo );
+  destroy_shader( batch->shader );
+  mem_free( batch->sprites );
+  mem_free( batch->keys );
+  mem_free( batch->sortScratch );
+  memset( batch, 0, sizeof( sprite_batch_t ) );
+}
+
+void sprite_batch_begin( sprite_batch_t *batch ) {
+
+  batch->count = 0;
+  batch->layer = 0;
+  batch->textureCount = 0;
+}
+
+void sprite_batch_set_layer( sprite_batch_t *batch, int layer ) {
+  batch->layer = layer;
+}
+
+// Batches rarely hold more than a handful of textures, and consecutive
+// sprites mostly share one
+static int texture_slot( sprite_batch_t *batch, const texture_t *texture ) {
+
+  for ( int i = (int) batch->textureCount - 1; i >= 0; --i ) {
+    if ( batch->textures[ i ] == texture )
+      return i;
+  }
+
+  if ( batch->textureCount == SPRITE_BATCH_MAX_TEXTURES )
+    return -1;
+
+  batch->textures[ batch->textureCount ] = texture;
+
+  return (int) batch->textureCount++;
+}
+
+void sprite_batch_draw_uv( sprite_batch_t *batch, const texture_t *texture, sprite_rect_t rect, float rotation, color_t color,
+  float u0, float v0, float u1, float v1 ) {
+
+  int slot = batch->count < batch->capacity ? texture_slot( batch, texture ) : -1;
+
+  if ( slot < 0 ) {
+    ++batch->dropped;
+    return;
+  }
+
+  unsigned index = batch->count++;
+  sprite_t *sprite = &batch->sprites[ index ];
+  sprite->rect = rect;
+  sprite->rotation = rotation;
+  sprite->u0 = u0;
+  sprite->v0 = v0;
+  sprite->u1 = u1;
+  sprite->v1 = v1;
+  sprite->color = color;
+
+  // Layers are biased so that negative ones sort first
+  uint64_t layer = (uint16_t) ( batch->layer + 32768 );
+  batch->keys[ index ] = layer << 48 | (uint64_t) slot << 32 | index;
+}
+
+void sprite_batch_draw( sprite_batch_t *batch, const texture_t *texture, sprite_rect_t rect, float rotation, color_t color ) {
+  sprite_batch_draw_uv( batch, texture, rect, rotation, color, 0.0f, 0.0f, 1.0f, 1.0f );
+}
+
+void sprite_batch_draw_region( sprite_batch_t *batch, const atlas_region_t *region, sprite_rect_t rect, float rotation, color_t color ) {
+  sprite_batch_draw_uv( batch, region->page, rect, rotation, color, region->u0, region->v0, region->u1, region->v1 );
+}
+
+// Stable LSD radix sort on the layer and texture bytes. The index bytes
+// are already in order, so they never need a pass.
+static void sort_keys( sprite_batch_t *batch ) {
+
+  uint64_t *src = batch->keys;
+  uint64_t *dst = batch->sortScratch;
+  unsigned n = batch->count;
+
+  for ( unsigned shift = 32; shift < 64; shift += 8 ) {
+    unsigned counts[ 256 ] = { 0 };
+
+    for ( unsigned i = 0; i < n; ++i )
+      ++counts[ ( src[ i ] >> shift ) & 0xff ];
+
+    // Every key has the same byte here, nothing to do
+    if ( counts[ ( src[ 0 ] >> shift ) & 0xff ] == n )
+      continue;
+
+    unsigned offset = 0;
+    for ( unsigned b = 0; b < 256; ++b ) {
+      unsigned c = counts[ b ];
+      counts[ b ] = offset;
+      offset += c;
+    }
+
+    for ( unsigned i = 0; i < n; ++i )
+      dst[ counts[ ( src[ i ] >> shift ) & 0xff ]++ ] = src[ i ];
+
+    uint64_t *t = src;
+    src = dst;
+    dst = t;
+  }
+
+  batch->keys = src;
+  batch->sortScratch = dst;
+}
+
+typedef struct expand_job {
+  const sprite_batch_t *batch;
+  sprite_vertex_t *vertices;
+} expand_job_t;
+
+static void expand_quads( void *ctx, unsigned begin, unsigned end ) {
+
+  const expand_job_t *job = ctx;
+  const sprite_batch_t *batch = job->batch;
+
+  for ( unsigned i = begin; i < end; ++i ) {
+    const sprite_t *s = &batch->sprites[ (uint32_t) batch->keys[ i ] ];
+    sprite_vertex_t *v = job->vertices + i * 4;
+    float hw = s->rect.w * 0.5f;
+    float hh = s->rect.h * 0.5f;
+    float cx = s->rect.x + hw;
+    float cy = s->rect.y + hh;
+    float c = 1.0f;
+    float sn = 0.0f;
+
+    if ( s->rotation != 0.0f ) {
+      c = cosf( s->rotation );
+      sn = sinf( s->rotation );
+    }
+
+    // Rotated half extents along both axes of the quad
+    float ax = hw * c, ay = hw * sn;
+    float bx = -hh * sn, by = hh * c;
+
+    // Top-left, bottom-left, bottom-right, top-right
+    v[ 0 ] = (sprite_vertex_t) { cx - ax + bx, cy - ay + by, s->u0, s->v0, s->color };
+    v[ 1 ] = (sprite_vertex_t) { cx - ax - bx, cy - ay - by, s->u0, s->v1, s->color };
+    v[ 2 ] = (sprite_vertex_t) { cx + ax - bx, cy + ay - by, s->u1, s->v1, s->color };
+    v[ 3 ] = (sprite_vertex_t) { cx + ax + bx, cy + ay + by, s->u1, s->v0, s->color };
+  }
+}
+
+void sprite_batch_end( sprite_batch_t *batch ) {
+
+  batch->lastSprites = batch->count;
+  batch->lastDraws = 0;
+  batch->lastTextures = batch->textureCount;
+
+  if ( !batch->count )
+    return;
+
+  PROFILE_BEGIN( "sprite_batch_end" );
+
+  PROFILE_BEGIN( "sort" );
+  sort_keys( batch );
+  PROFILE_END();
+
+  batch->region = ( batch->region + 1 ) % SPRITE_BATCH_FRAMES;
+  GLsync fence = batch->fences[ batch->region ];
+  if ( fence ) {
+    glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+    glDeleteSync( fence );
+    batch->fences[ batch->region ] = 0;
+  }
+
+  // Written straight into the buffer, unsynchronized since the fence above
+  // already guarantees the GPU is done with this region
+  size_t regionBytes = (size_t) batch->capacity * 4 * sizeof( sprite_vertex_t );
+  size_t bytes = (size_t) batch->count * 4 * sizeof( sprite_vertex_t );
+  glBindBuffer( GL_ARRAY_BUFFER, batch->vbo );
+  sprite_vertex_t *vertices = glMapBufferRange( GL_ARRAY_BUFFER, batch->region * regionBytes, bytes,
+    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+
+  if ( !vertices ) {
+    fprintf( stderr, "Could not map the sprite buffer\n" );
+    glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    PROFILE_END();
+    return;
+  }
+
+  PROFILE_BEGIN( "expand" );
+  expand_job_t job = { batch, vertices };
+  jobs_parallel_for( batch->count, SPRITE_JOB_GRAIN, expand_quads, &job );
+  PROFILE_END();
+
+  glUnmapBuffer( GL_ARRAY_BUFFER );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  activate_shader( batch->shader );
+  glBindVertexArray( batch->vao );
+  glEnable( GL_BLEND );
+  glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+  glActiveTexture( GL_TEXTURE0 );
+
+  int baseVertex = (int) ( batch->region * batch->capacity * 4 );
+  unsigned runStart = 0;
+
+  // One draw per run of sprites with the same texture, which may span layers
+  while ( runStart < batch->count ) {
+    unsigned slot = ( batch->keys[ runStart ] >> 32 ) & 0xffff;
+    unsigned runEnd = runStart + 1;
+
+    while ( runEnd < batch->count && ( ( batch->keys[ runEnd ] >> 32 ) & 0xffff ) == slot )
+      ++runEnd;
+
+    glBindTexture( GL_TEXTURE_2D, batch->textures[ slot ]->id );
+    glDrawElementsBaseVertex( GL_TRIANGLES, ( runEnd - runStart ) * 6, GL_UNSIGNED_INT,
+      (void*) ( (size_t) runStart * 6 * sizeof( unsigned ) ), baseVertex );
+    ++batch->lastDraws;
+    runStart = runEnd;
+  }
+
+  glDisable( GL_BLEND );
+  glBindVertexArray( 0 );
+  glBindTexture( GL_TEXTURE_2D, 0 );
+
+  batch->fences[ batch->region ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+
+  PROFILE_END();
+}
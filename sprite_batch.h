@@ -0,0 +1,91 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include <stdint.h>
+#include <glad/glad.h>
+#include "texture.h"
+#include "atlas.h"
+#include "renderer.h"
+
+/*
+ * Batches textured quads. Sprites are collected between begin() and end(),
+ * sorted by layer and then texture (stable, so that sprites on the same
+ * layer keep their order), expanded into quads by the job threads straight
+ * into a streaming vertex buffer, and drawn with one indexed draw per run of
+ * the same texture. Positions are in world units, seen through the camera in
+ * the Frame uniform block.
+ */
+// Every end() streams into the next part of the vertex buffer, which is
+// fenced so that the GPU can still be reading the previous ones
+#define SPRITE_BATCH_FRAMES 3
+// Distinct textures per batch
+#define SPRITE_BATCH_MAX_TEXTURES 256
+
+typedef struct color {
+  unsigned char r;
+  unsigned char g;
+  unsigned char b;
+  unsigned char a;
+} color_t;
+
+#define COLOR_WHITE ( (color_t) { 255, 255, 255, 255 } )
+
+// Bottom-left corner and size
+typedef struct sprite_rect {
+  float x;
+  float y;
+  float w;
+  float h;
+} sprite_rect_t;
+
+typedef struct sprite {
+  sprite_rect_t rect;
+  float rotation;
+  // Texture coordinates of the top-left and bottom-right corners
+  float u0, v0, u1, v1;
+  color_t color;
+} sprite_t;
+
+typedef struct sprite_batch {
+  shader_t *shader;
+  unsigned vao;
+  unsigned vbo;
+  unsigned ibo;
+  // Sprites per end()
+  unsigned capacity;
+
+  sprite_t *sprites;
+  // Layer and texture in the high half, sprite index in the low half
+  uint64_t *keys;
+  uint64_t *sortScratch;
+  unsigned count;
+  int layer;
+  const texture_t *textures[ SPRITE_BATCH_MAX_TEXTURES ];
+  unsigned textureCount;
+
+  unsigned region;
+  GLsync fences[ SPRITE_BATCH_FRAMES ];
+
+  // Of the last end()
+  unsigned lastSprites;
+  unsigned lastDraws;
+  unsigned lastTextures;
+  // Sprites that didn't fit, over the batch's lifetime
+  unsigned long long dropped;
+} sprite_batch_t;
+
+int sprite_batch_init( sprite_batch_t *batch, unsigned capacity );
+void sprite_batch_destroy( sprite_batch_t *batch );
+void sprite_batch_begin( sprite_batch_t *batch );
+// Sprites on higher layers are drawn on top, the default layer is 0
+void sprite_batch_set_layer( sprite_batch_t *batch, int layer );
+// Rotation is in radians, counter-clockwise around the rect's center
+void sprite_batch_draw( sprite_batch_t *batch, const texture_t *texture, sprite_rect_t rect, float rotation, color_t color );
+// Like sprite_batch_draw(), but only samples part of the texture
+void sprite_batch_draw_uv( sprite_batch_t *batch, const texture_t *texture, sprite_rect_t rect, float rotation, color_t color,
+  float u0, float v0, float u1, float v1 );
+// Draws an atlas region, which batches with everything else on its page
+void sprite_batch_draw_region( sprite_batch_t *batch, const atlas_region_t *region, sprite_rect_t rect, float rotation, color_t color );
+void sprite_batch_end( sprite_batch_t *batch );
+
+#endif
@@ -0,0 +1,60 @@
+#include <stdio.h>
+#include <glad/glad.h>
+#include "texture.h"
+#include "image.h"
+#include "gpu_mem.h"
+#include "mem.h"
+
+texture_t* create_texture( const unsigned char *pixels, int width, int height ) {
+
+  unsigned id;
+  glGenTextures( 1, &id );
+  glBindTexture( GL_TEXTURE_2D, id );
+  glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+  // Row 0 ends up at t = 0, so sprites map the top of their quad to v = 0
+  glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+  glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+  glGenerateMipmap( GL_TEXTURE_2D );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+  glBindTexture( GL_TEXTURE_2D, 0 );
+
+  // Mipmaps add a third
+  gpu_mem_track( GPU_MEM_TEXTURE, id, (size_t) width * height * 4 * 4 / 3, GL_STATIC_DRAW, "textures" );
+
+  texture_t *texture = mem_alloc( MEM_RENDERER, sizeof( texture_t ) );
+  if ( !texture )
+    return NULL;
+
+  texture->id = id;
+  texture->width = width;
+  texture->height = height;
+
+  return texture;
+}
+
+texture_t* load_texture( const char *path ) {
+
+  int width, height;
+  unsigned char *pixels = image_read_png( path, &width, &height );
+
+  if ( !pixels )
+    return NULL;
+
+  texture_t *texture = create_texture( pixels, width, height );
+  mem_free( pixels );
+
+  return texture;
+}
+
+void destroy_texture( texture_t *texture ) {
+
+  if ( !texture )
+    return;
+
+  glDeleteTextures( 1, &texture->id );
+  gpu_mem_release( GPU_MEM_TEXTURE, texture->id );
+  mem_free( texture );
+}
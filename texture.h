@@ -0,0 +1,15 @@
+#ifndef TEXTURE_H
+#define TEXTURE_H
+
+typedef struct texture {
+  unsigned id;
+  int width;
+  int height;
+} texture_t;
+
+// RGBA8 with mipmaps, from tightly packed pixels with the top row first
+texture_t* create_texture( const unsigned char *pixels, int width, int height );
+texture_t* load_texture( const char *path );
+void destroy_texture( texture_t *texture );
+
+#endif
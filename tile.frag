@@ -0,0 +1,9 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec3 uvLayer;
+uniform sampler2DArray tiles;
+
+void main() {
+  FragColor = texture( tiles, uvLayer );
+}
@@ -0,0 +1,22 @@
+#version 330 core
+layout ( location = 0 ) in vec2 aPos;
+layout ( location = 1 ) in vec3 aUvLayer;
+
+// std140 layouts must match frame_block_t and object_block_t in ubo.h
+layout ( std140 ) uniform Frame {
+  mat4 view;
+  mat4 projection;
+  mat4 viewProjection;
+  vec4 time;
+};
+layout ( std140 ) uniform Object {
+  mat4 model;
+  vec4 params;
+};
+
+out vec3 uvLayer;
+
+void main() {
+  gl_Position = viewProjection * model * vec4( aPos, 0.0, 1.0 );
+  uvLayer = aUvLayer;
+}
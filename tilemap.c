@@ -0,0 +1,391 @@
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <glad/glad.h>
+#include "tilemap.h"
+#include "gpu_mem.h"
+#include "mem.h"
+#include "profiler.h"
+
+#define TILESET_SIZE 16
+#define CHUNK_QUADS ( TILEMAP_CHUNK * TILEMAP_CHUNK )
+
+// Four per tile, indexed with 16 bits, which is why chunks are at most 128
+// tiles across
+typedef struct tile_vertex {
+  uint16_t x;
+  uint16_t y;
+  uint8_t u;
+  uint8_t v;
+  uint8_t layer;
+  uint8_t pad;
+} tile_vertex_t;
+
+static uint32_t hash2( int x, int y ) {
+
+  uint32_t h = (uint32_t) x * 374761393u + (uint32_t) y * 668265263u;
+  h = ( h ^ ( h >> 13 ) ) * 1274126177u;
+
+  return h ^ ( h >> 16 );
+}
+
+// Smooth value noise in 0..1, with lattice points every scale tiles
+static float value_noise( int x, int y, int scale ) {
+
+  int x0 = x / scale, y0 = y / scale;
+  float fx = ( x % scale ) / (float) scale, fy = ( y % scale ) / (float) scale;
+  fx = fx * fx * ( 3.0f - 2.0f * fx );
+  fy = fy * fy * ( 3.0f - 2.0f * fy );
+
+  float a = ( hash2( x0, y0 ) & 0xffff ) / 65535.0f;
+  float b = ( hash2( x0 + 1, y0 ) & 0xffff ) / 65535.0f;
+  float c = ( hash2( x0, y0 + 1 ) & 0xffff ) / 65535.0f;
+  float d = ( hash2( x0 + 1, y0 + 1 ) & 0xffff ) / 65535.0f;
+
+  return ( a + ( b - a ) * fx ) + ( ( c + ( d - c ) * fx ) - ( a + ( b - a ) * fx ) ) * fy;
+}
+
+static void generate_tiles( tilemap_t *map ) {
+
+  for ( int y = 0; y < map->height; ++y ) {
+    for ( int x = 0; x < map->width; ++x ) {
+      float n = value_noise( x, y, 48 ) * 0.7f + value_noise( x, y, 12 ) * 0.3f;
+      int tile = n < 0.3f ? TILE_WATER : n < 0.36f ? TILE_SAND : TILE_GRASS;
+      map->tiles[ (size_t) y * map->width + x ] = (uint8_t) tile;
+    }
+  }
+}
+
+// A noisy flat colour per tile type, as layers of an array texture so
+// that neighbouring tiles can never bleed into each other
+static unsigned create_tileset() {
+
+  static const uint8_t colors[ TILE_TYPES ][ 3 ] = {
+    { 70, 120, 40 },
+    { 110, 80, 50 },
+    { 200, 180, 120 },
+    { 40, 80, 160 },
+  };
+  static uint8_t pixels[ TILE_TYPES ][ TILESET_SIZE ][ TILESET_SIZE ][ 4 ];
+
+  for ( int t = 0; t < TILE_TYPES; ++t ) {
+    for ( int y = 0; y < TILESET_SIZE; ++y ) {
+      for ( int x = 0; x < TILESET_SIZE; ++x ) {
+        int n = (int) ( hash2( x + t * 97, y ) & 31 ) - 16;
+        for ( int c = 0; c < 3; ++c ) {
+          int v = colors[ t ][ c ] + n;
+          pixels[ t ][ y ][ x ][ c ] = (uint8_t) ( v < 0 ? 0 : v > 255 ? 255 : v );
+        }
+        pixels[ t ][ y ][ x ][ 3 ] = 255;
+      }
+    }
+  }
+
+  unsigned texture;
+  glGenTextures( 1, &texture );
+  glBindTexture( GL_TEXTURE_2D_ARRAY, texture );
+  glTexImage3D( GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, TILESET_SIZE, TILESET_SIZE, TILE_TYPES, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+  glGenerateMipmap( GL_TEXTURE_2D_ARRAY );
+  glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+  glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+  glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT );
+  glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT );
+  glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+  gpu_mem_track( GPU_MEM_TEXTURE, texture, sizeof( pixels ) * 4 / 3, GL_STATIC_DRAW, "tilemap" );
+
+  return texture;
+}
+
+int tilemap_init( tilemap_t *map, int width, int height, float tileSize ) {
+
+  memset( map, 0, sizeof( tilemap_t ) );
+  map->width = width;
+  map->height = height;
+  map->chunksX = ( width + TILEMAP_CHUNK - 1 ) / TILEMAP_CHUNK;
+  map->chunksY = ( height + TILEMAP_CHUNK - 1 ) / TILEMAP_CHUNK;
+  map->tileSize = tileSize;
+  // Centered on the world origin
+  map->origin = (vec3_t) { -width * tileSize * 0.5f, -height * tileSize * 0.5f, 0.0f };
+
+  size_t chunks = (size_t) map->chunksX * map->chunksY;
+  map->tiles = mem_alloc( MEM_SIM, (size_t) width * height );
+  map->chunkSlots = mem_alloc( MEM_RENDERER, chunks * sizeof( int16_t ) );
+  map->dirty = mem_calloc( MEM_RENDERER, chunks, 1 );
+  map->bakeScratch = mem_alloc( MEM_RENDERER, CHUNK_QUADS * 4 * sizeof( tile_vertex_t ) );
+  uint16_t *indices = mem_alloc( MEM_SCRATCH, CHUNK_QUADS * 6 * sizeof( uint16_t ) );
+
+  if ( !map->tiles || !map->chunkSlots || !map->dirty || !map->bakeScratch || !indices ) {
+    fprintf( stderr, "Out of memory for a %dx%d tile map\n", width, height );
+    mem_free( indices );
+    return 0;
+  }
+
+  map->shader = create_shader( "tile.vert", "tile.frag" );
+  if ( !map->shader ) {
+    mem_free( indices );
+    return 0;
+  }
+
+  for ( size_t i = 0; i < chunks; ++i )
+    map->chunkSlots[ i ] = TILEMAP_NO_SLOT;
+  for ( int i = 0; i < TILEMAP_RESIDENT; ++i )
+    map->slots[ i ].chunk = TILEMAP_NO_SLOT;
+
+  generate_tiles( map );
+  map->tileset = create_tileset();
+
+  // Every chunk uses the same quad topology
+  for ( unsigned i = 0; i < CHUNK_QUADS; ++i ) {
+    uint16_t *quad = indices + i * 6;
+    quad[ 0 ] = (uint16_t) ( i * 4 );
+    quad[ 1 ] = (uint16_t) ( i * 4 + 1 );
+    quad[ 2 ] = (uint16_t) ( i * 4 + 2 );
+    quad[ 3 ] = (uint16_t) ( i * 4 + 2 );
+    quad[ 4 ] = (uint16_t) ( i * 4 + 3 );
+    quad[ 5 ] = (uint16_t) ( i * 4 );
+  }
+
+  glGenBuffers( 1, &map->ibo );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, map->ibo );
+  glBufferData( GL_ELEMENT_ARRAY_BUFFER, CHUNK_QUADS * 6 * sizeof( uint16_t ), indices, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, map->ibo, CHUNK_QUADS * 6 * sizeof( uint16_t ), GL_STATIC_DRAW, "tilemap" );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+  mem_free( indices );
+
+  return 1;
+}
+
+void tilemap_destroy( tilemap_t *map ) {
+
+  for ( int i = 0; i < TILEMAP_RESIDENT; ++i ) {
+    if ( !map->slots[ i ].vbo )
+      continue;
+    glDeleteVertexArrays( 1, &map->slots[ i ].vao );
+    glDeleteBuffers( 1, &map->slots[ i ].vbo );
+    gpu_mem_release( GPU_MEM_BUFFER, map->slots[ i ].vbo );
+  }
+
+  glDeleteBuffers( 1, &map->ibo );
+  gpu_mem_release( GPU_MEM_BUFFER, map->ibo );
+  glDeleteTextures( 1, &map->tileset );
+  gpu_mem_release( GPU_MEM_TEXTURE, map->tileset );
+  destroy_shader( map->shader );
+  mem_free( map->tiles );
+  mem_free( map->chunkSlots );
+  mem_free( map->dirty );
+  mem_free( map->bakeScratch );
+  memset( map, 0, sizeof( tilemap_t ) );
+}
+
+int tilemap_get( const tilemap_t *map, int x, int y ) {
+  return map->tiles[ (size_t) y * map->width + x ];
+}
+
+void tilemap_set( tilemap_t *map, int x, int y, int tile ) {
+
+  uint8_t *t = &map->tiles[ (size_t) y * map->width + x ];
+
+  if ( *t == tile )
+    return;
+
+  *t = (uint8_t) tile;
+  map->dirty[ ( y / TILEMAP_CHUNK ) * map->chunksX + x / TILEMAP_CHUNK ] = 1;
+}
+
+int tilemap_tile_at( const tilemap_t *map, vec3_t position, int *x, int *y ) {
+
+  *x = (int) floorf( ( position.x - map->origin.x ) / map->tileSize );
+  *y = (int) floorf( ( position.y - map->origin.y ) / map->tileSize );
+
+  return *x >= 0 && *y >= 0 && *x < map->width && *y < map->height;
+}
+
+static void bake_chunk( tilemap_t *map, tilemap_slot_t *slot, int chunk ) {
+
+  int cx = chunk % map->chunksX * TILEMAP_CHUNK;
+  int cy = chunk / map->chunksX * TILEMAP_CHUNK;
+  int w = map->width - cx < TILEMAP_CHUNK ? map->width - cx : TILEMAP_CHUNK;
+  int h = map->height - cy < TILEMAP_CHUNK ? map->height - cy : TILEMAP_CHUNK;
+  tile_vertex_t *v = map->bakeScratch;
+
+  for ( int y = 0; y < h; ++y ) {
+    const uint8_t *row = map->tiles + (size_t) ( cy + y ) * map->width + cx;
+    for ( int x = 0; x < w; ++x, v += 4 ) {
+      uint8_t layer = row[ x ];
+      // Rows of the tileset start at v = 0, the top of the tile
+      v[ 0 ] = (tile_vertex_t) { (uint16_t) x, (uint16_t) y, 0, 1, layer, 0 };
+      v[ 1 ] = (tile_vertex_t) { (uint16_t) ( x + 1 ), (uint16_t) y, 1, 1, layer, 0 };
+      v[ 2 ] = (tile_vertex_t) { (uint16_t) ( x + 1 ), (uint16_t) ( y + 1 ), 1, 0, layer, 0 };
+      v[ 3 ] = (tile_vertex_t) { (uint16_t) x, (uint16_t) ( y + 1 ), 0, 0, layer, 0 };
+    }
+  }
+
+  size_t bytes = (size_t) w * h * 4 * sizeof( tile_vertex_t );
+  slot->quads = (unsigned) ( w * h );
+
+  if ( !slot->vbo ) {
+    // Sized for a whole chunk, so that the slot can take any other chunk
+    size_t capacity = CHUNK_QUADS * 4 * sizeof( tile_vertex_t );
+    glGenVertexArrays( 1, &slot->vao );
+    glBindVertexArray( slot->vao );
+    glGenBuffers( 1, &slot->vbo );
+    glBindBuffer( GL_ARRAY_BUFFER, slot->vbo );
+    // Static, the contents only change when tiles do or the slot is reused
+    glBufferData( GL_ARRAY_BUFFER, capacity, NULL, GL_STATIC_DRAW );
+    gpu_mem_track( GPU_MEM_BUFFER, slot->vbo, capacity, GL_STATIC_DRAW, "tilemap" );
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, map->ibo );
+    glVertexAttribPointer( 0, 2, GL_UNSIGNED_SHORT, GL_FALSE, sizeof( tile_vertex_t ), (void*) offsetof( tile_vertex_t, x ) );
+    glEnableVertexAttribArray( 0 );
+    glVertexAttribPointer( 1, 3, GL_UNSIGNED_BYTE, GL_FALSE, sizeof( tile_vertex_t ), (void*) offsetof( tile_vertex_t, u ) );
+    glEnableVertexAttribArray( 1 );
+    glBindVertexArray( 0 );
+  }
+  else {
+    glBindBuffer( GL_ARRAY_BUFFER, slot->vbo );
+  }
+
+  glBufferSubData( GL_ARRAY_BUFFER, 0, bytes, map->bakeScratch );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+  slot->chunk = chunk;
+  map->chunkSlots[ chunk ] = (int16_t) ( slot - map->slots );
+  map->dirty[ chunk ] = 0;
+}
+
+// A free slot, or the least recently drawn one that isn't needed this frame
+static int acquire_slot( tilemap_t *map ) {
+
+  int best = TILEMAP_NO_SLOT;
+
+  for ( int i = 0; i < TILEMAP_RESIDENT; ++i ) {
+    const tilemap_slot_t *slot = &map->slots[ i ];
+    if ( slot->chunk == TILEMAP_NO_SLOT )
+      return i;
+    if ( slot->lastUsed != map->frame && ( best == TILEMAP_NO_SLOT || slot->lastUsed < map->slots[ best ].lastUsed ) )
+      best = i;
+  }
+
+  if ( best != TILEMAP_NO_SLOT )
+    map->chunkSlots[ map->slots[ best ].chunk ] = TILEMAP_NO_SLOT;
+
+  return best;
+}
+
+static void add_chunk( tilemap_t *map, int chunk, ubo_ring_t *ring ) {
+
+  int slot = map->chunkSlots[ chunk ];
+
+  if ( map->visibleCount == TILEMAP_RESIDENT ) {
+    ++map->lastSkipped;
+    return;
+  }
+
+  if ( slot == TILEMAP_NO_SLOT ) {
+    slot = acquire_slot( map );
+    if ( slot == TILEMAP_NO_SLOT ) {
+      ++map->lastSkipped;
+      return;
+    }
+    bake_chunk( map, &map->slots[ slot ], chunk );
+    ++map->lastBakes;
+  }
+  else if ( map->dirty[ chunk ] ) {
+    bake_chunk( map, &map->slots[ slot ], chunk );
+    ++map->lastRebuilds;
+  }
+
+  map->slots[ slot ].lastUsed = map->frame;
+
+  // Chunk space is in tiles, the model matrix scales it to world units
+  float size = map->tileSize;
+  object_block_t block = { { {
+    size, 0.0f, 0.0f, 0.0f,
+    0.0f, size, 0.0f, 0.0f,
+    0.0f, 0.0f, 1.0f, 0.0f,
+    map->origin.x + chunk % map->chunksX * TILEMAP_CHUNK * size,
+    map->origin.y + chunk / map->chunksX * TILEMAP_CHUNK * size, map->origin.z, 1.0f
+  } }, { 1.0f, 0.0f, 0.0f, 0.0f } };
+
+  map->visible[ map->visibleCount ] = chunk;
+  map->blocks[ map->visibleCount ] = ubo_ring_push( ring, &block, sizeof( block ) );
+  ++map->visibleCount;
+}
+
+// Implicit quadtree over the chunk grid: ranges fully inside or outside the
+// frustum are decided with one test
+static void cull_range( tilemap_t *map, const frustum_t *frustum, ubo_ring_t *ring, int x0, int y0, int x1, int y1 ) {
+
+  float chunkSize = TILEMAP_CHUNK * map->tileSize;
+  aabb_t box = {
+    { map->origin.x + x0 * chunkSize, map->origin.y + y0 * chunkSize, map->origin.z },
+    { map->origin.x + x1 * chunkSize, map->origin.y + y1 * chunkSize, map->origin.z }
+  };
+  frustum_result_t result = frustum_test_aabb( frustum, &box );
+
+  if ( result == FRUSTUM_OUTSIDE )
+    return;
+
+  if ( result == FRUSTUM_INSIDE || ( x1 - x0 == 1 && y1 - y0 == 1 ) ) {
+    for ( int y = y0; y < y1; ++y ) {
+      for ( int x = x0; x < x1; ++x )
+        add_chunk( map, y * map->chunksX + x, ring );
+    }
+    return;
+  }
+
+  if ( x1 - x0 >= y1 - y0 ) {
+    int mid = ( x0 + x1 ) / 2;
+    cull_range( map, frustum, ring, x0, y0, mid, y1 );
+    cull_range( map, frustum, ring, mid, y0, x1, y1 );
+  }
+  else {
+    int mid = ( y0 + y1 ) / 2;
+    cull_range( map, frustum, ring, x0, y0, x1, mid );
+    cull_range( map, frustum, ring, x0, mid, x1, y1 );
+  }
+}
+
+void tilemap_prepare( tilemap_t *map, const frustum_t *frustum, ubo_ring_t *ring ) {
+
+  PROFILE_BEGIN( "tilemap_prepare" );
+
+  ++map->frame;
+  map->visibleCount = 0;
+  map->lastBakes = 0;
+  map->lastRebuilds = 0;
+  map->lastSkipped = 0;
+
+  cull_range( map, frustum, ring, 0, 0, map->chunksX, map->chunksY );
+
+  PROFILE_END();
+}
+
+void tilemap_draw( tilemap_t *map, const ubo_ring_t *ring ) {
+
+  map->lastDraws = 0;
+
+  if ( !map->visibleCount )
+    return;
+
+  PROFILE_BEGIN( "tilemap_draw" );
+
+  activate_shader( map->shader );
+  glActiveTexture( GL_TEXTURE0 );
+  glBindTexture( GL_TEXTURE_2D_ARRAY, map->tileset );
+
+  for ( unsigned i = 0; i < map->visibleCount; ++i ) {
+    if ( map->blocks[ i ] < 0 )
+      continue;
+    const tilemap_slot_t *slot = &map->slots[ map->chunkSlots[ map->visible[ i ] ] ];
+    ubo_ring_bind( ring, UBO_OBJECT_BINDING, map->blocks[ i ], sizeof( object_block_t ) );
+    glBindVertexArray( slot->vao );
+    glDrawElements( GL_TRIANGLES, slot->quads * 6, GL_UNSIGNED_SHORT, NULL );
+    ++map->lastDraws;
+  }
+
+  glBindVertexArray( 0 );
+  glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+
+  PROFILE_END();
+}
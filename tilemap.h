@@ -0,0 +1,87 @@
+#ifndef TILEMAP_H
+#define TILEMAP_H
+
+#include <stdint.h>
+#include "linmath.h"
+#include "frustum.h"
+#include "renderer.h"
+#include "ubo.h"
+
+/*
+ * Large tile maps, drawn one chunk of TILEMAP_CHUNK x TILEMAP_CHUNK tiles per
+ * draw. Chunks are baked into static vertex buffers the first time they're
+ * seen and stay resident until the slot is needed for another chunk, so a
+ * map far bigger than what fits on the GPU costs nothing while it's out of
+ * view. Changing tiles only marks their chunk dirty; resident dirty chunks
+ * are re-baked and re-uploaded with glBufferSubData before the next draw.
+ */
+#define TILEMAP_CHUNK 64
+// Chunks baked at any one time, each TILEMAP_CHUNK^2 * 4 * 8 bytes
+#define TILEMAP_RESIDENT 64
+#define TILEMAP_NO_SLOT -1
+
+enum {
+  TILE_GRASS,
+  TILE_DIRT,
+  TILE_SAND,
+  TILE_WATER,
+  TILE_TYPES
+};
+
+typedef struct tilemap_slot {
+  int chunk;
+  unsigned vbo;
+  unsigned vao;
+  // Edge chunks may be partial
+  unsigned quads;
+  uint64_t lastUsed;
+} tilemap_slot_t;
+
+typedef struct tilemap {
+  int width;
+  int height;
+  int chunksX;
+  int chunksY;
+  uint8_t *tiles;
+  // World position of the bottom-left corner, and the size of a tile
+  vec3_t origin;
+  float tileSize;
+
+  // Per chunk: its slot or TILEMAP_NO_SLOT, and whether its tiles changed
+  int16_t *chunkSlots;
+  uint8_t *dirty;
+  tilemap_slot_t slots[ TILEMAP_RESIDENT ];
+  unsigned ibo;
+  unsigned tileset;
+  shader_t *shader;
+  // One chunk's vertices while baking
+  void *bakeScratch;
+
+  // Chunks to draw this frame and their uniform blocks
+  int visible[ TILEMAP_RESIDENT ];
+  long blocks[ TILEMAP_RESIDENT ];
+  unsigned visibleCount;
+  uint64_t frame;
+
+  // Of the last frame
+  unsigned lastDraws;
+  unsigned lastBakes;
+  unsigned lastRebuilds;
+  // Visible chunks that didn't get a slot because all were in use
+  unsigned lastSkipped;
+} tilemap_t;
+
+// The map starts out procedurally generated
+int tilemap_init( tilemap_t *map, int width, int height, float tileSize );
+void tilemap_destroy( tilemap_t *map );
+int tilemap_get( const tilemap_t *map, int x, int y );
+void tilemap_set( tilemap_t *map, int x, int y, int tile );
+// Tile coordinates of a world position, returns 0 outside the map
+int tilemap_tile_at( const tilemap_t *map, vec3_t position, int *x, int *y );
+
+// Culls chunks, bakes the visible ones that need it and pushes their
+// uniform blocks. Must run between ubo_ring_begin() and ubo_ring_flush().
+void tilemap_prepare( tilemap_t *map, const frustum_t *frustum, ubo_ring_t *ring );
+void tilemap_draw( tilemap_t *map, const ubo_ring_t *ring );
+
+#endif
@@ -0,0 +1,13 @@
+// clock_gettime() is POSIX, which -std=c99 hides by default
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+#include "timing.h"
+
+uint64_t timing_now_ns() {
+
+  struct timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+
+  return (uint64_t) ts.tv_sec * NS_PER_SEC + (uint64_t) ts.tv_nsec;
+}
@@ -0,0 +1,12 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+
+#define NS_PER_MS 1000000ull
+#define NS_PER_SEC 1000000000ull
+
+// Monotonic wall clock in nanoseconds. Only differences are meaningful.
+uint64_t timing_now_ns();
+
+#endif
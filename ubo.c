@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <string.h>
+#include "ubo.h"
+#include "gpu_mem.h"
+#include "mem.h"
+#include "profiler.h"
+
+static unsigned frameBuffer;
+
+int ubo_frame_init() {
+
+  glGenBuffers( 1, &frameBuffer );
+  glBindBuffer( GL_UNIFORM_BUFFER, frameBuffer );
+  glBufferData( GL_UNIFORM_BUFFER, sizeof( frame_block_t ), NULL, GL_DYNAMIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, frameBuffer, sizeof( frame_block_t ), GL_DYNAMIC_DRAW, "uniforms" );
+  glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+
+  // Bound once for good, every program reads its Frame block from here
+  glBindBufferBase( GL_UNIFORM_BUFFER, UBO_FRAME_BINDING, frameBuffer );
+
+  return frameBuffer != 0;
+}
+
+void ubo_frame_destroy() {
+
+  glDeleteBuffers( 1, &frameBuffer );
+  gpu_mem_release( GPU_MEM_BUFFER, frameBuffer );
+  frameBuffer = 0;
+}
+
+void ubo_frame_update( const frame_block_t *block ) {
+
+  glBindBuffer( GL_UNIFORM_BUFFER, frameBuffer );
+  glBufferSubData( GL_UNIFORM_BUFFER, 0, sizeof( frame_block_t ), block );
+  glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+}
+
+int ubo_ring_init( ubo_ring_t *ring, size_t frameSize ) {
+
+  memset( ring, 0, sizeof( ubo_ring_t ) );
+
+  int alignment = 0;
+  glGetIntegerv( GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment );
+  ring->alignment = alignment > 0 ? (size_t) alignment : 256;
+  // Whole frames must start aligned too
+  ring->frameSize = ( frameSize + ring->alignment - 1 ) / ring->alignment * ring->alignment;
+
+  ring->staging = mem_alloc( MEM_RENDERER, ring->frameSize );
+  if ( !ring->staging ) {
+    fprintf( stderr, "Out of memory for the uniform ring\n" );
+    return 0;
+  }
+
+  size_t bytes = ring->frameSize * UBO_RING_FRAMES;
+  glGenBuffers( 1, &ring->buffer );
+  glBindBuffer( GL_UNIFORM_BUFFER, ring->buffer );
+  glBufferData( GL_UNIFORM_BUFFER, bytes, NULL, GL_STREAM_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, ring->buffer, bytes, GL_STREAM_DRAW, "uniforms" );
+  glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+
+  return 1;
+}
+
+void ubo_ring_destroy( ubo_ring_t *ring ) {
+
+  for ( unsigned i = 0; i < UBO_RING_FRAMES; ++i ) {
+    if ( ring->fences[ i ] )
+      glDeleteSync( ring->fences[ i ] );
+  }
+
+  glDeleteBuffers( 1, &ring->buffer );
+  gpu_mem_release( GPU_MEM_BUFFER, ring->buffer );
+  mem_free( ring->staging );
+  memset( ring, 0, sizeof( ubo_ring_t ) );
+}
+
+void ubo_ring_begin( ubo_ring_t *ring ) {
+
+  ring->frame = ( ring->frame + 1 ) % UBO_RING_FRAMES;
+  ring->used = 0;
+  ring->flushed = 0;
+
+  GLsync fence = ring->fences[ ring->frame ];
+  if ( fence ) {
+    PROFILE_BEGIN( "ubo_ring_wait" );
+    glClientWaitSync( fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED );
+    PROFILE_END();
+    glDeleteSync( fence );
+    ring->fences[ ring->frame ] = 0;
+  }
+}
+
+long ubo_ring_push( ubo_ring_t *ring, const void *data, size_t size ) {
+
+  size_t offset = ( ring->used + ring->alignment - 1 ) / ring->alignment * ring->alignment;
+
+  if ( offset + size > ring->frameSize ) {
+    ++ring->overflows;
+    return -1;
+  }
+
+  memcpy( ring->staging + offset, data, size );
+  ring->used = offset + size;
+
+  return (long) ( ring->frame * ring->frameSize + offset );
+}
+
+void ubo_ring_flush( ubo_ring_t *ring ) {
+
+  if ( ring->used == ring->flushed )
+    return;
+
+  PROFILE_BEGIN( "ubo_ring_flush" );
+
+  // Unsynchronized, the fence in ubo_ring_begin() already made sure that the
+  // GPU is done with this part of the buffer
+  size_t size = ring->used - ring->flushed;
+  glBindBuffer( GL_UNIFORM_BUFFER, ring->buffer );
+  void *dst = glMapBufferRange( GL_UNIFORM_BUFFER, ring->frame * ring->frameSize + ring->flushed, size,
+    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+
+  if ( dst ) {
+    memcpy( dst, ring->staging + ring->flushed, size );
+    glUnmapBuffer( GL_UNIFORM_BUFFER );
+  }
+  else {
+    fprintf( stderr, "Could not map the uniform ring\n" );
+  }
+
+  glBindBuffer( GL_UNIFORM_BUFFER, 0 );
+  ring->flushed = ring->used;
+
+  PROFILE_END();
+}
+
+void ubo_ring_bind( const ubo_ring_t *ring, unsigned binding, long offset, size_t size ) {
+  glBindBufferRange( GL_UNIFORM_BUFFER, binding, ring->buffer, offset, size );
+}
+
+void ubo_ring_end( ubo_ring_t *ring ) {
+  ring->fences[ ring->frame ] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+}
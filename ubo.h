@@ -0,0 +1,74 @@
+#ifndef UBO_H
+#define UBO_H
+
+#include <stddef.h>
+#include <glad/glad.h>
+#include "linmath.h"
+
+/*
+ * Uniform buffer objects shared by all shader programs. create_shader()
+ * points each program's Frame and Object blocks at these fixed binding
+ * points, so that switching programs never needs uniforms re-sent.
+ */
+#define UBO_FRAME_BINDING 0
+#define UBO_OBJECT_BINDING 1
+
+// Frames the GPU may lag behind, each gets its own part of the ring
+#define UBO_RING_FRAMES 3
+
+// std140 layouts of the blocks in shader.vert, keep them in sync
+typedef struct frame_block {
+  mat4_t view;
+  mat4_t projection;
+  mat4_t viewProjection;
+  // x: seconds since startup, y: seconds since the last frame, z: render
+  // scale, for sizes given in pixels
+  float time[ 4 ];
+} frame_block_t;
+
+typedef struct object_block {
+  mat4_t model;
+  // x: lightness
+  float params[ 4 ];
+} object_block_t;
+
+/*
+ * Streams per-object blocks. Blocks are pushed into a CPU-side staging area
+ * while the frame is being built, uploaded in one go by ubo_ring_flush(),
+ * and then bound per draw with glBindBufferRange(). Each frame writes its
+ * own part of the buffer, fenced, so uploads never stall on the GPU reading
+ * what earlier frames wrote.
+ */
+typedef struct ubo_ring {
+  unsigned buffer;
+  // Bytes per frame, and the offset alignment the GL demands
+  size_t frameSize;
+  size_t alignment;
+  unsigned frame;
+  GLsync fences[ UBO_RING_FRAMES ];
+  unsigned char *staging;
+  // Pushed so far this frame, and how much of it is uploaded
+  size_t used;
+  size_t flushed;
+  // Blocks that didn't fit and were dropped
+  unsigned long long overflows;
+} ubo_ring_t;
+
+int ubo_frame_init();
+void ubo_frame_destroy();
+// Uploads the frame block, it stays bound for all programs
+void ubo_frame_update( const frame_block_t *block );
+
+int ubo_ring_init( ubo_ring_t *ring, size_t frameSize );
+void ubo_ring_destroy( ubo_ring_t *ring );
+// Starts a frame, waiting if the GPU still reads this part of the ring
+void ubo_ring_begin( ubo_ring_t *ring );
+// Returns the block's offset in the buffer, or -1 if the frame's part is full
+long ubo_ring_push( ubo_ring_t *ring, const void *data, size_t size );
+// Uploads everything pushed since the last flush
+void ubo_ring_flush( ubo_ring_t *ring );
+void ubo_ring_bind( const ubo_ring_t *ring, unsigned binding, long offset, size_t size );
+// Fences the frame's part of the ring
+void ubo_ring_end( ubo_ring_t *ring );
+
+#endif
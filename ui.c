@@ -0,0 +1,305 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#include <glad/glad.h>
+#include "ui.h"
+#include "gpu_mem.h"
+#include "mem.h"
+#include "profiler.h"
+
+// The atlas is 16 x 6 cells of 8 x 8 pixels, for ASCII 32 to 127. 127
+// isn't printable and holds a solid block instead, which rectangles use.
+#define FONT_FIRST 32
+#define FONT_COLUMNS 16
+#define FONT_ROWS 6
+#define FONT_CELL 8
+#define FONT_W ( FONT_COLUMNS * FONT_CELL )
+#define FONT_H ( FONT_ROWS * FONT_CELL )
+#define FONT_SOLID 127
+
+// Classic 5x7 font, one byte per column, least significant bit at the top
+static const unsigned char font5x7[ 95 ][ UI_GLYPH_W ] = {
+  { 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x5f, 0x00, 0x00 }, { 0x00, 0x07, 0x00, 0x07, 0x00 }, { 0x14, 0x7f, 0x14, 0x7f, 0x14 },
+  { 0x24, 0x2a, 0x7f, 0x2a, 0x12 }, { 0x23, 0x13, 0x08, 0x64, 0x62 }, { 0x36, 0x49, 0x55, 0x22, 0x50 }, { 0x00, 0x05, 0x03, 0x00, 0x00 },
+  { 0x00, 0x1c, 0x22, 0x41, 0x00 }, { 0x00, 0x41, 0x22, 0x1c, 0x00 }, { 0x08, 0x2a, 0x1c, 0x2a, 0x08 }, { 0x08, 0x08, 0x3e, 0x08, 0x08 },
+  { 0x00, 0x50, 0x30, 0x00, 0x00 }, { 0x08, 0x08, 0x08, 0x08, 0x08 }, { 0x00, 0x60, 0x60, 0x00, 0x00 }, { 0x20, 0x10, 0x08, 0x04, 0x02 },
+  { 0x3e, 0x51, 0x49, 0x45, 0x3e }, { 0x00, 0x42, 0x7f, 0x40, 0x00 }, { 0x42, 0x61, 0x51, 0x49, 0x46 }, { 0x21, 0x41, 0x45, 0x4b, 0x31 },
+  { 0x18, 0x14, 0x12, 0x7f, 0x10 }, { 0x27, 0x45, 0x45, 0x45, 0x39 }, { 0x3c, 0x4a, 0x49, 0x49, 0x30 }, { 0x01, 0x71, 0x09, 0x05, 0x03 },
+  { 0x36, 0x49, 0x49, 0x49, 0x36 }, { 0x06, 0x49, 0x49, 0x29, 0x1e }, { 0x00, 0x36, 0x36, 0x00, 0x00 }, { 0x00, 0x56, 0x36, 0x00, 0x00 },
+  { 0x08, 0x14, 0x22, 0x41, 0x00 }, { 0x14, 0x14, 0x14, 0x14, 0x14 }, { 0x00, 0x41, 0x22, 0x14, 0x08 }, { 0x02, 0x01, 0x51, 0x09, 0x06 },
+  { 0x32, 0x49, 0x79, 0x41, 0x3e }, { 0x7e, 0x11, 0x11, 0x11, 0x7e }, { 0x7f, 0x49, 0x49, 0x49, 0x36 }, { 0x3e, 0x41, 0x41, 0x41, 0x22 },
+  { 0x7f, 0x41, 0x41, 0x22, 0x1c }, { 0x7f, 0x49, 0x49, 0x49, 0x41 }, { 0x7f, 0x09, 0x09, 0x09, 0x01 }, { 0x3e, 0x41, 0x49, 0x49, 0x7a },
+  { 0x7f, 0x08, 0x08, 0x08, 0x7f }, { 0x00, 0x41, 0x7f, 0x41, 0x00 }, { 0x20, 0x40, 0x41, 0x3f, 0x01 }, { 0x7f, 0x08, 0x14, 0x22, 0x41 },
+  { 0x7f, 0x40, 0x40, 0x40, 0x40 }, { 0x7f, 0x02, 0x0c, 0x02, 0x7f }, { 0x7f, 0x04, 0x08, 0x10, 0x7f }, { 0x3e, 0x41, 0x41, 0x41, 0x3e },
+  { 0x7f, 0x09, 0x09, 0x09, 0x06 }, { 0x3e, 0x41, 0x51, 0x21, 0x5e }, { 0x7f, 0x09, 0x19, 0x29, 0x46 }, { 0x46, 0x49, 0x49, 0x49, 0x31 },
+  { 0x01, 0x01, 0x7f, 0x01, 0x01 }, { 0x3f, 0x40, 0x40, 0x40, 0x3f }, { 0x1f, 0x20, 0x40, 0x20, 0x1f }, { 0x3f, 0x40, 0x38, 0x40, 0x3f },
+  { 0x63, 0x14, 0x08, 0x14, 0x63 }, { 0x07, 0x08, 0x70, 0x08, 0x07 }, { 0x61, 0x51, 0x49, 0x45, 0x43 }, { 0x00, 0x7f, 0x41, 0x41, 0x00 },
+  { 0x02, 0x04, 0x08, 0x10, 0x20 }, { 0x00, 0x41, 0x41, 0x7f, 0x00 }, { 0x04, 0x02, 0x01, 0x02, 0x04 }, { 0x40, 0x40, 0x40, 0x40, 0x40 },
+  { 0x00, 0x01, 0x02, 0x04, 0x00 }, { 0x20, 0x54, 0x54, 0x54, 0x78 }, { 0x7f, 0x48, 0x44, 0x44, 0x38 }, { 0x38, 0x44, 0x44, 0x44, 0x20 },
+  { 0x38, 0x44, 0x44, 0x48, 0x7f }, { 0x38, 0x54, 0x54, 0x54, 0x18 }, { 0x08, 0x7e, 0x09, 0x01, 0x02 }, { 0x0c, 0x52, 0x52, 0x52, 0x3e },
+  { 0x7f, 0x08, 0x04, 0x04, 0x78 }, { 0x00, 0x44, 0x7d, 0x40, 0x00 }, { 0x20, 0x40, 0x44, 0x3d, 0x00 }, { 0x7f, 0x10, 0x28, 0x44, 0x00 },
+  { 0x00, 0x41, 0x7f, 0x40, 0x00 }, { 0x7c, 0x04, 0x18, 0x04, 0x78 }, { 0x7c, 0x08, 0x04, 0x04, 0x78 }, { 0x38, 0x44, 0x44, 0x44, 0x38 },
+  { 0x7c, 0x14, 0x14, 0x14, 0x08 }, { 0x08, 0x14, 0x14, 0x18, 0x7c }, { 0x7c, 0x08, 0x04, 0x04, 0x08 }, { 0x48, 0x54, 0x54, 0x54, 0x20 },
+  { 0x04, 0x3f, 0x44, 0x40, 0x20 }, { 0x3c, 0x40, 0x40, 0x20, 0x7c }, { 0x1c, 0x20, 0x40, 0x20, 0x1c }, { 0x3c, 0x40, 0x30, 0x40, 0x3c },
+  { 0x44, 0x28, 0x10, 0x28, 0x44 }, { 0x0c, 0x50, 0x50, 0x50, 0x3c }, { 0x44, 0x64, 0x54, 0x4c, 0x44 }, { 0x00, 0x08, 0x36, 0x41, 0x00 },
+  { 0x00, 0x00, 0x7f, 0x00, 0x00 }, { 0x00, 0x41, 0x36, 0x08, 0x00 }, { 0x08, 0x04, 0x08, 0x10, 0x08 },
+};
+
+// White, with the glyph in alpha, so that vertex colours tint it
+static unsigned create_font() {
+
+  static unsigned char pixels[ FONT_H ][ FONT_W ][ 4 ];
+  memset( pixels, 255, sizeof( pixels ) );
+
+  for ( int c = FONT_FIRST; c <= FONT_SOLID; ++c ) {
+    int x0 = ( c - FONT_FIRST ) % FONT_COLUMNS * FONT_CELL;
+    int y0 = ( c - FONT_FIRST ) / FONT_COLUMNS * FONT_CELL;
+    for ( int y = 0; y < FONT_CELL; ++y ) {
+      for ( int x = 0; x < FONT_CELL; ++x ) {
+        int on = c == FONT_SOLID ||
+          ( x < UI_GLYPH_W && y < UI_GLYPH_H && ( font5x7[ c - FONT_FIRST ][ x ] >> y & 1 ) );
+        pixels[ y0 + y ][ x0 + x ][ 3 ] = on ? 255 : 0;
+      }
+    }
+  }
+
+  unsigned texture;
+  glGenTextures( 1, &texture );
+  glBindTexture( GL_TEXTURE_2D, texture );
+  glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, FONT_W, FONT_H, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels );
+  // Pixel exact at integer scales
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+  glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+  glBindTexture( GL_TEXTURE_2D, 0 );
+  gpu_mem_track( GPU_MEM_TEXTURE, texture, sizeof( pixels ), GL_STATIC_DRAW, "ui" );
+
+  return texture;
+}
+
+int ui_init( ui_t *ui ) {
+
+  memset( ui, 0, sizeof( ui_t ) );
+  ui->vertices = mem_alloc( MEM_RENDERER, UI_MAX_QUADS * 4 * sizeof( ui_vertex_t ) );
+  uint16_t *indices = mem_alloc( MEM_SCRATCH, UI_MAX_QUADS * 6 * sizeof( uint16_t ) );
+
+  if ( !ui->vertices || !indices ) {
+    fprintf( stderr, "Out of memory for the UI\n" );
+    mem_free( indices );
+    return 0;
+  }
+
+  ui->shader = create_shader( "ui.vert", "sprite.frag" );
+  if ( !ui->shader ) {
+    mem_free( indices );
+    return 0;
+  }
+
+  for ( unsigned i = 0; i < UI_MAX_QUADS; ++i ) {
+    uint16_t *quad = indices + i * 6;
+    quad[ 0 ] = (uint16_t) ( i * 4 );
+    quad[ 1 ] = (uint16_t) ( i * 4 + 1 );
+    quad[ 2 ] = (uint16_t) ( i * 4 + 2 );
+    quad[ 3 ] = (uint16_t) ( i * 4 + 2 );
+    quad[ 4 ] = (uint16_t) ( i * 4 + 3 );
+    quad[ 5 ] = (uint16_t) ( i * 4 );
+  }
+
+  size_t vertexBytes = UI_MAX_QUADS * 4 * sizeof( ui_vertex_t );
+  size_t indexBytes = UI_MAX_QUADS * 6 * sizeof( uint16_t );
+  glGenVertexArrays( 1, &ui->vao );
+  glBindVertexArray( ui->vao );
+  glGenBuffers( 1, &ui->vbo );
+  glBindBuffer( GL_ARRAY_BUFFER, ui->vbo );
+  // Dynamic rather than stream, the contents usually stay for many frames
+  glBufferData( GL_ARRAY_BUFFER, vertexBytes, NULL, GL_DYNAMIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, ui->vbo, vertexBytes, GL_DYNAMIC_DRAW, "ui" );
+  glGenBuffers( 1, &ui->ibo );
+  glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, ui->ibo );
+  glBufferData( GL_ELEMENT_ARRAY_BUFFER, indexBytes, indices, GL_STATIC_DRAW );
+  gpu_mem_track( GPU_MEM_BUFFER, ui->ibo, indexBytes, GL_STATIC_DRAW, "ui" );
+  glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, sizeof( ui_vertex_t ), (void*) offsetof( ui_vertex_t, x ) );
+  glEnableVertexAttribArray( 0 );
+  glVertexAttribPointer( 1, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof( ui_vertex_t ), (void*) offsetof( ui_vertex_t, u ) );
+  glEnableVertexAttribArray( 1 );
+  glVertexAttribPointer( 2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof( ui_vertex_t ), (void*) offsetof( ui_vertex_t, color ) );
+  glEnableVertexAttribArray( 2 );
+  glBindVertexArray( 0 );
+  glBindBuffer( GL_ARRAY_BUFFER, 0 );
+  mem_free( indices );
+
+  ui->font = create_font();
+
+  return 1;
+}
+
+void ui_destroy( ui_t *ui ) {
+
+  gpu_mem_release( GPU_MEM_BUFFER, ui->vbo );
+  gpu_mem_release( GPU_MEM_BUFFER, ui->ibo );
+  gpu_mem_release( GPU_MEM_TEXTURE, ui->font );
+  glDeleteVertexArrays( 1, &ui->vao );
+  glDeleteBuffers( 1, &ui->vbo );
+  glDeleteBuffers( 1, &ui->ibo );
+  glDeleteTextures( 1, &ui->font );
+  destroy_shader( ui->shader );
+  mem_free( ui->vertices );
+  memset( ui, 0, sizeof( ui_t ) );
+}
+
+void ui_mouse_move( ui_t *ui, int x, int y ) {
+  ui->mouseX = x;
+  ui->mouseY = y;
+}
+
+void ui_mouse_button( ui_t *ui, int down ) {
+
+  if ( down && !ui->mouseDown )
+    ui->mousePressed = 1;
+  ui->mouseDown = down;
+}
+
+void ui_begin( ui_t *ui, int width, int height ) {
+  ui->width = width;
+  ui->height = height;
+  ui->quadCount = 0;
+}
+
+// Pixels to clip space, and atlas pixels to normalized texture coordinates
+static void push_quad( ui_t *ui, int x0, int y0, int x1, int y1, int u0, int v0, int u1, int v1, color_t color ) {
+
+  if ( ui->quadCount == UI_MAX_QUADS )
+    return;
+
+  float sx = 2.0f / ui->width, sy = 2.0f / ui->height;
+  float left = x0 * sx - 1.0f, right = x1 * sx - 1.0f;
+  float top = 1.0f - y0 * sy, bottom = 1.0f - y1 * sy;
+  uint16_t s0 = (uint16_t) ( u0 * 65535 / FONT_W ), s1 = (uint16_t) ( u1 * 65535 / FONT_W );
+  uint16_t t0 = (uint16_t) ( v0 * 65535 / FONT_H ), t1 = (uint16_t) ( v1 * 65535 / FONT_H );
+  ui_vertex_t *v = ui->vertices + ui->quadCount * 4;
+
+  v[ 0 ] = (ui_vertex_t) { left, bottom, s0, t1, color };
+  v[ 1 ] = (ui_vertex_t) { right, bottom, s1, t1, color };
+  v[ 2 ] = (ui_vertex_t) { right, top, s1, t0, color };
+  v[ 3 ] = (ui_vertex_t) { left, top, s0, t0, color };
+  ++ui->quadCount;
+}
+
+void ui_rect( ui_t *ui, int x, int y, int w, int h, color_t color ) {
+
+  // The middle of the solid cell, so that filtering never reaches its edge
+  int u = ( FONT_SOLID - FONT_FIRST ) % FONT_COLUMNS * FONT_CELL + FONT_CELL / 2;
+  int v = ( FONT_SOLID - FONT_FIRST ) / FONT_COLUMNS * FONT_CELL + FONT_CELL / 2;
+
+  push_quad( ui, x, y, x + w, y + h, u, v, u, v, color );
+}
+
+int ui_text( ui_t *ui, int x, int y, int scale, color_t color, const char *format, ... ) {
+
+  char text[ 256 ];
+  va_list args;
+  va_start( args, format );
+  vsnprintf( text, sizeof( text ), format, args );
+  va_end( args );
+
+  int penX = x, penY = y, width = 0;
+
+  for ( const char *c = text; *c; ++c ) {
+    if ( *c == '\n' ) {
+      penX = x;
+      penY += UI_LINE_H * scale;
+      continue;
+    }
+
+    int glyph = *c >= FONT_FIRST && *c < FONT_SOLID ? *c : '?';
+    if ( glyph != ' ' ) {
+      int u = ( glyph - FONT_FIRST ) % FONT_COLUMNS * FONT_CELL;
+      int v = ( glyph - FONT_FIRST ) / FONT_COLUMNS * FONT_CELL;
+      push_quad( ui, penX, penY, penX + UI_GLYPH_W * scale, penY + UI_GLYPH_H * scale,
+        u, v, u + UI_GLYPH_W, v + UI_GLYPH_H, color );
+    }
+    penX += UI_ADVANCE * scale;
+    if ( penX - x > width )
+      width = penX - x;
+  }
+
+  return width;
+}
+
+int ui_button( ui_t *ui, int x, int y, int w, int h, const char *label ) {
+
+  int hover = ui->mouseX >= x && ui->mouseX < x + w && ui->mouseY >= y && ui->mouseY < y + h;
+  color_t background = hover && ui->mouseDown ? (color_t) { 40, 40, 40, 255 } :
+    hover ? (color_t) { 110, 110, 110, 255 } : (color_t) { 70, 70, 70, 255 };
+
+  ui_rect( ui, x, y, w, h, background );
+
+  int scale = 2;
+  int textW = (int) strlen( label ) * UI_ADVANCE * scale - scale;
+  ui_text( ui, x + ( w - textW ) / 2, y + ( h - UI_GLYPH_H * scale ) / 2, scale, COLOR_WHITE, "%s", label );
+
+  return hover && ui->mousePressed;
+}
+
+// FNV-1a
+static uint64_t hash_bytes( const void *data, size_t size ) {
+
+  const unsigned char *bytes = data;
+  uint64_t hash = 0xcbf29ce484222325ull;
+
+  for ( size_t i = 0; i < size; ++i )
+    hash = ( hash ^ bytes[ i ] ) * 0x100000001b3ull;
+
+  return hash;
+}
+
+void ui_end( ui_t *ui ) {
+
+  ui->mousePressed = 0;
+  ui->lastQuads = ui->quadCount;
+  ui->lastDraws = 0;
+  ui->lastUploads = 0;
+
+  if ( !ui->quadCount )
+    return;
+
+  PROFILE_BEGIN( "ui" );
+
+  size_t bytes = ui->quadCount * 4 * sizeof( ui_vertex_t );
+  uint64_t hash = hash_bytes( ui->vertices, bytes );
+
+  if ( hash != ui->uploadedHash || ui->quadCount != ui->uploadedQuads ) {
+    glBindBuffer( GL_ARRAY_BUFFER, ui->vbo );
+    glBufferSubData( GL_ARRAY_BUFFER, 0, bytes, ui->vertices );
+    glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    ui->uploadedHash = hash;
+    ui->uploadedQuads = ui->quadCount;
+    ui->lastUploads = 1;
+  }
+  else {
+    ++ui->skippedUploads;
+  }
+
+  // Over the whole window, including the toolbar the scene leaves out
+  int viewport[ 4 ];
+  glGetIntegerv( GL_VIEWPORT, viewport );
+  glViewport( 0, 0, ui->width, ui->height );
+
+  activate_shader( ui->shader );
+  glEnable( GL_BLEND );
+  glBlendFuncSeparate( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
+  glActiveTexture( GL_TEXTURE0 );
+  glBindTexture( GL_TEXTURE_2D, ui->font );
+  glBindVertexArray( ui->vao );
+  glDrawElements( GL_TRIANGLES, ui->quadCount * 6, GL_UNSIGNED_SHORT, NULL );
+  glBindVertexArray( 0 );
+  glBindTexture( GL_TEXTURE_2D, 0 );
+  glDisable( GL_BLEND );
+  ++ui->lastDraws;
+
+  glViewport( viewport[ 0 ], viewport[ 1 ], viewport[ 2 ], viewport[ 3 ] );
+
+  PROFILE_END();
+}
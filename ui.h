@@ -0,0 +1,73 @@
+#ifndef UI_H
+#define UI_H
+
+#include <stdint.h>
+#include "renderer.h"
+#include "sprite_batch.h"
+
+/*
+ * Immediate-mode UI: widgets are declared every frame between ui_begin()
+ * and ui_end(), in window pixels from the top-left corner. Everything,
+ * text included, becomes quads textured from one pre-rasterized glyph
+ * atlas, drawn with a single call. The vertex stream is hashed and only
+ * uploaded when it differs from the last one, so a UI that shows the same
+ * thing frame after frame costs no upload at all.
+ */
+#define UI_MAX_QUADS 8192
+// Glyphs are 5x7 pixels, advancing by 6 at scale 1
+#define UI_GLYPH_W 5
+#define UI_GLYPH_H 7
+#define UI_ADVANCE 6
+#define UI_LINE_H 9
+
+typedef struct ui_vertex {
+  float x;
+  float y;
+  uint16_t u;
+  uint16_t v;
+  color_t color;
+} ui_vertex_t;
+
+typedef struct ui {
+  ui_vertex_t *vertices;
+  unsigned quadCount;
+  int width;
+  int height;
+
+  // Mouse in window pixels, and whether the button went down this frame
+  int mouseX;
+  int mouseY;
+  int mouseDown;
+  int mousePressed;
+
+  unsigned vao;
+  unsigned vbo;
+  unsigned ibo;
+  unsigned font;
+  shader_t *shader;
+  // Of what's in the vertex buffer
+  uint64_t uploadedHash;
+  unsigned uploadedQuads;
+
+  // Of the last frame, and uploads skipped over the whole run
+  unsigned lastQuads;
+  unsigned lastDraws;
+  unsigned lastUploads;
+  unsigned long long skippedUploads;
+} ui_t;
+
+int ui_init( ui_t *ui );
+void ui_destroy( ui_t *ui );
+// Feed from mouse events, before ui_begin()
+void ui_mouse_move( ui_t *ui, int x, int y );
+void ui_mouse_button( ui_t *ui, int down );
+void ui_begin( ui_t *ui, int width, int height );
+void ui_rect( ui_t *ui, int x, int y, int w, int h, color_t color );
+// printf-style, returns the width of the text in pixels
+int ui_text( ui_t *ui, int x, int y, int scale, color_t color, const char *format, ... );
+// Returns 1 when clicked this frame
+int ui_button( ui_t *ui, int x, int y, int w, int h, const char *label );
+// Uploads the vertices if they changed and draws them over the whole window
+void ui_end( ui_t *ui );
+
+#endif
@@ -0,0 +1,350 @@
+// pthreads are POSIX, which -std=c99 hides by default
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#include "video.h"
+#include "jobs.h"
+#include "mem.h"
+#include "profiler.h"
+
+#define Y4M_FRAME_HEADER "FRAME\n"
+
+/*
+ * BT.601 full range ("jpeg") coefficients in 8.8 fixed point:
+ * Y = 0.299 R + 0.587 G + 0.114 B
+ * U = -0.169 R - 0.331 G + 0.5 B + 128
+ * V = 0.5 R - 0.419 G - 0.081 B + 128
+ */
+#define YR 77
+#define YG 150
+#define YB 29
+#define UR -43
+#define UG -85
+#define UB 128
+#define VR 128
+#define VG -107
+#define VB -21
+
+static void* writer_thread( void *arg ) {
+
+  video_t *video = arg;
+
+  PROFILE_THREAD_NAME( "video writer" );
+
+  pthread_mutex_lock( &video->lock );
+
+  for ( ;; ) {
+    while ( !video->writePending && !video->quit )
+      pthread_cond_wait( &video->cond, &video->lock );
+
+    if ( !video->writePending )
+      break;
+
+    // The buffer the capture thread isn't using
+    unsigned char *buffer = video->buffers[ video->active ^ 1 ];
+    size_t size = video->writeSize;
+    pthread_mutex_unlock( &video->lock );
+
+    PROFILE_BEGIN( "video_write" );
+    size_t written = fwrite( buffer, 1, size, video->file );
+    PROFILE_END();
+
+    pthread_mutex_lock( &video->lock );
+    video->bytesWritten += written;
+    video->writePending = 0;
+    pthread_cond_broadcast( &video->cond );
+  }
+
+  pthread_mutex_unlock( &video->lock );
+
+  return NULL;
+}
+
+// Hands the active buffer to the writer, waiting for the previous write if needed
+static void submit_batch( video_t *video ) {
+
+  pthread_mutex_lock( &video->lock );
+
+  while ( video->writePending )
+    pthread_cond_wait( &video->cond, &video->lock );
+
+  video->writeSize = video->used;
+  video->writePending = 1;
+  video->active ^= 1;
+  video->used = 0;
+  pthread_cond_broadcast( &video->cond );
+
+  pthread_mutex_unlock( &video->lock );
+}
+
+int video_open( video_t *video, const char *path, video_format_t format, int fps ) {
+
+  memset( video, 0, sizeof( video_t ) );
+  video->format = format;
+  video->fps = fps;
+  video->capacity = VIDEO_BATCH_BYTES;
+
+  video->file = fopen( path, "wb" );
+  if ( !video->file ) {
+    fprintf( stderr, "Could not open %s for recording\n", path );
+    return 0;
+  }
+
+  video->buffers[ 0 ] = mem_alloc( MEM_SCRATCH, video->capacity );
+  video->buffers[ 1 ] = mem_alloc( MEM_SCRATCH, video->capacity );
+
+  if ( !video->buffers[ 0 ] || !video->buffers[ 1 ] ) {
+    fprintf( stderr, "Out of memory for recording\n" );
+    return 0;
+  }
+
+  pthread_mutex_init( &video->lock, NULL );
+  pthread_cond_init( &video->cond, NULL );
+
+  if ( pthread_create( &video->writer, NULL, writer_thread, video ) != 0 ) {
+    fprintf( stderr, "Could not start video writer thread\n" );
+    return 0;
+  }
+
+  return 1;
+}
+
+#ifdef __SSE2__
+// Lanes of 32-bit RGBA pixels to 16-bit channel values, one per 32-bit lane
+#define CHANNEL( px, shift ) _mm_and_si128( _mm_srli_epi32( px, shift ), _mm_set1_epi32( 0xff ) )
+
+// Four pixels' worth of Y in the low 16 bits of each 32-bit lane
+static __m128i luma4( __m128i px ) {
+
+  __m128i y = _mm_add_epi16(
+    _mm_add_epi16( _mm_mullo_epi16( CHANNEL( px, 0 ), _mm_set1_epi32( YR ) ),
+      _mm_mullo_epi16( CHANNEL( px, 8 ), _mm_set1_epi32( YG ) ) ),
+    _mm_add_epi16( _mm_mullo_epi16( CHANNEL( px, 16 ), _mm_set1_epi32( YB ) ), _mm_set1_epi32( 128 ) ) );
+
+  // The sum fits in 16 unsigned bits, so a logical shift is right
+  return _mm_srli_epi32( _mm_and_si128( y, _mm_set1_epi32( 0xffff ) ), 8 );
+}
+#endif
+
+static void convert_row_luma( const unsigned char *src, int width, unsigned char *dst ) {
+
+  int x = 0;
+
+#ifdef __SSE2__
+  for ( ; x + 16 <= width; x += 16 ) {
+    __m128i y0 = luma4( _mm_loadu_si128( (const __m128i*) ( src + x * 4 ) ) );
+    __m128i y1 = luma4( _mm_loadu_si128( (const __m128i*) ( src + x * 4 + 16 ) ) );
+    __m128i y2 = luma4( _mm_loadu_si128( (const __m128i*) ( src + x * 4 + 32 ) ) );
+    __m128i y3 = luma4( _mm_loadu_si128( (const __m128i*) ( src + x * 4 + 48 ) ) );
+    __m128i packed = _mm_packus_epi16( _mm_packs_epi32( y0, y1 ), _mm_packs_epi32( y2, y3 ) );
+    _mm_storeu_si128( (__m128i*) ( dst + x ), packed );
+  }
+#endif
+
+  for ( ; x < width; ++x ) {
+    const unsigned char *p = src + x * 4;
+    dst[ x ] = (unsigned char) ( ( YR * p[ 0 ] + YG * p[ 1 ] + YB * p[ 2 ] + 128 ) >> 8 );
+  }
+}
+
+static unsigned char clamp_byte( int v ) {
+  return v < 0 ? 0 : v > 255 ? 255 : (unsigned char) v;
+}
+
+// Chroma of one row pair, from 2x2 averages. row1 may equal row0 on odd heights.
+static void convert_row_chroma( const unsigned char *row0, const unsigned char *row1, int width,
+  unsigned char *u, unsigned char *v ) {
+
+  int x = 0;
+
+#ifdef __SSE2__
+  const __m128i round = _mm_set1_epi16( 2 );
+
+  // Eight pixels per row, four chroma samples
+  for ( ; x + 8 <= width; x += 8 ) {
+    __m128i a0 = _mm_loadu_si128( (const __m128i*) ( row0 + x * 4 ) );
+    __m128i a1 = _mm_loadu_si128( (const __m128i*) ( row0 + x * 4 + 16 ) );
+    __m128i b0 = _mm_loadu_si128( (const __m128i*) ( row1 + x * 4 ) );
+    __m128i b1 = _mm_loadu_si128( (const __m128i*) ( row1 + x * 4 + 16 ) );
+
+    // Widen to 16-bit RGBA and sum the rows and horizontal neighbours
+    __m128i zero = _mm_setzero_si128();
+    __m128i s0 = _mm_add_epi16( _mm_unpacklo_epi8( a0, zero ), _mm_unpacklo_epi8( b0, zero ) );
+    __m128i s1 = _mm_add_epi16( _mm_unpackhi_epi8( a0, zero ), _mm_unpackhi_epi8( b0, zero ) );
+    __m128i s2 = _mm_add_epi16( _mm_unpacklo_epi8( a1, zero ), _mm_unpacklo_epi8( b1, zero ) );
+    __m128i s3 = _mm_add_epi16( _mm_unpackhi_epi8( a1, zero ), _mm_unpackhi_epi8( b1, zero ) );
+    // Each 64-bit half is now one pixel pair's RGBA
+    s0 = _mm_add_epi16( s0, _mm_srli_si128( s0, 8 ) );
+    s1 = _mm_add_epi16( s1, _mm_srli_si128( s1, 8 ) );
+    s2 = _mm_add_epi16( s2, _mm_srli_si128( s2, 8 ) );
+    s3 = _mm_add_epi16( s3, _mm_srli_si128( s3, 8 ) );
+    // Four 2x2 averages, as RGBA16 in two registers
+    __m128i avg01 = _mm_srli_epi16( _mm_add_epi16( _mm_unpacklo_epi64( s0, s1 ), round ), 2 );
+    __m128i avg23 = _mm_srli_epi16( _mm_add_epi16( _mm_unpacklo_epi64( s2, s3 ), round ), 2 );
+
+    // madd gives (cR * R + cG * G) and (cB * B) per pixel, which fit in 32 bits
+    __m128i uCoef = _mm_setr_epi16( UR, UG, UB, 0, UR, UG, UB, 0 );
+    __m128i vCoef = _mm_setr_epi16( VR, VG, VB, 0, VR, VG, VB, 0 );
+    __m128i u01 = _mm_madd_epi16( avg01, uCoef );
+    __m128i u23 = _mm_madd_epi16( avg23, uCoef );
+    __m128i v01 = _mm_madd_epi16( avg01, vCoef );
+    __m128i v23 = _mm_madd_epi16( avg23, vCoef );
+    // Add the two partial sums of each pixel: lanes 0 and 2 hold the totals
+    u01 = _mm_add_epi32( u01, _mm_srli_epi64( u01, 32 ) );
+    u23 = _mm_add_epi32( u23, _mm_srli_epi64( u23, 32 ) );
+    v01 = _mm_add_epi32( v01, _mm_srli_epi64( v01, 32 ) );
+    v23 = _mm_add_epi32( v23, _mm_srli_epi64( v23, 32 ) );
+    // Gather lanes 0 and 2 of both, i.e. four samples
+    __m128i us = _mm_unpacklo_epi64( _mm_shuffle_epi32( u01, _MM_SHUFFLE( 3, 1, 2, 0 ) ), _mm_shuffle_epi32( u23, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+    __m128i vs = _mm_unpacklo_epi64( _mm_shuffle_epi32( v01, _MM_SHUFFLE( 3, 1, 2, 0 ) ), _mm_shuffle_epi32( v23, _MM_SHUFFLE( 3, 1, 2, 0 ) ) );
+    __m128i bias = _mm_set1_epi32( 128 * 256 + 128 );
+    us = _mm_srai_epi32( _mm_add_epi32( us, bias ), 8 );
+    vs = _mm_srai_epi32( _mm_add_epi32( vs, bias ), 8 );
+    __m128i uv = _mm_packus_epi16( _mm_packs_epi32( us, vs ), zero );
+
+    int packed[ 2 ];
+    _mm_storel_epi64( (__m128i*) packed, uv );
+    memcpy( u + x / 2, &packed[ 0 ], 4 );
+    memcpy( v + x / 2, &packed[ 1 ], 4 );
+  }
+#endif
+
+  for ( ; x < width; x += 2 ) {
+    // The last column is repeated on odd widths
+    int x1 = x + 1 < width ? x + 1 : x;
+    const unsigned char *p[ 4 ] = { row0 + x * 4, row0 + x1 * 4, row1 + x * 4, row1 + x1 * 4 };
+    int r = ( p[ 0 ][ 0 ] + p[ 1 ][ 0 ] + p[ 2 ][ 0 ] + p[ 3 ][ 0 ] + 2 ) >> 2;
+    int g = ( p[ 0 ][ 1 ] + p[ 1 ][ 1 ] + p[ 2 ][ 1 ] + p[ 3 ][ 1 ] + 2 ) >> 2;
+    int b = ( p[ 0 ][ 2 ] + p[ 1 ][ 2 ] + p[ 2 ][ 2 ] + p[ 3 ][ 2 ] + 2 ) >> 2;
+    u[ x / 2 ] = clamp_byte( ( UR * r + UG * g + UB * b + 128 * 256 + 128 ) >> 8 );
+    v[ x / 2 ] = clamp_byte( ( VR * r + VG * g + VB * b + 128 * 256 + 128 ) >> 8 );
+  }
+}
+
+void video_rgba_to_i420( const unsigned char *rgba, int width, int height, int y0, int y1,
+  unsigned char *yPlane, unsigned char *uPlane, unsigned char *vPlane ) {
+
+  int chromaW = ( width + 1 ) / 2;
+
+  for ( int y = y0; y < y1; y += 2 ) {
+    // Source rows are bottom-up
+    const unsigned char *row0 = rgba + (size_t) ( height - 1 - y ) * width * 4;
+    const unsigned char *row1 = y + 1 < height ? row0 - (size_t) width * 4 : row0;
+
+    convert_row_luma( row0, width, yPlane + (size_t) y * width );
+    if ( y + 1 < height )
+      convert_row_luma( row1, width, yPlane + (size_t) ( y + 1 ) * width );
+
+    convert_row_chroma( row0, row1, width, uPlane + (size_t) ( y / 2 ) * chromaW, vPlane + (size_t) ( y / 2 ) * chromaW );
+  }
+}
+
+typedef struct convert_job {
+  const unsigned char *rgba;
+  int width;
+  int height;
+  unsigned char *yPlane;
+  unsigned char *uPlane;
+  unsigned char *vPlane;
+} convert_job_t;
+
+// One item per row pair
+static void convert_rows( void *ctx, unsigned begin, unsigned end ) {
+
+  const convert_job_t *job = ctx;
+  int y1 = (int) end * 2;
+
+  video_rgba_to_i420( job->rgba, job->width, job->height, (int) begin * 2, y1 > job->height ? job->height : y1,
+    job->yPlane, job->uPlane, job->vPlane );
+}
+
+static size_t frame_bytes( const video_t *video ) {
+
+  size_t pixels = (size_t) video->width * video->height;
+
+  if ( video->format == VIDEO_RAW )
+    return pixels * 4;
+
+  size_t chroma = (size_t) ( ( video->width + 1 ) / 2 ) * ( ( video->height + 1 ) / 2 );
+
+  return sizeof( Y4M_FRAME_HEADER ) - 1 + pixels + chroma * 2;
+}
+
+void video_sink( void *ctx, const unsigned char *pixels, int width, int height, uint64_t frame ) {
+
+  video_t *video = ctx;
+
+  if ( !video->width ) {
+    video->width = width;
+    video->height = height;
+    if ( video->format == VIDEO_Y4M )
+      fprintf( video->file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, video->fps );
+  }
+
+  if ( width != video->width || height != video->height ) {
+    ++video->dropped;
+    return;
+  }
+
+  size_t size = frame_bytes( video );
+
+  if ( video->used + size > video->capacity )
+    submit_batch( video );
+
+  // Frames bigger than a whole batch only happen at silly resolutions
+  if ( size > video->capacity ) {
+    pthread_mutex_lock( &video->lock );
+    while ( video->writePending )
+      pthread_cond_wait( &video->cond, &video->lock );
+    pthread_mutex_unlock( &video->lock );
+    video->buffers[ 0 ] = mem_realloc( MEM_SCRATCH, video->buffers[ 0 ], size );
+    video->buffers[ 1 ] = mem_realloc( MEM_SCRATCH, video->buffers[ 1 ], size );
+    video->capacity = size;
+  }
+
+  unsigned char *dst = video->buffers[ video->active ] + video->used;
+
+  PROFILE_BEGIN( "video_convert" );
+
+  if ( video->format == VIDEO_RAW ) {
+    size_t stride = (size_t) width * 4;
+    for ( int y = 0; y < height; ++y )
+      memcpy( dst + y * stride, pixels + ( height - 1 - y ) * stride, stride );
+  }
+  else {
+    memcpy( dst, Y4M_FRAME_HEADER, sizeof( Y4M_FRAME_HEADER ) - 1 );
+    dst += sizeof( Y4M_FRAME_HEADER ) - 1;
+
+    size_t lumaSize = (size_t) width * height;
+    size_t chromaSize = (size_t) ( ( width + 1 ) / 2 ) * ( ( height + 1 ) / 2 );
+    convert_job_t job = { pixels, width, height, dst, dst + lumaSize, dst + lumaSize + chromaSize };
+
+    jobs_parallel_for( (unsigned) ( height + 1 ) / 2, 8, convert_rows, &job );
+  }
+
+  PROFILE_END();
+
+  video->used += size;
+  ++video->frames;
+}
+
+void video_close( video_t *video ) {
+
+  if ( video->used )
+    submit_batch( video );
+
+  pthread_mutex_lock( &video->lock );
+  video->quit = 1;
+  pthread_cond_broadcast( &video->cond );
+  pthread_mutex_unlock( &video->lock );
+  pthread_join( video->writer, NULL );
+
+  fclose( video->file );
+  mem_free( video->buffers[ 0 ] );
+  mem_free( video->buffers[ 1 ] );
+  pthread_mutex_destroy( &video->lock );
+  pthread_cond_destroy( &video->cond );
+}
@@ -0,0 +1,60 @@
+#ifndef VIDEO_H
+#define VIDEO_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/*
+ * Frame sequence recording, fed by the capture thread through video_sink().
+ * Frames are converted straight into a large batch buffer (RGB to YUV 4:2:0
+ * with SSE2, split over the job threads) and whole batches are written out
+ * sequentially by a writer thread, so that neither the conversion nor the
+ * disk ever holds up the capture ring, let alone the render thread.
+ */
+#define VIDEO_BATCH_BYTES ( 16 << 20 )
+
+typedef enum video_format {
+  // YUV4MPEG2, 4:2:0 full range, playable with ffplay/mpv
+  VIDEO_Y4M,
+  // Raw RGBA8 frames, top row first
+  VIDEO_RAW
+} video_format_t;
+
+typedef struct video {
+  FILE *file;
+  video_format_t format;
+  int fps;
+  // Fixed by the first frame, frames of any other size are dropped
+  int width;
+  int height;
+
+  // The capture thread fills one buffer while the writer writes the other
+  unsigned char *buffers[ 2 ];
+  size_t capacity;
+  size_t used;
+  unsigned active;
+  size_t writeSize;
+  int writePending;
+
+  pthread_t writer;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  int quit;
+
+  uint64_t frames;
+  uint64_t dropped;
+  uint64_t bytesWritten;
+} video_t;
+
+int video_open( video_t *video, const char *path, video_format_t format, int fps );
+// A capture_sink_t, ctx is the video_t
+void video_sink( void *ctx, const unsigned char *pixels, int width, int height, uint64_t frame );
+void video_close( video_t *video );
+
+// Exposed for the micro-benchmarks. Converts the given rows of a bottom-up
+// RGBA image into top-down I420 planes. y0 and y1 must be even, or y1 == height.
+void video_rgba_to_i420( const unsigned char *rgba, int width, int height, int y0, int y1,
+  unsigned char *yPlane, unsigned char *uPlane, unsigned char *vPlane );
+
+#endif